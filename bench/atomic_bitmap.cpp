@@ -0,0 +1,148 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures allocation and deallocation throughput of the bitmap allocator at high occupancy.
+// The bitmap is prefilled to the given occupancy, then threads allocate and free indices. The results are compared
+// to a naive allocator that scans the bitmap from the beginning and claims bits with a CAS loop.
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/atomic_bitmap.hpp>
+
+#include <cstddef>
+#include <climits>
+#include <iostream>
+#include <boost/config.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/chrono/chrono.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/barrier.hpp>
+#include <boost/smart_ptr/scoped_array.hpp>
+
+namespace chrono = boost::chrono;
+
+typedef chrono::steady_clock clock_type;
+
+BOOST_CONSTEXPR_OR_CONST std::size_t bitmap_size = 1048576u;
+BOOST_CONSTEXPR_OR_CONST unsigned int iteration_count = 200000u;
+BOOST_CONSTEXPR_OR_CONST unsigned int batch_size = 16u;
+
+//! Naive bitmap allocator for comparison
+class naive_bitmap
+{
+private:
+    static BOOST_CONSTEXPR_OR_CONST unsigned int bits_per_word = sizeof(std::size_t) * CHAR_BIT;
+
+    boost::scoped_array< boost::atomic< std::size_t > > m_words;
+    std::size_t m_word_count;
+
+public:
+    explicit naive_bitmap(std::size_t size) : m_words(new boost::atomic< std::size_t >[size / bits_per_word]), m_word_count(size / bits_per_word)
+    {
+        for (std::size_t i = 0u; i < m_word_count; ++i)
+            m_words[i].store(0u, boost::memory_order_relaxed);
+    }
+
+    std::size_t allocate()
+    {
+        for (std::size_t i = 0u; i < m_word_count; ++i)
+        {
+            std::size_t w = m_words[i].load(boost::memory_order_relaxed);
+            while (w != ~static_cast< std::size_t >(0u))
+            {
+                unsigned int bit = 0u;
+                while ((w & (static_cast< std::size_t >(1u) << bit)) != 0u)
+                    ++bit;
+                if (m_words[i].compare_exchange_weak(w, w | (static_cast< std::size_t >(1u) << bit), boost::memory_order_acquire, boost::memory_order_relaxed))
+                    return i * bits_per_word + bit;
+            }
+        }
+
+        return boost::atomic_bitmap::npos;
+    }
+
+    bool try_set(std::size_t index)
+    {
+        return !m_words[index / bits_per_word].bit_test_and_set(static_cast< unsigned int >(index % bits_per_word), boost::memory_order_acquire);
+    }
+
+    void free(std::size_t index)
+    {
+        m_words[index / bits_per_word].opaque_and(~(static_cast< std::size_t >(1u) << (index % bits_per_word)), boost::memory_order_release);
+    }
+
+    void free(const std::size_t* indices, std::size_t count)
+    {
+        for (std::size_t i = 0u; i < count; ++i)
+            free(indices[i]);
+    }
+};
+
+//! Sets bits in a pseudo-random pattern until the given occupancy is reached
+template< typename Bitmap >
+void prefill(Bitmap& bitmap, double occupancy)
+{
+    const std::size_t target = static_cast< std::size_t >(bitmap_size * occupancy);
+    std::size_t count = 0u;
+    std::size_t x = 12345u;
+    while (count < target)
+    {
+        x = x * 1103515245u + 12345u;
+        if (bitmap.try_set((x >> 8u) % bitmap_size))
+            ++count;
+    }
+}
+
+template< typename Bitmap >
+void allocator_thread(Bitmap* bitmap, boost::barrier* barrier)
+{
+    std::size_t indices[batch_size];
+    barrier->wait();
+
+    for (unsigned int i = 0u; i < iteration_count / batch_size; ++i)
+    {
+        for (unsigned int j = 0u; j < batch_size; ++j)
+            indices[j] = bitmap->allocate();
+        bitmap->free(indices, batch_size);
+    }
+}
+
+template< typename Bitmap >
+void bench(const char* name, double occupancy, unsigned int thread_count)
+{
+    Bitmap bitmap(bitmap_size);
+    prefill(bitmap, occupancy);
+
+    boost::barrier barrier(thread_count + 1u);
+    boost::scoped_array< boost::thread > threads(new boost::thread[thread_count]);
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        boost::thread(boost::bind(&allocator_thread< Bitmap >, &bitmap, &barrier)).swap(threads[i]);
+
+    barrier.wait();
+    const clock_type::time_point start = clock_type::now();
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        threads[i].join();
+    const clock_type::duration elapsed = clock_type::now() - start;
+
+    std::cout << name << ", occupancy: " << occupancy * 100.0 << "%, threads: " << thread_count
+        << ", allocate+free: " << chrono::duration_cast< chrono::duration< double, boost::nano > >(elapsed).count() / iteration_count << " ns/op" << std::endl;
+}
+
+int main()
+{
+    const double occupancies[] = { 0.5, 0.9, 0.99, 0.999 };
+    const unsigned int max_thread_count = boost::thread::hardware_concurrency() < 2u ? 2u : boost::thread::hardware_concurrency();
+    for (std::size_t i = 0u; i < sizeof(occupancies) / sizeof(*occupancies); ++i)
+    {
+        for (unsigned int thread_count = 1u; thread_count <= max_thread_count; thread_count *= 2u)
+        {
+            bench< boost::atomic_bitmap >("atomic_bitmap", occupancies[i], thread_count);
+            bench< naive_bitmap >("naive", occupancies[i], thread_count);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,440 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the latency and throughput of atomic operations for every storage size and memory order,
+// with a single thread (uncontended) and with multiple threads operating on the same atomic object (contended).
+// Core and extra operations of boost::atomic are measured, as well as std::atomic operations as a reference, if available.
+// Compiling the benchmark with BOOST_ATOMIC_FORCE_FALLBACK defined measures the lock-based implementation.
+// The 16-byte structure is only measured with boost::atomic, as std::atomic may require linking with libatomic for this size.
+// Every result reports whether the atomic object is lock-free, which shows whether the 16-byte operations are native or emulated.
+//
+// Usage: atomic_ops [max_threads [iterations_per_thread]]
+//
+// The results are written to the standard output in JSON format.
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/chrono/chrono.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/barrier.hpp>
+#include <boost/smart_ptr/scoped_array.hpp>
+#if !defined(BOOST_NO_CXX11_HDR_ATOMIC)
+#include <atomic>
+#endif
+
+namespace chrono = boost::chrono;
+
+typedef chrono::steady_clock clock_type;
+
+#if defined(BOOST_ATOMIC_FORCE_FALLBACK)
+const char* const backend_name = "fallback";
+#else
+const char* const backend_name = "native";
+#endif
+
+unsigned int g_iteration_count = 200000u;
+bool g_first_result = true;
+
+//! Sets of memory orders applicable to operations
+enum order_set
+{
+    load_orders,
+    store_orders,
+    rmw_orders
+};
+
+const boost::memory_order load_order_list[] = { boost::memory_order_relaxed, boost::memory_order_acquire, boost::memory_order_seq_cst };
+const boost::memory_order store_order_list[] = { boost::memory_order_relaxed, boost::memory_order_release, boost::memory_order_seq_cst };
+const boost::memory_order rmw_order_list[] = { boost::memory_order_relaxed, boost::memory_order_acquire, boost::memory_order_release, boost::memory_order_acq_rel, boost::memory_order_seq_cst };
+
+const char* order_name(boost::memory_order order)
+{
+    switch (order)
+    {
+    case boost::memory_order_relaxed:
+        return "relaxed";
+    case boost::memory_order_consume:
+        return "consume";
+    case boost::memory_order_acquire:
+        return "acquire";
+    case boost::memory_order_release:
+        return "release";
+    case boost::memory_order_acq_rel:
+        return "acq_rel";
+    default:
+        return "seq_cst";
+    }
+}
+
+//! boost::atomic implementation
+struct boost_impl
+{
+    template< typename T >
+    struct atomic
+    {
+        typedef boost::atomic< T > type;
+    };
+
+    typedef boost::memory_order order_type;
+
+    static const char* name()
+    {
+        return "boost";
+    }
+
+    static order_type convert(boost::memory_order order)
+    {
+        return order;
+    }
+};
+
+#if !defined(BOOST_NO_CXX11_HDR_ATOMIC)
+//! std::atomic implementation
+struct std_impl
+{
+    template< typename T >
+    struct atomic
+    {
+        typedef std::atomic< T > type;
+    };
+
+    typedef std::memory_order order_type;
+
+    static const char* name()
+    {
+        return "std";
+    }
+
+    static order_type convert(boost::memory_order order)
+    {
+        switch (order)
+        {
+        case boost::memory_order_relaxed:
+            return std::memory_order_relaxed;
+        case boost::memory_order_consume:
+            return std::memory_order_consume;
+        case boost::memory_order_acquire:
+            return std::memory_order_acquire;
+        case boost::memory_order_release:
+            return std::memory_order_release;
+        case boost::memory_order_acq_rel:
+            return std::memory_order_acq_rel;
+        default:
+            return std::memory_order_seq_cst;
+        }
+    }
+};
+#endif
+
+// Operations. Every operation accumulates its result, so that the compiler cannot eliminate it.
+
+#define BOOST_ATOMIC_BENCH_DEFINE_OP(op_name, orders, expr)\
+    struct op_ ## op_name\
+    {\
+        static const char* name() { return #op_name; }\
+        static order_set orders_applicable() { return orders; }\
+        template< typename T, typename Atomic, typename Order >\
+        static BOOST_FORCEINLINE void run(Atomic& a, Order order, T& acc)\
+        {\
+            (void)acc;\
+            expr;\
+        }\
+    };
+
+BOOST_ATOMIC_BENCH_DEFINE_OP(load, load_orders, acc += a.load(order))
+BOOST_ATOMIC_BENCH_DEFINE_OP(store, store_orders, a.store(acc, order))
+BOOST_ATOMIC_BENCH_DEFINE_OP(exchange, rmw_orders, acc += a.exchange(acc, order))
+BOOST_ATOMIC_BENCH_DEFINE_OP(compare_exchange_strong, rmw_orders, T expected = acc; a.compare_exchange_strong(expected, static_cast< T >(expected + static_cast< T >(1)), order); acc = expected)
+BOOST_ATOMIC_BENCH_DEFINE_OP(compare_exchange_weak, rmw_orders, T expected = acc; a.compare_exchange_weak(expected, static_cast< T >(expected + static_cast< T >(1)), order); acc = expected)
+BOOST_ATOMIC_BENCH_DEFINE_OP(fetch_add, rmw_orders, acc += a.fetch_add(static_cast< T >(1), order))
+BOOST_ATOMIC_BENCH_DEFINE_OP(fetch_sub, rmw_orders, acc += a.fetch_sub(static_cast< T >(1), order))
+BOOST_ATOMIC_BENCH_DEFINE_OP(fetch_and, rmw_orders, acc += a.fetch_and(static_cast< T >(~acc), order))
+BOOST_ATOMIC_BENCH_DEFINE_OP(fetch_or, rmw_orders, acc += a.fetch_or(static_cast< T >(acc), order))
+BOOST_ATOMIC_BENCH_DEFINE_OP(fetch_xor, rmw_orders, acc += a.fetch_xor(static_cast< T >(acc), order))
+BOOST_ATOMIC_BENCH_DEFINE_OP(fetch_negate, rmw_orders, acc += a.fetch_negate(order))
+BOOST_ATOMIC_BENCH_DEFINE_OP(fetch_complement, rmw_orders, acc += a.fetch_complement(order))
+// fetch_max mostly updates the stored value, opaque_max mostly leaves it unchanged
+BOOST_ATOMIC_BENCH_DEFINE_OP(fetch_max, rmw_orders, acc += a.fetch_max(acc, order))
+BOOST_ATOMIC_BENCH_DEFINE_OP(opaque_max, rmw_orders, a.opaque_max(static_cast< T >(1), order))
+BOOST_ATOMIC_BENCH_DEFINE_OP(opaque_add, rmw_orders, a.opaque_add(static_cast< T >(1), order))
+BOOST_ATOMIC_BENCH_DEFINE_OP(opaque_and, rmw_orders, a.opaque_and(static_cast< T >(~acc), order))
+BOOST_ATOMIC_BENCH_DEFINE_OP(opaque_negate, rmw_orders, a.opaque_negate(order))
+BOOST_ATOMIC_BENCH_DEFINE_OP(add_and_test, rmw_orders, acc += static_cast< T >(a.add_and_test(static_cast< T >(1), order)))
+BOOST_ATOMIC_BENCH_DEFINE_OP(or_and_test, rmw_orders, acc += static_cast< T >(a.or_and_test(static_cast< T >(acc), order)))
+BOOST_ATOMIC_BENCH_DEFINE_OP(bit_test_and_set, rmw_orders, acc += static_cast< T >(a.bit_test_and_set(0u, order)))
+BOOST_ATOMIC_BENCH_DEFINE_OP(bit_test_and_reset, rmw_orders, acc += static_cast< T >(a.bit_test_and_reset(0u, order)))
+BOOST_ATOMIC_BENCH_DEFINE_OP(bit_test_and_complement, rmw_orders, acc += static_cast< T >(a.bit_test_and_complement(0u, order)))
+
+#undef BOOST_ATOMIC_BENCH_DEFINE_OP
+
+//! A 16-byte structure, which is lock-free only if the target supports double-width CAS (e.g. cmpxchg16b on x86-64)
+struct uint128_struct
+{
+    boost::uint64_t m_low;
+    boost::uint64_t m_high;
+
+    uint128_struct() BOOST_NOEXCEPT
+    {
+    }
+
+    explicit uint128_struct(int value) BOOST_NOEXCEPT :
+        m_low(static_cast< boost::uint64_t >(value)),
+        m_high(0u)
+    {
+    }
+
+    uint128_struct& operator+= (uint128_struct const& that) BOOST_NOEXCEPT
+    {
+        const boost::uint64_t low = m_low + that.m_low;
+        m_high += that.m_high + static_cast< boost::uint64_t >(low < m_low);
+        m_low = low;
+        return *this;
+    }
+
+    friend uint128_struct operator+ (uint128_struct left, uint128_struct const& right) BOOST_NOEXCEPT
+    {
+        left += right;
+        return left;
+    }
+};
+
+//! Atomic object placed on its own cache line
+template< typename Atomic, typename T >
+struct padded_atomic
+{
+    char m_padding1[128];
+    Atomic m_atomic;
+    char m_padding2[128];
+
+    explicit padded_atomic(T value) : m_atomic(value)
+    {
+    }
+};
+
+//! Results of a benchmark thread
+template< typename T >
+struct thread_result
+{
+    clock_type::time_point m_start;
+    clock_type::time_point m_end;
+    T m_acc;
+};
+
+template< typename Op, typename T, typename Atomic, typename Order >
+void op_thread(Atomic* a, Order order, boost::barrier* barrier, thread_result< T >* result)
+{
+    T acc = static_cast< T >(1);
+    const unsigned int iteration_count = g_iteration_count;
+    barrier->wait();
+
+    // Every thread measures its own time, as a short run may complete before the main thread wakes up
+    const clock_type::time_point start = clock_type::now();
+    for (unsigned int i = 0u; i < iteration_count; ++i)
+        Op::template run< T >(*a, order, acc);
+    result->m_end = clock_type::now();
+
+    result->m_start = start;
+    result->m_acc = acc;
+}
+
+template< typename Impl, typename T, typename Op >
+void bench_op(const char* type_name, boost::memory_order order, unsigned int thread_count)
+{
+    typedef typename Impl::template atomic< T >::type atomic_type;
+    typedef typename Impl::order_type impl_order_type;
+
+    padded_atomic< atomic_type, T > a(static_cast< T >(0));
+    boost::scoped_array< thread_result< T > > results(new thread_result< T >[thread_count]);
+
+    boost::barrier barrier(thread_count + 1u);
+    boost::scoped_array< boost::thread > threads(new boost::thread[thread_count]);
+    for (unsigned int i = 0u; i < thread_count; ++i)
+    {
+        boost::thread(boost::bind(&op_thread< Op, T, atomic_type, impl_order_type >, &a.m_atomic, Impl::convert(order), &barrier, &results[i])).swap(threads[i]);
+    }
+
+    barrier.wait();
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        threads[i].join();
+
+    clock_type::time_point start = results[0].m_start, end = results[0].m_end;
+    for (unsigned int i = 1u; i < thread_count; ++i)
+    {
+        if (results[i].m_start < start)
+            start = results[i].m_start;
+        if (results[i].m_end > end)
+            end = results[i].m_end;
+    }
+    const clock_type::duration elapsed = end - start;
+
+    const double elapsed_ns = chrono::duration_cast< chrono::duration< double, boost::nano > >(elapsed).count();
+    const double total_ops = static_cast< double >(g_iteration_count) * thread_count;
+
+    if (!g_first_result)
+        std::cout << ",\n";
+    g_first_result = false;
+
+    std::cout << "    { \"implementation\": \"" << Impl::name()
+        << "\", \"type\": \"" << type_name
+        << "\", \"size\": " << sizeof(T)
+        << ", \"lock_free\": " << (a.m_atomic.is_lock_free() ? "true" : "false")
+        << ", \"operation\": \"" << Op::name()
+        << "\", \"order\": \"" << order_name(order)
+        << "\", \"threads\": " << thread_count
+        << ", \"ns_per_op\": " << elapsed_ns / g_iteration_count
+        << ", \"mops_per_sec\": " << total_ops * 1000.0 / elapsed_ns
+        << " }";
+}
+
+template< typename Impl, typename T, typename Op >
+void bench_op(const char* type_name, unsigned int max_thread_count)
+{
+    const boost::memory_order* orders = rmw_order_list;
+    std::size_t order_count = sizeof(rmw_order_list) / sizeof(*rmw_order_list);
+    switch (Op::orders_applicable())
+    {
+    case load_orders:
+        orders = load_order_list;
+        order_count = sizeof(load_order_list) / sizeof(*load_order_list);
+        break;
+    case store_orders:
+        orders = store_order_list;
+        order_count = sizeof(store_order_list) / sizeof(*store_order_list);
+        break;
+    default:
+        break;
+    }
+
+    for (std::size_t i = 0u; i < order_count; ++i)
+    {
+        for (unsigned int thread_count = 1u; thread_count <= max_thread_count; thread_count *= 2u)
+            bench_op< Impl, T, Op >(type_name, orders[i], thread_count);
+    }
+}
+
+//! Operations supported by both boost::atomic and std::atomic for integers
+template< typename Impl, typename T >
+void bench_integral_core_ops(const char* type_name, unsigned int max_thread_count)
+{
+    bench_op< Impl, T, op_load >(type_name, max_thread_count);
+    bench_op< Impl, T, op_store >(type_name, max_thread_count);
+    bench_op< Impl, T, op_exchange >(type_name, max_thread_count);
+    bench_op< Impl, T, op_compare_exchange_strong >(type_name, max_thread_count);
+    bench_op< Impl, T, op_compare_exchange_weak >(type_name, max_thread_count);
+    bench_op< Impl, T, op_fetch_add >(type_name, max_thread_count);
+    bench_op< Impl, T, op_fetch_sub >(type_name, max_thread_count);
+    bench_op< Impl, T, op_fetch_and >(type_name, max_thread_count);
+    bench_op< Impl, T, op_fetch_or >(type_name, max_thread_count);
+    bench_op< Impl, T, op_fetch_xor >(type_name, max_thread_count);
+}
+
+//! Extra operations of boost::atomic for integers
+template< typename T >
+void bench_integral_extra_ops(const char* type_name, unsigned int max_thread_count)
+{
+    bench_op< boost_impl, T, op_fetch_negate >(type_name, max_thread_count);
+    bench_op< boost_impl, T, op_fetch_complement >(type_name, max_thread_count);
+    bench_op< boost_impl, T, op_fetch_max >(type_name, max_thread_count);
+    bench_op< boost_impl, T, op_opaque_max >(type_name, max_thread_count);
+    bench_op< boost_impl, T, op_opaque_add >(type_name, max_thread_count);
+    bench_op< boost_impl, T, op_opaque_and >(type_name, max_thread_count);
+    bench_op< boost_impl, T, op_opaque_negate >(type_name, max_thread_count);
+    bench_op< boost_impl, T, op_add_and_test >(type_name, max_thread_count);
+    bench_op< boost_impl, T, op_or_and_test >(type_name, max_thread_count);
+    bench_op< boost_impl, T, op_bit_test_and_set >(type_name, max_thread_count);
+    bench_op< boost_impl, T, op_bit_test_and_reset >(type_name, max_thread_count);
+    bench_op< boost_impl, T, op_bit_test_and_complement >(type_name, max_thread_count);
+}
+
+//! Operations supported by both boost::atomic and std::atomic for floating point types
+template< typename Impl, typename T >
+void bench_floating_point_core_ops(const char* type_name, unsigned int max_thread_count)
+{
+    bench_op< Impl, T, op_load >(type_name, max_thread_count);
+    bench_op< Impl, T, op_store >(type_name, max_thread_count);
+    bench_op< Impl, T, op_exchange >(type_name, max_thread_count);
+    bench_op< Impl, T, op_compare_exchange_strong >(type_name, max_thread_count);
+}
+
+//! Arithmetic and extra operations of boost::atomic for floating point types
+template< typename T >
+void bench_floating_point_extra_ops(const char* type_name, unsigned int max_thread_count)
+{
+    bench_op< boost_impl, T, op_fetch_add >(type_name, max_thread_count);
+    bench_op< boost_impl, T, op_fetch_sub >(type_name, max_thread_count);
+    bench_op< boost_impl, T, op_fetch_negate >(type_name, max_thread_count);
+    bench_op< boost_impl, T, op_fetch_max >(type_name, max_thread_count);
+    bench_op< boost_impl, T, op_opaque_max >(type_name, max_thread_count);
+    bench_op< boost_impl, T, op_opaque_add >(type_name, max_thread_count);
+    bench_op< boost_impl, T, op_opaque_negate >(type_name, max_thread_count);
+}
+
+//! Operations supported by boost::atomic for arbitrary types
+template< typename T >
+void bench_struct(const char* type_name, unsigned int max_thread_count)
+{
+    bench_op< boost_impl, T, op_load >(type_name, max_thread_count);
+    bench_op< boost_impl, T, op_store >(type_name, max_thread_count);
+    bench_op< boost_impl, T, op_exchange >(type_name, max_thread_count);
+    bench_op< boost_impl, T, op_compare_exchange_strong >(type_name, max_thread_count);
+    bench_op< boost_impl, T, op_compare_exchange_weak >(type_name, max_thread_count);
+}
+
+template< typename T >
+void bench_integral(const char* type_name, unsigned int max_thread_count)
+{
+    bench_integral_core_ops< boost_impl, T >(type_name, max_thread_count);
+    bench_integral_extra_ops< T >(type_name, max_thread_count);
+#if !defined(BOOST_NO_CXX11_HDR_ATOMIC)
+    bench_integral_core_ops< std_impl, T >(type_name, max_thread_count);
+#endif
+}
+
+template< typename T >
+void bench_floating_point(const char* type_name, unsigned int max_thread_count)
+{
+    bench_floating_point_core_ops< boost_impl, T >(type_name, max_thread_count);
+    bench_floating_point_extra_ops< T >(type_name, max_thread_count);
+#if !defined(BOOST_NO_CXX11_HDR_ATOMIC)
+    bench_floating_point_core_ops< std_impl, T >(type_name, max_thread_count);
+#endif
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned int max_thread_count = boost::thread::hardware_concurrency();
+    if (argc > 1)
+        max_thread_count = static_cast< unsigned int >(std::strtoul(argv[1], NULL, 10));
+    if (max_thread_count == 0u)
+        max_thread_count = 1u;
+    if (argc > 2)
+        g_iteration_count = static_cast< unsigned int >(std::strtoul(argv[2], NULL, 10));
+
+    std::cout << "{\n  \"benchmark\": \"atomic_ops\",\n  \"backend\": \"" << backend_name
+        << "\",\n  \"iterations_per_thread\": " << g_iteration_count
+        << ",\n  \"results\": [\n";
+
+    bench_integral< boost::uint8_t >("uint8", max_thread_count);
+    bench_integral< boost::uint16_t >("uint16", max_thread_count);
+    bench_integral< boost::uint32_t >("uint32", max_thread_count);
+    bench_integral< boost::uint64_t >("uint64", max_thread_count);
+    bench_struct< uint128_struct >("struct128", max_thread_count);
+#if !defined(BOOST_ATOMIC_NO_FLOATING_POINT)
+    bench_floating_point< float >("float", max_thread_count);
+    bench_floating_point< double >("double", max_thread_count);
+#endif
+
+    std::cout << "\n  ]\n}" << std::endl;
+
+    return 0;
+}
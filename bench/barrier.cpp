@@ -0,0 +1,130 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the cost of a fork-join phase with the barrier and the latch, compared to Boost.Thread counterparts.
+// In the barrier test, threads repeatedly go through the barrier. In the latch test, a coordinator thread releases workers
+// with one latch and waits for their completion with another.
+
+#include <boost/atomic/latch.hpp>
+#include <boost/atomic/barrier.hpp>
+
+#include <iostream>
+#include <boost/config.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/chrono/chrono.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/latch.hpp>
+#include <boost/thread/barrier.hpp>
+#include <boost/smart_ptr/scoped_array.hpp>
+
+namespace chrono = boost::chrono;
+
+typedef chrono::steady_clock clock_type;
+
+BOOST_CONSTEXPR_OR_CONST unsigned int phase_count = 20000u;
+
+inline double to_ns(clock_type::duration d)
+{
+    return chrono::duration_cast< chrono::duration< double, boost::nano > >(d).count();
+}
+
+template< typename Barrier >
+void barrier_thread(Barrier* b)
+{
+    for (unsigned int i = 0u; i < phase_count; ++i)
+        b->arrive_and_wait();
+}
+
+void boost_barrier_thread(boost::barrier* b)
+{
+    for (unsigned int i = 0u; i < phase_count; ++i)
+        b->wait();
+}
+
+template< typename Barrier >
+void bench_barrier(const char* name, unsigned int thread_count, void (*thread_func)(Barrier*))
+{
+    Barrier b(thread_count);
+
+    const clock_type::time_point start = clock_type::now();
+    boost::scoped_array< boost::thread > threads(new boost::thread[thread_count]);
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        boost::thread(boost::bind(thread_func, &b)).swap(threads[i]);
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        threads[i].join();
+    const clock_type::duration elapsed = clock_type::now() - start;
+
+    std::cout << name << ", threads: " << thread_count << ", phase: " << to_ns(elapsed) / phase_count << " ns" << std::endl;
+}
+
+//! Fork-join phase state based on a pair of latches
+template< typename Latch >
+struct fork_join
+{
+    Latch m_fork;
+    Latch m_join;
+
+    explicit fork_join(unsigned int worker_count) : m_fork(1), m_join(worker_count)
+    {
+    }
+};
+
+template< typename Latch >
+void latch_worker_thread(fork_join< Latch >* const* phases)
+{
+    for (unsigned int i = 0u; i < phase_count; ++i)
+    {
+        phases[i]->m_fork.wait();
+        phases[i]->m_join.count_down();
+    }
+}
+
+template< typename Latch >
+void bench_latch(const char* name, unsigned int worker_count)
+{
+    // Latches are single-use, so every phase uses a new pair of latches
+    boost::scoped_array< fork_join< Latch >* > phases(new fork_join< Latch >*[phase_count]);
+    for (unsigned int i = 0u; i < phase_count; ++i)
+        phases[i] = new fork_join< Latch >(worker_count);
+
+    boost::scoped_array< boost::thread > threads(new boost::thread[worker_count]);
+    for (unsigned int i = 0u; i < worker_count; ++i)
+        boost::thread(boost::bind(&latch_worker_thread< Latch >, phases.get())).swap(threads[i]);
+
+    const clock_type::time_point start = clock_type::now();
+    for (unsigned int i = 0u; i < phase_count; ++i)
+    {
+        phases[i]->m_fork.count_down();
+        phases[i]->m_join.wait();
+    }
+    const clock_type::duration elapsed = clock_type::now() - start;
+
+    for (unsigned int i = 0u; i < worker_count; ++i)
+        threads[i].join();
+    for (unsigned int i = 0u; i < phase_count; ++i)
+        delete phases[i];
+
+    std::cout << name << ", workers: " << worker_count << ", fork-join: " << to_ns(elapsed) / phase_count << " ns" << std::endl;
+}
+
+int main()
+{
+    const unsigned int max_thread_count = boost::thread::hardware_concurrency() < 2u ? 2u : boost::thread::hardware_concurrency();
+
+    for (unsigned int thread_count = 2u; thread_count <= max_thread_count; thread_count *= 2u)
+    {
+        bench_barrier< boost::atomics::barrier<> >("boost::atomics::barrier", thread_count, &barrier_thread< boost::atomics::barrier<> >);
+        bench_barrier< boost::barrier >("boost::barrier", thread_count, &boost_barrier_thread);
+    }
+
+    for (unsigned int worker_count = 1u; worker_count < max_thread_count; worker_count *= 2u)
+    {
+        bench_latch< boost::atomics::latch >("boost::atomics::latch", worker_count);
+        bench_latch< boost::latch >("boost::latch", worker_count);
+    }
+
+    return 0;
+}
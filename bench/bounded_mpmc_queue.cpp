@@ -0,0 +1,126 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures throughput and latency of the bounded MPMC queue with 1 to 64 producers and consumers.
+// Every element carries the time it was pushed, the consumer computes the latency between push and pop.
+// Each configuration is run with non-blocking operations, which spin while the queue is full or empty, and with blocking operations.
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/bounded_mpmc_queue.hpp>
+
+#include <cstddef>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/chrono/chrono.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/barrier.hpp>
+#include <boost/smart_ptr/scoped_array.hpp>
+
+namespace chrono = boost::chrono;
+
+typedef chrono::steady_clock clock_type;
+typedef boost::bounded_mpmc_queue< boost::int64_t > queue_type;
+
+BOOST_CONSTEXPR_OR_CONST unsigned int element_count = 1048576u;
+BOOST_CONSTEXPR_OR_CONST unsigned int queue_capacity = 1024u;
+BOOST_CONSTEXPR_OR_CONST unsigned int max_thread_count = 64u;
+
+inline boost::int64_t now_ns()
+{
+    return chrono::duration_cast< chrono::nanoseconds >(clock_type::now().time_since_epoch()).count();
+}
+
+void producer_thread(queue_type* q, boost::barrier* barrier, unsigned int count, bool blocking)
+{
+    barrier->wait();
+
+    for (unsigned int i = 0u; i < count; ++i)
+    {
+        if (blocking)
+        {
+            q->push_wait(now_ns());
+        }
+        else
+        {
+            while (!q->try_push(now_ns()))
+                boost::this_thread::yield();
+        }
+    }
+}
+
+void consumer_thread(queue_type* q, boost::barrier* barrier, unsigned int count, bool blocking, std::vector< boost::int64_t >* latencies)
+{
+    latencies->reserve(count);
+    barrier->wait();
+
+    for (unsigned int i = 0u; i < count; ++i)
+    {
+        boost::int64_t push_time = 0;
+        if (blocking)
+        {
+            q->pop_wait(push_time);
+        }
+        else
+        {
+            while (!q->try_pop(push_time))
+                boost::this_thread::yield();
+        }
+
+        latencies->push_back(now_ns() - push_time);
+    }
+}
+
+void bench(unsigned int thread_count, bool blocking)
+{
+    queue_type q(queue_capacity);
+    const unsigned int count_per_thread = element_count / thread_count;
+
+    boost::barrier barrier(thread_count * 2u + 1u);
+    boost::scoped_array< boost::thread > threads(new boost::thread[thread_count * 2u]);
+    boost::scoped_array< std::vector< boost::int64_t > > latencies(new std::vector< boost::int64_t >[thread_count]);
+
+    for (unsigned int i = 0u; i < thread_count; ++i)
+    {
+        boost::thread(boost::bind(&producer_thread, &q, &barrier, count_per_thread, blocking)).swap(threads[i * 2u]);
+        boost::thread(boost::bind(&consumer_thread, &q, &barrier, count_per_thread, blocking, &latencies[i])).swap(threads[i * 2u + 1u]);
+    }
+
+    barrier.wait();
+    const clock_type::time_point start = clock_type::now();
+
+    for (unsigned int i = 0u; i < thread_count * 2u; ++i)
+        threads[i].join();
+
+    const clock_type::duration elapsed = clock_type::now() - start;
+
+    std::vector< boost::int64_t > all_latencies;
+    all_latencies.reserve(count_per_thread * thread_count);
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        all_latencies.insert(all_latencies.end(), latencies[i].begin(), latencies[i].end());
+    std::sort(all_latencies.begin(), all_latencies.end());
+
+    const std::size_t n = all_latencies.size();
+    std::cout << (blocking ? "blocking" : "non-blocking") << ", producers/consumers: " << thread_count
+        << ", throughput: " << static_cast< double >(n) / chrono::duration_cast< chrono::duration< double > >(elapsed).count() / 1000000.0 << " Mops/s"
+        << ", latency p50: " << all_latencies[n / 2u] << " ns"
+        << ", p99: " << all_latencies[n * 99u / 100u] << " ns"
+        << ", max: " << all_latencies[n - 1u] << " ns" << std::endl;
+}
+
+int main()
+{
+    for (unsigned int thread_count = 1u; thread_count <= max_thread_count; thread_count *= 2u)
+    {
+        bench(thread_count, false);
+        bench(thread_count, true);
+    }
+
+    return 0;
+}
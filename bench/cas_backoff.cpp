@@ -0,0 +1,172 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures throughput of the atomic operations that are implemented with CAS loops: fetch_and/fetch_or/fetch_xor
+// with the result used, fetch_add on a floating point atomic and extra operations (fetch_negate, bitwise_complement).
+// All threads operate on the same atomic object, the single thread case shows the uncontended performance.
+//
+// The benchmark is built twice: cas_backoff with the default configuration and cas_backoff_enabled with BOOST_ATOMIC_CAS_BACKOFF
+// defined. Comparing the results shows the effect of the backoff policy.
+//
+// Command line arguments: [max_threads]
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/chrono/chrono.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/barrier.hpp>
+
+namespace chrono = boost::chrono;
+
+typedef chrono::steady_clock clock_type;
+
+BOOST_CONSTEXPR_OR_CONST unsigned int iteration_count = 2000000u;
+
+struct BOOST_ALIGNMENT(128) test_state
+{
+    boost::atomic< boost::uint32_t > u32;
+    boost::atomic< boost::uint64_t > u64;
+#if !defined(BOOST_ATOMIC_NO_FLOATING_POINT)
+    boost::atomic< double > f64;
+#endif
+};
+
+// The operations return the result to make sure the compiler does not replace them with the cheaper operations that don't
+struct fetch_and_op
+{
+    static const char* name() { return "fetch_and u32"; }
+    static boost::uint32_t run(test_state& state, unsigned int i)
+    {
+        return state.u32.fetch_and(~(1u << (i & 31u)), boost::memory_order_relaxed);
+    }
+};
+
+struct fetch_or_op
+{
+    static const char* name() { return "fetch_or u64"; }
+    static boost::uint64_t run(test_state& state, unsigned int i)
+    {
+        return state.u64.fetch_or(static_cast< boost::uint64_t >(1u) << (i & 63u), boost::memory_order_acq_rel);
+    }
+};
+
+struct fetch_xor_op
+{
+    static const char* name() { return "fetch_xor u32"; }
+    static boost::uint32_t run(test_state& state, unsigned int i)
+    {
+        return state.u32.fetch_xor(i, boost::memory_order_seq_cst);
+    }
+};
+
+struct fetch_negate_op
+{
+    static const char* name() { return "fetch_negate u32"; }
+    static boost::uint32_t run(test_state& state, unsigned int)
+    {
+        return state.u32.fetch_negate(boost::memory_order_relaxed);
+    }
+};
+
+struct bitwise_complement_op
+{
+    static const char* name() { return "bitwise_complement u64"; }
+    static boost::uint64_t run(test_state& state, unsigned int)
+    {
+        return state.u64.bitwise_complement(boost::memory_order_relaxed);
+    }
+};
+
+#if !defined(BOOST_ATOMIC_NO_FLOATING_POINT)
+struct fp_fetch_add_op
+{
+    static const char* name() { return "fetch_add double"; }
+    static double run(test_state& state, unsigned int)
+    {
+        return state.f64.fetch_add(1.0, boost::memory_order_relaxed);
+    }
+};
+#endif // !defined(BOOST_ATOMIC_NO_FLOATING_POINT)
+
+template< typename Op >
+void op_thread(boost::barrier* start_barrier, test_state* state, boost::atomic< boost::uint64_t >* sink)
+{
+    start_barrier->wait();
+
+    boost::uint64_t sum = 0u;
+    for (unsigned int i = 0u; i < iteration_count; ++i)
+        sum += static_cast< boost::uint64_t >(Op::run(*state, i));
+
+    sink->opaque_add(sum, boost::memory_order_relaxed);
+}
+
+// The state is over-aligned and cannot be allocated with operator new before C++17
+static test_state g_state;
+
+template< typename Op >
+void bench(test_state& state, unsigned int thread_count)
+{
+    state.u32.store(0u, boost::memory_order_relaxed);
+    state.u64.store(0u, boost::memory_order_relaxed);
+#if !defined(BOOST_ATOMIC_NO_FLOATING_POINT)
+    state.f64.store(0.0, boost::memory_order_relaxed);
+#endif
+
+    boost::atomic< boost::uint64_t > sink(0u);
+    boost::barrier start_barrier(thread_count + 1u);
+    boost::thread_group threads;
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        threads.create_thread(boost::bind(&op_thread< Op >, &start_barrier, &state, &sink));
+
+    start_barrier.wait();
+    const clock_type::time_point start = clock_type::now();
+    threads.join_all();
+    const clock_type::time_point end = clock_type::now();
+
+    const double elapsed_ns = chrono::duration_cast< chrono::duration< double, boost::nano > >(end - start).count();
+    const double total_ops = static_cast< double >(iteration_count) * thread_count;
+    std::cout << std::setw(24) << Op::name() << std::setw(5) << thread_count << " threads: "
+        << std::setw(10) << total_ops * 1000.0 / elapsed_ns << " Mops/s, "
+        << std::setw(8) << elapsed_ns / iteration_count << " ns/op per thread" << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned int max_thread_count = boost::thread::hardware_concurrency();
+    if (argc > 1)
+        max_thread_count = static_cast< unsigned int >(std::strtoul(argv[1], NULL, 10));
+    if (max_thread_count < 1u)
+        max_thread_count = 1u;
+
+    std::cout << std::fixed << std::setprecision(2);
+#if defined(BOOST_ATOMIC_CAS_BACKOFF)
+    std::cout << "CAS backoff: enabled, max pause count: " << BOOST_ATOMIC_CAS_BACKOFF_MAX_PAUSE_COUNT << std::endl;
+#else
+    std::cout << "CAS backoff: disabled" << std::endl;
+#endif
+
+    for (unsigned int thread_count = 1u; thread_count <= max_thread_count; thread_count *= 2u)
+    {
+        bench< fetch_and_op >(g_state, thread_count);
+        bench< fetch_or_op >(g_state, thread_count);
+        bench< fetch_xor_op >(g_state, thread_count);
+        bench< fetch_negate_op >(g_state, thread_count);
+        bench< bitwise_complement_op >(g_state, thread_count);
+#if !defined(BOOST_ATOMIC_NO_FLOATING_POINT)
+        bench< fp_fetch_add_op >(g_state, thread_count);
+#endif
+    }
+
+    return 0;
+}
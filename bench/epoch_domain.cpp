@@ -0,0 +1,127 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the cost of pinning an epoch domain participant, compared to hazard pointer protection,
+// and the memory overhead of deferred reclamation when one of the participants stalls in a critical section.
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/epoch_domain.hpp>
+#include <boost/atomic/hazard_pointer.hpp>
+
+#include <cstddef>
+#include <iostream>
+#include <boost/config.hpp>
+#include <boost/chrono/chrono.hpp>
+
+namespace chrono = boost::chrono;
+
+typedef chrono::steady_clock clock_type;
+
+struct node
+{
+    unsigned int value;
+};
+
+BOOST_CONSTEXPR_OR_CONST unsigned int pin_iteration_count = 10000000u;
+BOOST_CONSTEXPR_OR_CONST unsigned int retire_count = 100000u;
+
+boost::atomic< node* > g_current(static_cast< node* >(NULL));
+
+void delete_node(void* p)
+{
+    delete static_cast< node* >(p);
+}
+
+template< typename Domain >
+void bench_pin(const char* name)
+{
+    Domain domain;
+    typename Domain::participant p(domain);
+
+    unsigned int sum = 0u;
+    const clock_type::time_point start = clock_type::now();
+    for (unsigned int i = 0u; i < pin_iteration_count; ++i)
+    {
+        typename Domain::guard g(p);
+        sum += g_current.load(boost::memory_order_acquire)->value;
+    }
+    const clock_type::duration elapsed = clock_type::now() - start;
+
+    std::cout << name << " pin/unpin: " << chrono::duration_cast< chrono::duration< double, boost::nano > >(elapsed).count() / pin_iteration_count << " ns/op (" << sum << ")" << std::endl;
+}
+
+void bench_hazard_pointer()
+{
+    boost::hazard_pointer_domain domain;
+    boost::hazard_pointer hp(domain);
+
+    unsigned int sum = 0u;
+    const clock_type::time_point start = clock_type::now();
+    for (unsigned int i = 0u; i < pin_iteration_count; ++i)
+    {
+        sum += hp.protect(g_current)->value;
+        hp.reset_protection();
+    }
+    const clock_type::duration elapsed = clock_type::now() - start;
+
+    std::cout << "hazard_pointer protect/reset: " << chrono::duration_cast< chrono::duration< double, boost::nano > >(elapsed).count() / pin_iteration_count << " ns/op (" << sum << ")" << std::endl;
+}
+
+template< typename Domain >
+void bench_stalled(const char* name)
+{
+    Domain domain;
+    typename Domain::participant writer(domain);
+    std::size_t max_pending = 0u;
+
+    {
+        // The stalled participant stays pinned while the writer retires objects
+        typename Domain::participant stalled(domain);
+        typename Domain::guard stalled_guard(stalled);
+
+        const clock_type::time_point start = clock_type::now();
+        for (unsigned int i = 0u; i < retire_count; ++i)
+        {
+            typename Domain::guard g(writer);
+            writer.retire(g_current.exchange(new node(), boost::memory_order_acq_rel), &delete_node);
+            if (writer.retired_count() > max_pending)
+                max_pending = writer.retired_count();
+        }
+        const clock_type::duration elapsed = clock_type::now() - start;
+
+        std::cout << name << " stalled participant: retire: " << chrono::duration_cast< chrono::duration< double, boost::nano > >(elapsed).count() / retire_count << " ns/op"
+            << ", pending objects: " << max_pending << ", pending memory: " << max_pending * (sizeof(node) + sizeof(void*) * 2u) << " bytes" << std::endl;
+    }
+
+    // Once the stalled participant leaves, the pending objects are reclaimed after two epoch advances
+    max_pending = 0u;
+    for (unsigned int i = 0u; i < retire_count; ++i)
+    {
+        typename Domain::guard g(writer);
+        writer.retire(g_current.exchange(new node(), boost::memory_order_acq_rel), &delete_node);
+        if (writer.retired_count() > max_pending)
+            max_pending = writer.retired_count();
+    }
+
+    std::cout << name << " no stalled participants: pending objects: " << max_pending << std::endl;
+}
+
+int main()
+{
+    g_current.store(new node());
+
+    bench_pin< boost::epoch_domain >("epoch_domain");
+    bench_pin< boost::ipc_epoch_domain >("ipc_epoch_domain");
+    bench_hazard_pointer();
+
+    bench_stalled< boost::epoch_domain >("epoch_domain");
+    bench_stalled< boost::ipc_epoch_domain >("ipc_epoch_domain");
+
+    delete g_current.load();
+
+    return 0;
+}
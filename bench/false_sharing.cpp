@@ -0,0 +1,109 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the effect of false sharing. Every thread increments its own atomic counter, and the counters
+// are placed in an array either densely, padded to the cache line size (constructive interference size) or isolated
+// with padded_atomic (destructive interference size). The latter also avoids interference caused by the adjacent cache
+// line prefetch on some CPUs.
+//
+// Command line arguments: [max_threads]
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/interference_size.hpp>
+#include <boost/atomic/cache_isolated.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/chrono/chrono.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/barrier.hpp>
+
+namespace chrono = boost::chrono;
+
+typedef chrono::steady_clock clock_type;
+
+BOOST_CONSTEXPR_OR_CONST unsigned int iteration_count = 10000000u;
+//! Maximum number of threads, which is also the size of the counter arrays
+BOOST_CONSTEXPR_OR_CONST unsigned int max_counter_count = 256u;
+
+typedef boost::atomic< boost::uint64_t > dense_counter;
+
+struct BOOST_ALIGNMENT(BOOST_ATOMIC_CONSTRUCTIVE_INTERFERENCE_SIZE) cache_line_counter
+{
+    dense_counter counter;
+};
+
+typedef boost::atomics::padded_atomic< boost::uint64_t > padded_counter;
+
+inline dense_counter& get_counter(dense_counter& c) { return c; }
+inline dense_counter& get_counter(cache_line_counter& c) { return c.counter; }
+inline padded_counter& get_counter(padded_counter& c) { return c; }
+
+template< typename Counter >
+void increment_thread(boost::barrier* start_barrier, Counter* counter)
+{
+    start_barrier->wait();
+
+    for (unsigned int i = 0u; i < iteration_count; ++i)
+        get_counter(*counter).opaque_add(1u, boost::memory_order_relaxed);
+}
+
+template< typename Counter >
+void bench(const char* name, Counter* counters, unsigned int thread_count)
+{
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        get_counter(counters[i]).store(0u, boost::memory_order_relaxed);
+
+    boost::barrier start_barrier(thread_count + 1u);
+    boost::thread_group threads;
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        threads.create_thread(boost::bind(&increment_thread< Counter >, &start_barrier, counters + i));
+
+    start_barrier.wait();
+    const clock_type::time_point start = clock_type::now();
+    threads.join_all();
+    const clock_type::time_point end = clock_type::now();
+
+    const double elapsed_ns = chrono::duration_cast< chrono::duration< double, boost::nano > >(end - start).count();
+    std::cout << std::setw(12) << name << " (" << std::setw(4) << sizeof(Counter) << " bytes)" << std::setw(5) << thread_count
+        << " threads: " << std::setw(8) << elapsed_ns / iteration_count << " ns/increment per thread" << std::endl;
+}
+
+// The arrays are too large to be placed on the stack
+static dense_counter g_dense_counters[max_counter_count];
+static cache_line_counter g_cache_line_counters[max_counter_count];
+static padded_counter g_padded_counters[max_counter_count];
+
+int main(int argc, char* argv[])
+{
+    unsigned int max_thread_count = boost::thread::hardware_concurrency();
+    if (argc > 1)
+        max_thread_count = static_cast< unsigned int >(std::strtoul(argv[1], NULL, 10));
+    if (max_thread_count < 2u)
+        max_thread_count = 2u;
+    if (max_thread_count > max_counter_count)
+        max_thread_count = max_counter_count;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Constructive interference size: " << boost::atomics::constructive_interference_size
+        << ", destructive interference size: " << boost::atomics::destructive_interference_size
+        << ", detected cache line size: " << boost::atomics::cache_line_size() << std::endl;
+
+    for (unsigned int thread_count = 1u; thread_count <= max_thread_count; thread_count *= 2u)
+    {
+        bench("dense", g_dense_counters, thread_count);
+        bench("cache line", g_cache_line_counters, thread_count);
+        bench("padded", g_padded_counters, thread_count);
+    }
+
+    return 0;
+}
@@ -0,0 +1,186 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the cost of hazard pointer protection and the reclamation latency of retired objects.
+// Protection cost is compared to a naive implementation that uses a sequentially consistent store to publish the hazard pointer.
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/hazard_pointer.hpp>
+
+#include <cstddef>
+#include <iostream>
+#include <boost/config.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/chrono/chrono.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/barrier.hpp>
+#include <boost/smart_ptr/scoped_array.hpp>
+
+namespace chrono = boost::chrono;
+
+typedef chrono::steady_clock clock_type;
+
+struct node;
+
+struct node_deleter
+{
+    void operator() (node* p) const;
+};
+
+struct node :
+    public boost::hazard_pointer_obj_base< node, node_deleter >
+{
+    clock_type::time_point retire_time;
+};
+
+BOOST_CONSTEXPR_OR_CONST unsigned int protect_iteration_count = 10000000u;
+BOOST_CONSTEXPR_OR_CONST unsigned int retire_count = 1000000u;
+
+boost::atomic< node* > g_current(static_cast< node* >(NULL));
+boost::atomic< bool > g_done(false);
+
+// Reclamation statistics, only updated by the thread that performs the scan
+clock_type::duration g_total_latency = clock_type::duration::zero();
+clock_type::duration g_max_latency = clock_type::duration::zero();
+unsigned int g_reclaimed_count = 0u;
+
+void node_deleter::operator() (node* p) const
+{
+    const clock_type::duration latency = clock_type::now() - p->retire_time;
+    g_total_latency += latency;
+    if (latency > g_max_latency)
+        g_max_latency = latency;
+    ++g_reclaimed_count;
+    delete p;
+}
+
+//! Naive hazard pointer protection that publishes the hazard pointer with a seq_cst store
+inline node* protect_seq_cst(boost::atomic< const void* >& hazard, boost::atomic< node* > const& src)
+{
+    node* ptr = src.load(boost::memory_order_relaxed);
+    while (true)
+    {
+        hazard.store(ptr, boost::memory_order_seq_cst);
+        node* new_ptr = src.load(boost::memory_order_acquire);
+        if (new_ptr == ptr)
+            return ptr;
+        ptr = new_ptr;
+    }
+}
+
+void bench_protect()
+{
+    boost::hazard_pointer_domain domain;
+    node* n = new node();
+    g_current.store(n);
+
+    {
+        boost::hazard_pointer hp(domain);
+        const clock_type::time_point start = clock_type::now();
+        for (unsigned int i = 0u; i < protect_iteration_count; ++i)
+        {
+            hp.protect(g_current);
+            hp.reset_protection();
+        }
+        const clock_type::duration elapsed = clock_type::now() - start;
+
+        std::cout << "hazard_pointer::protect: " << chrono::duration_cast< chrono::duration< double, boost::nano > >(elapsed).count() / protect_iteration_count << " ns/op" << std::endl;
+    }
+
+    {
+        boost::atomic< const void* > hazard(static_cast< const void* >(NULL));
+        const clock_type::time_point start = clock_type::now();
+        for (unsigned int i = 0u; i < protect_iteration_count; ++i)
+        {
+            protect_seq_cst(hazard, g_current);
+            hazard.store(NULL, boost::memory_order_release);
+        }
+        const clock_type::duration elapsed = clock_type::now() - start;
+
+        std::cout << "seq_cst store protect: " << chrono::duration_cast< chrono::duration< double, boost::nano > >(elapsed).count() / protect_iteration_count << " ns/op" << std::endl;
+    }
+
+    g_current.store(NULL);
+    delete n;
+}
+
+void reader_thread(boost::hazard_pointer_domain* domain, boost::barrier* barrier, unsigned long* iteration_count)
+{
+    boost::hazard_pointer hp(*domain);
+    barrier->wait();
+
+    unsigned long count = 0u;
+    while (!g_done.load(boost::memory_order_relaxed))
+    {
+        hp.protect(g_current);
+        hp.reset_protection();
+        ++count;
+    }
+
+    *iteration_count = count;
+}
+
+void bench_reclamation(unsigned int thread_count)
+{
+    g_done.store(false);
+    g_total_latency = clock_type::duration::zero();
+    g_max_latency = clock_type::duration::zero();
+    g_reclaimed_count = 0u;
+
+    clock_type::duration elapsed;
+    boost::scoped_array< unsigned long > iteration_counts(new unsigned long[thread_count]);
+    {
+        boost::hazard_pointer_domain domain;
+        g_current.store(new node());
+
+        boost::barrier barrier(thread_count + 1u);
+        boost::scoped_array< boost::thread > threads(new boost::thread[thread_count]);
+        for (unsigned int i = 0u; i < thread_count; ++i)
+            boost::thread(boost::bind(&reader_thread, &domain, &barrier, &iteration_counts[i])).swap(threads[i]);
+
+        barrier.wait();
+
+        const clock_type::time_point start = clock_type::now();
+        for (unsigned int i = 0u; i < retire_count; ++i)
+        {
+            node* old = g_current.exchange(new node(), boost::memory_order_acq_rel);
+            old->retire_time = clock_type::now();
+            old->retire(domain);
+        }
+        elapsed = clock_type::now() - start;
+
+        g_done.store(true, boost::memory_order_relaxed);
+        for (unsigned int i = 0u; i < thread_count; ++i)
+            threads[i].join();
+
+        // Only account objects reclaimed while the writer was running
+        const unsigned int reclaimed_count = g_reclaimed_count > 0u ? g_reclaimed_count : 1u;
+        std::cout << "readers: " << thread_count
+            << ", retire: " << chrono::duration_cast< chrono::duration< double, boost::nano > >(elapsed).count() / retire_count << " ns/op"
+            << ", reclamation latency avg: " << chrono::duration_cast< chrono::duration< double, boost::micro > >(g_total_latency).count() / reclaimed_count << " us"
+            << ", max: " << chrono::duration_cast< chrono::duration< double, boost::micro > >(g_max_latency).count() << " us";
+
+        g_current.load()->retire(domain);
+    }
+
+    unsigned long total_iterations = 0u;
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        total_iterations += iteration_counts[i];
+
+    std::cout << ", reader protect: " << chrono::duration_cast< chrono::duration< double, boost::nano > >(elapsed).count() * thread_count / (total_iterations > 0u ? total_iterations : 1u) << " ns/op" << std::endl;
+}
+
+int main()
+{
+    bench_protect();
+
+    const unsigned int max_thread_count = boost::thread::hardware_concurrency() < 2u ? 2u : boost::thread::hardware_concurrency();
+    for (unsigned int thread_count = 1u; thread_count < max_thread_count; thread_count *= 2u)
+        bench_reclamation(thread_count);
+
+    return 0;
+}
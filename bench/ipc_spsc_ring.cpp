@@ -0,0 +1,173 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures throughput and latency of the SPSC ring buffer between two processes. The rings are placed
+// in an anonymous shared memory mapping, which is inherited by the child process. Throughput is measured by streaming
+// elements with different batch sizes, latency is measured as the round trip time of a ping-pong over two rings.
+
+#include <boost/atomic/ipc_spsc_ring.hpp>
+
+#include <cstddef>
+#include <new>
+#include <iostream>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/chrono/chrono.hpp>
+
+#if !defined(BOOST_WINDOWS)
+
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+namespace chrono = boost::chrono;
+
+typedef chrono::steady_clock clock_type;
+typedef boost::ipc_spsc_ring< boost::uint64_t, 4096u > ring_type;
+
+BOOST_CONSTEXPR_OR_CONST boost::uint64_t stream_element_count = 20000000u;
+BOOST_CONSTEXPR_OR_CONST unsigned int ping_pong_count = 200000u;
+
+struct shared_state
+{
+    ring_type ping;
+    ring_type pong;
+};
+
+void stream_producer(ring_type* ring, std::size_t batch_size)
+{
+    boost::uint64_t next = 0u;
+    while (next < stream_element_count)
+    {
+        std::size_t count = batch_size;
+        if (count > stream_element_count - next)
+            count = static_cast< std::size_t >(stream_element_count - next);
+        boost::uint64_t* p = ring->reserve_push_wait(count);
+        for (std::size_t i = 0u; i < count; ++i)
+            p[i] = next++;
+        ring->commit_push(count);
+    }
+}
+
+void stream_consumer(ring_type* ring, std::size_t batch_size)
+{
+    boost::uint64_t received = 0u, sum = 0u;
+    const clock_type::time_point start = clock_type::now();
+    while (received < stream_element_count)
+    {
+        std::size_t count = batch_size;
+        const boost::uint64_t* p = ring->reserve_pop_wait(count);
+        for (std::size_t i = 0u; i < count; ++i)
+            sum += p[i];
+        ring->commit_pop(count);
+        received += count;
+    }
+    const clock_type::duration elapsed = clock_type::now() - start;
+
+    std::cout << "batch size: " << batch_size
+        << ", throughput: " << static_cast< double >(stream_element_count) / chrono::duration_cast< chrono::duration< double > >(elapsed).count() / 1000000.0 << " Mops/s"
+        << " (" << sum << ")" << std::endl;
+}
+
+void ping_pong_responder(shared_state* state)
+{
+    for (unsigned int i = 0u; i < ping_pong_count; ++i)
+    {
+        boost::uint64_t value = 0u;
+        state->ping.pop_wait(value);
+        state->pong.push_wait(value);
+    }
+}
+
+void ping_pong_initiator(shared_state* state)
+{
+    const clock_type::time_point start = clock_type::now();
+    for (unsigned int i = 0u; i < ping_pong_count; ++i)
+    {
+        boost::uint64_t value = i;
+        state->ping.push_wait(value);
+        state->pong.pop_wait(value);
+    }
+    const clock_type::duration elapsed = clock_type::now() - start;
+
+    std::cout << "ping-pong round trip: " << chrono::duration_cast< chrono::duration< double, boost::nano > >(elapsed).count() / ping_pong_count << " ns" << std::endl;
+}
+
+//! Runs \a child in a child process and \a parent in the current process, with the shared state constructed in shared memory
+template< typename Child, typename Parent >
+bool run_processes(Child child, Parent parent)
+{
+    void* mem = mmap(NULL, sizeof(shared_state), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED)
+    {
+        std::cerr << "Failed to map shared memory" << std::endl;
+        return false;
+    }
+
+    shared_state* state = new (mem) shared_state();
+
+    pid_t pid = fork();
+    if (pid < 0)
+    {
+        std::cerr << "Failed to create a child process" << std::endl;
+        munmap(mem, sizeof(shared_state));
+        return false;
+    }
+
+    if (pid == 0)
+    {
+        child(state);
+        _exit(0);
+    }
+
+    parent(state);
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+
+    state->~shared_state();
+    munmap(mem, sizeof(shared_state));
+    return true;
+}
+
+struct stream_child
+{
+    std::size_t batch_size;
+    explicit stream_child(std::size_t bs) : batch_size(bs) {}
+    void operator() (shared_state* state) const { stream_producer(&state->ping, batch_size); }
+};
+
+struct stream_parent
+{
+    std::size_t batch_size;
+    explicit stream_parent(std::size_t bs) : batch_size(bs) {}
+    void operator() (shared_state* state) const { stream_consumer(&state->ping, batch_size); }
+};
+
+int main()
+{
+    const std::size_t batch_sizes[] = { 1u, 16u, 256u };
+    for (std::size_t i = 0u; i < sizeof(batch_sizes) / sizeof(*batch_sizes); ++i)
+    {
+        if (!run_processes(stream_child(batch_sizes[i]), stream_parent(batch_sizes[i])))
+            return 1;
+    }
+
+    if (!run_processes(&ping_pong_responder, &ping_pong_initiator))
+        return 1;
+
+    return 0;
+}
+
+#else // !defined(BOOST_WINDOWS)
+
+int main()
+{
+    std::cout << "This benchmark is not supported on this platform" << std::endl;
+    return 0;
+}
+
+#endif // !defined(BOOST_WINDOWS)
@@ -0,0 +1,168 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures throughput of multi-word compare-and-swap operations on 2, 3 and 4 words. Every thread repeatedly
+// selects the given number of distinct words out of a small array, loads them and increments all of them with a multi-word
+// compare-and-swap. The lock-free and the lock-based implementations are compared with a single global mutex protecting
+// all words.
+//
+// Command line arguments: [max_threads]
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/kcas.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/chrono/chrono.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/barrier.hpp>
+#include <boost/thread/lock_guard.hpp>
+
+namespace chrono = boost::chrono;
+
+typedef chrono::steady_clock clock_type;
+
+BOOST_CONSTEXPR_OR_CONST unsigned int iteration_count = 200000u;
+//! Number of words the operations select from
+BOOST_CONSTEXPR_OR_CONST std::size_t word_count = 16u;
+//! The increment is shifted to keep the bits reserved by the lock-free implementation clear
+BOOST_CONSTEXPR_OR_CONST boost::uintptr_t increment = 4u;
+
+//! Multi-word compare-and-swap implemented with a global mutex, which has the same interface as the Boost.Atomic domains
+class mutex_kcas_domain
+{
+public:
+    class participant
+    {
+    private:
+        mutex_kcas_domain& m_domain;
+
+    public:
+        explicit participant(mutex_kcas_domain& domain) : m_domain(domain)
+        {
+        }
+
+        boost::uintptr_t load(boost::kcas_word const& w)
+        {
+            boost::lock_guard< boost::mutex > lock(m_domain.m_mutex);
+            return w.load(boost::memory_order_relaxed);
+        }
+
+        bool compare_exchange(boost::kcas_entry const* entries, std::size_t count)
+        {
+            boost::lock_guard< boost::mutex > lock(m_domain.m_mutex);
+            for (std::size_t i = 0u; i < count; ++i)
+            {
+                if (entries[i].word->load(boost::memory_order_relaxed) != entries[i].expected)
+                    return false;
+            }
+
+            for (std::size_t i = 0u; i < count; ++i)
+                entries[i].word->store(entries[i].desired, boost::memory_order_relaxed);
+
+            return true;
+        }
+    };
+
+private:
+    boost::mutex m_mutex;
+};
+
+template< typename Domain >
+struct test_state
+{
+    Domain domain;
+    boost::kcas_word words[word_count];
+};
+
+template< typename Domain >
+void op_thread(boost::barrier* start_barrier, test_state< Domain >* state, std::size_t k, unsigned int seed, unsigned int* success_count)
+{
+    typename Domain::participant p(state->domain);
+    start_barrier->wait();
+
+    unsigned int successes = 0u;
+    boost::kcas_entry entries[4];
+    for (unsigned int i = 0u; i < iteration_count; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+        const std::size_t first = (seed >> 16) % word_count;
+        for (std::size_t j = 0u; j < k; ++j)
+        {
+            // Select distinct words spread over the array
+            boost::kcas_word& w = state->words[(first + j * (word_count / 4u)) % word_count];
+            entries[j].word = &w;
+            entries[j].expected = p.load(w);
+            entries[j].desired = entries[j].expected + increment;
+        }
+
+        successes += static_cast< unsigned int >(p.compare_exchange(entries, k));
+    }
+
+    *success_count = successes;
+}
+
+template< typename Domain >
+void bench(const char* name, std::size_t k, unsigned int thread_count)
+{
+    test_state< Domain > state;
+    for (std::size_t i = 0u; i < word_count; ++i)
+        state.words[i].store(0u, boost::memory_order_relaxed);
+
+    unsigned int success_counts[boost::epoch_domain::max_participants] = {};
+    boost::barrier start_barrier(thread_count + 1u);
+    boost::thread_group threads;
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        threads.create_thread(boost::bind(&op_thread< Domain >, &start_barrier, &state, k, i + 1u, &success_counts[i]));
+
+    start_barrier.wait();
+    const clock_type::time_point start = clock_type::now();
+    threads.join_all();
+    const clock_type::time_point end = clock_type::now();
+
+    unsigned int total_successes = 0u;
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        total_successes += success_counts[i];
+
+    const double elapsed_ns = chrono::duration_cast< chrono::duration< double, boost::nano > >(end - start).count();
+    const double total_ops = static_cast< double >(iteration_count) * thread_count;
+    std::cout << std::setw(8) << name << ' ' << k << " words" << std::setw(5) << thread_count << " threads: "
+        << std::setw(10) << total_ops * 1000.0 / elapsed_ns << " Mops/s, "
+        << std::setw(8) << elapsed_ns / iteration_count << " ns/op per thread, "
+        << std::setw(6) << total_successes * 100.0 / total_ops << "% succeeded" << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned int max_thread_count = boost::thread::hardware_concurrency();
+    if (argc > 1)
+        max_thread_count = static_cast< unsigned int >(std::strtoul(argv[1], NULL, 10));
+    if (max_thread_count < 1u)
+        max_thread_count = 1u;
+    // Every thread registers a participant in the epoch domain used by the lock-free implementation
+    if (max_thread_count > boost::epoch_domain::max_participants)
+        max_thread_count = static_cast< unsigned int >(boost::epoch_domain::max_participants);
+
+    std::cout << std::fixed << std::setprecision(2);
+
+    for (std::size_t k = 2u; k <= 4u; ++k)
+    {
+        for (unsigned int thread_count = 1u; thread_count <= max_thread_count; thread_count *= 2u)
+        {
+            bench< boost::kcas_domain >("lockfree", k, thread_count);
+            bench< boost::locked_kcas_domain >("locked", k, thread_count);
+            bench< mutex_kcas_domain >("mutex", k, thread_count);
+        }
+    }
+
+    return 0;
+}
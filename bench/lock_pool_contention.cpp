@@ -0,0 +1,275 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures contention in the lock pool, which is used to implement emulated atomic operations. Every thread
+// operates on its own emulated atomic object, so all contention is caused by objects sharing locks in the pool. The addresses
+// of the objects are selected so that either all objects map to the same lock ("colliding" layout) or every object maps
+// to a different lock, as long as there are enough locks ("spread" layout). Objects are always placed in different cache lines.
+//
+// Two workloads are measured:
+//
+// - "short": threads perform fetch_add, which only takes the short lock.
+// - "mixed": half of the threads perform fetch_add, the other half perform store and notify_one, which unparks the waiting thread.
+//   Every notified object also has a thread blocked in wait, which takes the short lock to load the value every time it is woken up.
+//
+// The benchmark reports total throughput and average time per operation for every thread count.
+//
+// The lock pool size is a configuration option of the library. The benchmark must be compiled with the same
+// BOOST_ATOMIC_LOCK_POOL_SIZE_LOG2 value as the library, as it is used to select the object addresses. To measure
+// a different pool size, rebuild the library and the benchmark with the macro defined, e.g.:
+//
+// b2 define=BOOST_ATOMIC_LOCK_POOL_SIZE_LOG2=10 libs/atomic/bench//lock_pool_contention
+//
+// Command line arguments: [max_threads [duration_ms]]
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/detail/lock_pool.hpp>
+#include <boost/atomic/detail/core_operations_emulated.hpp>
+#include <boost/atomic/detail/wait_ops_emulated.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <vector>
+#include <iomanip>
+#include <iostream>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/chrono/chrono.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/barrier.hpp>
+#include <boost/smart_ptr/scoped_array.hpp>
+
+#if !defined(BOOST_ATOMIC_LOCK_POOL_SIZE_LOG2)
+#define BOOST_ATOMIC_LOCK_POOL_SIZE_LOG2 8
+#endif
+
+namespace chrono = boost::chrono;
+
+typedef chrono::steady_clock clock_type;
+
+typedef boost::atomics::detail::core_operations_emulated< 8u, 8u, false, false > emulated_operations;
+typedef boost::atomics::detail::wait_operations_emulated< emulated_operations > emulated_wait_operations;
+typedef emulated_operations::storage_type storage_type;
+//! The type of the atomic objects, without the attributes of storage_type
+typedef boost::uint64_t object_type;
+
+BOOST_CONSTEXPR_OR_CONST std::size_t lock_pool_size = static_cast< std::size_t >(1u) << (BOOST_ATOMIC_LOCK_POOL_SIZE_LOG2);
+BOOST_CONSTEXPR_OR_CONST std::size_t cache_line_size = 64u;
+//! Number of operations between checks for the end of the test
+BOOST_CONSTEXPR_OR_CONST unsigned int check_interval = 256u;
+
+static unsigned int g_duration_ms = 200u;
+
+//! Returns the index of the lock in the pool that is used for the object at \a addr. Must be consistent with the library.
+inline std::size_t get_lock_index(const volatile void* addr)
+{
+    return boost::atomics::detail::lock_pool::hash_ptr< emulated_operations::storage_alignment >(addr) & (lock_pool_size - 1u);
+}
+
+enum layout
+{
+    colliding_layout,
+    spread_layout
+};
+
+//! Memory region, from which the atomic objects are selected
+class arena
+{
+private:
+    std::size_t m_size;
+    boost::scoped_array< unsigned char > m_memory;
+    unsigned char* m_begin;
+
+public:
+    explicit arena(std::size_t object_count) :
+        // Each object potentially needs to be checked against every lock, and we need to be able to pick objects from different cache lines
+        m_size(object_count * lock_pool_size * cache_line_size * 2u),
+        m_memory(new unsigned char[m_size + cache_line_size])
+    {
+        std::size_t misalignment = reinterpret_cast< boost::uintptr_t >(m_memory.get()) % cache_line_size;
+        m_begin = m_memory.get() + (misalignment != 0u ? cache_line_size - misalignment : 0u);
+    }
+
+    //! Selects the addresses of \a count objects with the given layout. Returns \c false if not enough addresses were found.
+    bool select(layout lay, std::size_t count, std::vector< object_type* >& objects)
+    {
+        objects.clear();
+
+        std::vector< bool > used_locks(lock_pool_size, false);
+        std::size_t used_lock_count = 0u;
+        std::size_t target_lock = get_lock_index(m_begin);
+
+        const unsigned char* last_line = NULL;
+        for (std::size_t offset = 0u; offset + sizeof(storage_type) <= m_size && objects.size() < count; offset += emulated_operations::storage_alignment)
+        {
+            unsigned char* p = m_begin + offset;
+            const unsigned char* line = m_begin + (offset / cache_line_size) * cache_line_size;
+            if (line == last_line)
+                continue;
+
+            const std::size_t lock_index = get_lock_index(p);
+            if (lay == colliding_layout)
+            {
+                if (lock_index != target_lock)
+                    continue;
+            }
+            else
+            {
+                if (used_locks[lock_index])
+                    continue;
+
+                used_locks[lock_index] = true;
+                if (++used_lock_count == lock_pool_size)
+                {
+                    // All locks are used, start reusing them
+                    used_locks.assign(lock_pool_size, false);
+                    used_lock_count = 0u;
+                }
+            }
+
+            last_line = line;
+            objects.push_back(new (p) object_type(0u));
+        }
+
+        return objects.size() == count;
+    }
+
+    BOOST_DELETED_FUNCTION(arena(arena const&))
+    BOOST_DELETED_FUNCTION(arena& operator= (arena const&))
+};
+
+struct test_state
+{
+    boost::barrier start_barrier;
+    boost::atomic< bool > stop;
+
+    explicit test_state(unsigned int thread_count) : start_barrier(thread_count + 1u), stop(false)
+    {
+    }
+};
+
+void short_op_thread(test_state* state, object_type* object, boost::uint64_t* op_count)
+{
+    state->start_barrier.wait();
+
+    boost::uint64_t n = 0u;
+    while (!state->stop.load(boost::memory_order_relaxed))
+    {
+        for (unsigned int i = 0u; i < check_interval; ++i)
+            emulated_operations::fetch_add(*object, 1u, boost::memory_order_relaxed);
+        n += check_interval;
+    }
+
+    *op_count = n;
+}
+
+void notify_thread(test_state* state, object_type* object, boost::uint64_t* op_count)
+{
+    state->start_barrier.wait();
+
+    boost::uint64_t n = 0u;
+    while (!state->stop.load(boost::memory_order_relaxed))
+    {
+        for (unsigned int i = 0u; i < check_interval; ++i)
+        {
+            emulated_operations::store(*object, n + i + 1u, boost::memory_order_release);
+            emulated_wait_operations::notify_one(*object);
+        }
+        n += check_interval;
+    }
+
+    // Make sure the waiting thread observes the stop flag
+    emulated_operations::store(*object, ~static_cast< storage_type >(0u), boost::memory_order_release);
+    emulated_wait_operations::notify_one(*object);
+
+    *op_count = n;
+}
+
+void wait_thread(object_type* object)
+{
+    storage_type value = emulated_operations::load(*object, boost::memory_order_acquire);
+    while (value != ~static_cast< storage_type >(0u))
+        value = emulated_wait_operations::wait(*object, value, boost::memory_order_acquire);
+}
+
+void run_test(arena& mem, layout lay, bool mixed, unsigned int thread_count)
+{
+    std::vector< object_type* > objects;
+    if (!mem.select(lay, thread_count, objects))
+    {
+        std::cerr << "Failed to select object addresses" << std::endl;
+        return;
+    }
+
+    test_state state(thread_count);
+    std::vector< boost::uint64_t > op_counts(thread_count, 0u);
+    boost::thread_group threads, waiters;
+    for (unsigned int i = 0u; i < thread_count; ++i)
+    {
+        if (mixed && (i & 1u) != 0u)
+        {
+            threads.create_thread(boost::bind(&notify_thread, &state, objects[i], &op_counts[i]));
+            waiters.create_thread(boost::bind(&wait_thread, objects[i]));
+        }
+        else
+        {
+            threads.create_thread(boost::bind(&short_op_thread, &state, objects[i], &op_counts[i]));
+        }
+    }
+
+    state.start_barrier.wait();
+    const clock_type::time_point start = clock_type::now();
+    boost::this_thread::sleep_for(chrono::milliseconds(g_duration_ms));
+    state.stop.store(true, boost::memory_order_relaxed);
+    threads.join_all();
+    const clock_type::time_point end = clock_type::now();
+    waiters.join_all();
+
+    boost::uint64_t total_op_count = 0u;
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        total_op_count += op_counts[i];
+
+    const double elapsed_ns = chrono::duration_cast< chrono::duration< double, boost::nano > >(end - start).count();
+    std::cout << std::setw(9) << (lay == colliding_layout ? "colliding" : "spread") << std::setw(6) << (mixed ? "mixed" : "short")
+        << std::setw(5) << thread_count << " threads: " << std::setw(10) << static_cast< double >(total_op_count) * 1000.0 / elapsed_ns
+        << " Mops/s, " << std::setw(10) << elapsed_ns * thread_count / static_cast< double >(total_op_count) << " ns/op per thread" << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned int max_thread_count = boost::thread::hardware_concurrency();
+    if (argc > 1)
+        max_thread_count = static_cast< unsigned int >(std::strtoul(argv[1], NULL, 10));
+    if (max_thread_count < 2u)
+        max_thread_count = 2u;
+    if (argc > 2)
+        g_duration_ms = static_cast< unsigned int >(std::strtoul(argv[2], NULL, 10));
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Lock pool size: " << lock_pool_size << " (BOOST_ATOMIC_LOCK_POOL_SIZE_LOG2=" << (BOOST_ATOMIC_LOCK_POOL_SIZE_LOG2) << ")" << std::endl;
+
+    arena mem(max_thread_count);
+
+    for (unsigned int mixed = 0u; mixed < 2u; ++mixed)
+    {
+        for (unsigned int lay = colliding_layout; lay <= spread_layout; ++lay)
+        {
+            for (unsigned int thread_count = 1u; thread_count <= max_thread_count; thread_count *= 2u)
+            {
+                // The mixed workload needs at least one thread of each kind
+                if (mixed != 0u && thread_count < 2u)
+                    continue;
+
+                run_test(mem, static_cast< layout >(lay), mixed != 0u, thread_count);
+            }
+        }
+    }
+
+    return 0;
+}
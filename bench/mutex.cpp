@@ -0,0 +1,195 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the futex-based mutex and condition variable with the system and Boost.Thread primitives.
+// The mutex is measured uncontended, with a single thread locking and unlocking it, and contended, with a number of threads
+// incrementing a counter under the lock. The condition variable is measured with two threads passing a token back and forth.
+
+#include <boost/atomic/mutex.hpp>
+#include <boost/atomic/condition_variable.hpp>
+
+#include <iostream>
+#include <boost/config.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/chrono/chrono.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/barrier.hpp>
+#include <boost/thread/lock_types.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/smart_ptr/scoped_array.hpp>
+#if !defined(BOOST_WINDOWS)
+#include <pthread.h>
+#endif
+#if !defined(BOOST_NO_CXX11_HDR_MUTEX)
+#include <mutex>
+#endif
+
+namespace chrono = boost::chrono;
+
+typedef chrono::steady_clock clock_type;
+
+BOOST_CONSTEXPR_OR_CONST unsigned int uncontended_iteration_count = 10000000u;
+BOOST_CONSTEXPR_OR_CONST unsigned int contended_iteration_count = 1000000u;
+BOOST_CONSTEXPR_OR_CONST unsigned int ping_pong_count = 100000u;
+
+#if !defined(BOOST_WINDOWS)
+//! Lockable wrapper for pthread mutex
+class pthread_mutex
+{
+private:
+    pthread_mutex_t m_mutex;
+
+public:
+    pthread_mutex()
+    {
+        pthread_mutex_init(&m_mutex, NULL);
+    }
+
+    ~pthread_mutex()
+    {
+        pthread_mutex_destroy(&m_mutex);
+    }
+
+    void lock()
+    {
+        pthread_mutex_lock(&m_mutex);
+    }
+
+    void unlock()
+    {
+        pthread_mutex_unlock(&m_mutex);
+    }
+
+    BOOST_DELETED_FUNCTION(pthread_mutex(pthread_mutex const&))
+    BOOST_DELETED_FUNCTION(pthread_mutex& operator= (pthread_mutex const&))
+};
+#endif
+
+inline double to_ns(clock_type::duration d)
+{
+    return chrono::duration_cast< chrono::duration< double, boost::nano > >(d).count();
+}
+
+template< typename Mutex >
+void bench_uncontended(const char* name)
+{
+    Mutex m;
+    const clock_type::time_point start = clock_type::now();
+    for (unsigned int i = 0u; i < uncontended_iteration_count; ++i)
+    {
+        m.lock();
+        m.unlock();
+    }
+    const clock_type::duration elapsed = clock_type::now() - start;
+
+    std::cout << name << ", uncontended lock+unlock: " << to_ns(elapsed) / uncontended_iteration_count << " ns/op" << std::endl;
+}
+
+template< typename Mutex >
+void counter_thread(Mutex* m, unsigned int* counter, unsigned int iteration_count, boost::barrier* barrier)
+{
+    barrier->wait();
+
+    for (unsigned int i = 0u; i < iteration_count; ++i)
+    {
+        m->lock();
+        ++*counter;
+        m->unlock();
+    }
+}
+
+template< typename Mutex >
+void bench_contended(const char* name, unsigned int thread_count)
+{
+    Mutex m;
+    unsigned int counter = 0u;
+    const unsigned int iteration_count = contended_iteration_count / thread_count;
+
+    boost::barrier barrier(thread_count + 1u);
+    boost::scoped_array< boost::thread > threads(new boost::thread[thread_count]);
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        boost::thread(boost::bind(&counter_thread< Mutex >, &m, &counter, iteration_count, &barrier)).swap(threads[i]);
+
+    barrier.wait();
+    const clock_type::time_point start = clock_type::now();
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        threads[i].join();
+    const clock_type::duration elapsed = clock_type::now() - start;
+
+    std::cout << name << ", threads: " << thread_count << ", contended lock+unlock: " << to_ns(elapsed) / (iteration_count * thread_count) << " ns/op" << std::endl;
+}
+
+template< typename Mutex, typename ConditionVariable >
+struct ping_pong_state
+{
+    typedef Mutex mutex_type;
+
+    Mutex m_mutex;
+    ConditionVariable m_cond;
+    unsigned int m_turn;
+
+    ping_pong_state() : m_turn(0u)
+    {
+    }
+};
+
+template< typename State >
+void ping_pong_thread(State* state, unsigned int id)
+{
+    for (unsigned int i = 0u; i < ping_pong_count; ++i)
+    {
+        boost::unique_lock< typename State::mutex_type > lock(state->m_mutex);
+        while (state->m_turn != id)
+            state->m_cond.wait(lock);
+        state->m_turn = id ^ 1u;
+        state->m_cond.notify_one();
+    }
+}
+
+template< typename Mutex, typename ConditionVariable >
+void bench_ping_pong(const char* name)
+{
+    typedef ping_pong_state< Mutex, ConditionVariable > state;
+
+    state s;
+    const clock_type::time_point start = clock_type::now();
+    boost::thread t(boost::bind(&ping_pong_thread< state >, &s, 1u));
+    ping_pong_thread(&s, 0u);
+    t.join();
+    const clock_type::duration elapsed = clock_type::now() - start;
+
+    std::cout << name << ", condition variable round trip: " << to_ns(elapsed) / ping_pong_count << " ns" << std::endl;
+}
+
+template< typename Mutex >
+void bench_mutex(const char* name, unsigned int max_thread_count)
+{
+    bench_uncontended< Mutex >(name);
+    for (unsigned int thread_count = 2u; thread_count <= max_thread_count; thread_count *= 2u)
+        bench_contended< Mutex >(name, thread_count);
+}
+
+int main()
+{
+    const unsigned int max_thread_count = boost::thread::hardware_concurrency() < 2u ? 2u : boost::thread::hardware_concurrency();
+
+    bench_mutex< boost::atomics::mutex >("boost::atomics::mutex", max_thread_count);
+    bench_mutex< boost::atomics::ipc_mutex >("boost::atomics::ipc_mutex", max_thread_count);
+#if !defined(BOOST_WINDOWS)
+    bench_mutex< pthread_mutex >("pthread_mutex_t", max_thread_count);
+#endif
+#if !defined(BOOST_NO_CXX11_HDR_MUTEX)
+    bench_mutex< std::mutex >("std::mutex", max_thread_count);
+#endif
+    bench_mutex< boost::mutex >("boost::mutex", max_thread_count);
+
+    bench_ping_pong< boost::atomics::mutex, boost::atomics::condition_variable >("boost::atomics::condition_variable");
+    bench_ping_pong< boost::atomics::ipc_mutex, boost::atomics::ipc_condition_variable >("boost::atomics::ipc_condition_variable");
+    bench_ping_pong< boost::mutex, boost::condition_variable >("boost::condition_variable");
+
+    return 0;
+}
@@ -0,0 +1,157 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares notifying the atomic objects modified by a bursty producer one by one and with notify_batch.
+// In every burst, the producer stores to each of a number of atomic objects several times and calls notify_all after
+// every store. The benchmark reports the average duration of a burst with no threads blocked on the objects and with
+// one thread blocked on each object. The objects are boost::atomic<uint32_t>, which normally uses native waiting
+// operations, and boost::atomic<uint64_t>, which uses the parking lot when there are no native operations for 64-bit objects.
+//
+// Command line arguments: [round_count]
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/notify_batch.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/chrono/chrono.hpp>
+#include <boost/thread/thread.hpp>
+
+namespace chrono = boost::chrono;
+
+typedef chrono::steady_clock clock_type;
+
+BOOST_CONSTEXPR_OR_CONST std::size_t object_count = 8u;
+BOOST_CONSTEXPR_OR_CONST unsigned int stores_per_object = 4u;
+
+template< typename T >
+struct burst_state
+{
+    boost::atomic< T > objects[object_count];
+    boost::atomic< unsigned int > acks;
+
+    burst_state() : acks(0u)
+    {
+        for (std::size_t i = 0u; i < object_count; ++i)
+            objects[i].store(0u, boost::memory_order_relaxed);
+    }
+};
+
+struct individual_notify
+{
+    static const char* name() { return "notify_all"; }
+
+    template< typename T >
+    static void burst(burst_state< T >& state, T value)
+    {
+        for (unsigned int j = 0u; j < stores_per_object; ++j)
+        {
+            for (std::size_t i = 0u; i < object_count; ++i)
+            {
+                state.objects[i].store(value, boost::memory_order_release);
+                state.objects[i].notify_all();
+            }
+        }
+    }
+};
+
+struct batch_notify
+{
+    static const char* name() { return "notify_batch"; }
+
+    template< typename T >
+    static void burst(burst_state< T >& state, T value)
+    {
+        boost::notify_batch batch;
+        for (unsigned int j = 0u; j < stores_per_object; ++j)
+        {
+            for (std::size_t i = 0u; i < object_count; ++i)
+            {
+                state.objects[i].store(value, boost::memory_order_release);
+                batch.notify_all(state.objects[i]);
+            }
+        }
+    }
+};
+
+template< typename T >
+void waiter_thread(burst_state< T >* state, std::size_t index, unsigned int round_count)
+{
+    T value = 0u;
+    while (value < static_cast< T >(round_count))
+    {
+        value = state->objects[index].wait(value, boost::memory_order_acquire);
+        state->acks.fetch_add(1u, boost::memory_order_release);
+    }
+}
+
+template< typename T, typename Notify >
+void bench(const char* type_name, bool with_waiters, unsigned int round_count)
+{
+    burst_state< T > state;
+    boost::thread_group waiters;
+    if (with_waiters)
+    {
+        for (std::size_t i = 0u; i < object_count; ++i)
+            waiters.create_thread(boost::bind(&waiter_thread< T >, &state, i, round_count));
+    }
+
+    chrono::duration< double, boost::nano > total(0.0);
+    for (unsigned int round = 1u; round <= round_count; ++round)
+    {
+        if (with_waiters)
+        {
+            // Let the waiters block before notifying
+            boost::this_thread::sleep_for(chrono::microseconds(200));
+        }
+
+        const clock_type::time_point start = clock_type::now();
+        Notify::burst(state, static_cast< T >(round));
+        total += clock_type::now() - start;
+
+        if (with_waiters)
+        {
+            while (state.acks.load(boost::memory_order_acquire) < round * object_count)
+                boost::this_thread::yield();
+        }
+    }
+
+    waiters.join_all();
+
+    std::cout << std::setw(18) << type_name << std::setw(14) << Notify::name() << (with_waiters ? ", with waiters: " : ", no waiters:   ")
+        << std::setw(10) << total.count() / round_count << " ns/burst" << std::endl;
+}
+
+template< typename T >
+void bench_type(const char* type_name, unsigned int round_count)
+{
+    bench< T, individual_notify >(type_name, false, round_count * 10u);
+    bench< T, batch_notify >(type_name, false, round_count * 10u);
+    bench< T, individual_notify >(type_name, true, round_count);
+    bench< T, batch_notify >(type_name, true, round_count);
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned int round_count = 1000u;
+    if (argc > 1)
+        round_count = static_cast< unsigned int >(std::strtoul(argv[1], NULL, 10));
+    if (round_count < 1u)
+        round_count = 1u;
+
+    std::cout << std::fixed << std::setprecision(1);
+
+    bench_type< boost::uint32_t >("atomic<uint32_t>", round_count);
+    bench_type< boost::uint64_t >("atomic<uint64_t>", round_count);
+
+    return 0;
+}
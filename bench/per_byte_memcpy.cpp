@@ -0,0 +1,140 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares atomic per-byte memory copying with memcpy and with copying the bytes one by one
+// with atomic_ref operations, for payloads of different sizes. The source buffer is aligned and the destination
+// buffer is misaligned by one byte, as is common for seqlock readers copying data into arbitrary objects.
+//
+// Command line arguments: [iteration_count]
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/fences.hpp>
+#include <boost/atomic/atomic_ref.hpp>
+#include <boost/atomic/per_byte_memcpy.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <boost/config.hpp>
+#include <boost/chrono/chrono.hpp>
+
+namespace chrono = boost::chrono;
+
+typedef chrono::steady_clock clock_type;
+
+BOOST_CONSTEXPR_OR_CONST std::size_t max_size = 4096u;
+
+struct BOOST_ALIGNMENT(64) buffer
+{
+    unsigned char data[max_size + 64u];
+};
+
+static buffer g_src;
+static buffer g_dest;
+
+struct memcpy_load
+{
+    static const char* name() { return "memcpy"; }
+    static void run(std::size_t size)
+    {
+        std::memcpy(g_dest.data + 1u, g_src.data, size);
+    }
+};
+
+struct atomic_ref_load
+{
+    static const char* name() { return "atomic_ref per byte load"; }
+    static void run(std::size_t size)
+    {
+        for (std::size_t i = 0u; i < size; ++i)
+            g_dest.data[i + 1u] = boost::atomic_ref< unsigned char >(g_src.data[i]).load(boost::memory_order_relaxed);
+        boost::atomic_thread_fence(boost::memory_order_acquire);
+    }
+};
+
+struct per_byte_memcpy_load
+{
+    static const char* name() { return "atomic_load_per_byte_memcpy"; }
+    static void run(std::size_t size)
+    {
+        boost::atomic_load_per_byte_memcpy(g_dest.data + 1u, g_src.data, size, boost::memory_order_acquire);
+    }
+};
+
+struct memcpy_store
+{
+    static const char* name() { return "memcpy"; }
+    static void run(std::size_t size)
+    {
+        std::memcpy(g_src.data, g_dest.data + 1u, size);
+    }
+};
+
+struct atomic_ref_store
+{
+    static const char* name() { return "atomic_ref per byte store"; }
+    static void run(std::size_t size)
+    {
+        boost::atomic_thread_fence(boost::memory_order_release);
+        for (std::size_t i = 0u; i < size; ++i)
+            boost::atomic_ref< unsigned char >(g_src.data[i]).store(g_dest.data[i + 1u], boost::memory_order_relaxed);
+    }
+};
+
+struct per_byte_memcpy_store
+{
+    static const char* name() { return "atomic_store_per_byte_memcpy"; }
+    static void run(std::size_t size)
+    {
+        boost::atomic_store_per_byte_memcpy(g_src.data, g_dest.data + 1u, size, boost::memory_order_release);
+    }
+};
+
+template< typename Op >
+void bench(std::size_t size, unsigned int iteration_count)
+{
+    const clock_type::time_point start = clock_type::now();
+    for (unsigned int i = 0u; i < iteration_count; ++i)
+    {
+        Op::run(size);
+        // Prevent the compiler from optimizing away the repeated copies
+        boost::atomic_signal_fence(boost::memory_order_seq_cst);
+    }
+    const clock_type::time_point end = clock_type::now();
+
+    const double elapsed_ns = chrono::duration_cast< chrono::duration< double, boost::nano > >(end - start).count();
+    std::cout << std::setw(30) << Op::name() << std::setw(6) << size << " bytes: "
+        << std::setw(10) << elapsed_ns / iteration_count << " ns/copy, "
+        << std::setw(8) << static_cast< double >(size) * iteration_count / elapsed_ns << " bytes/ns" << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned int iteration_count = 1000000u;
+    if (argc > 1)
+        iteration_count = static_cast< unsigned int >(std::strtoul(argv[1], NULL, 10));
+    if (iteration_count < 1u)
+        iteration_count = 1u;
+
+    for (std::size_t i = 0u; i < sizeof(g_src.data); ++i)
+        g_src.data[i] = static_cast< unsigned char >(i);
+
+    std::cout << std::fixed << std::setprecision(2);
+
+    for (std::size_t size = 16u; size <= max_size; size *= 4u)
+    {
+        bench< memcpy_load >(size, iteration_count);
+        bench< atomic_ref_load >(size, iteration_count);
+        bench< per_byte_memcpy_load >(size, iteration_count);
+        bench< memcpy_store >(size, iteration_count);
+        bench< atomic_ref_store >(size, iteration_count);
+        bench< per_byte_memcpy_store >(size, iteration_count);
+    }
+
+    return 0;
+}
@@ -0,0 +1,541 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures performance of waiting and notifying operations with the different backends: the native operations
+// (e.g. futexes) of boost::atomic<uint32_t>, the parking lot based implementation used by boost::atomic<uint64_t> when there are
+// no native operations for 64-bit objects, the generic spin and sleep implementation used by boost::ipc_atomic<uint64_t>
+// in the same conditions, and atomic_flag. The benchmark measures:
+//
+// - Wake latency, which is the time from the notifying operation to the return from the waiting operation in the blocked thread.
+//   The notifying thread waits until the waiting thread blocks before notifying. The latency is reported as percentiles.
+// - Round trip time of a ping-pong between two threads and between two processes, in which each side blocks waiting
+//   for the other side to change the value.
+// - Thundering herd, where a number of threads is blocked on the same object and is woken up with a single notify_all.
+//   The benchmark reports the duration of the notify_all call and the time until the first, median and last thread wakes up.
+// - Notification cost when there are no blocked threads, which is the time of a store followed by notify_one or notify_all.
+//
+// Timestamps are taken with the TSC on x86 targets, the TSC frequency is calibrated against the steady clock at startup.
+// On other targets the steady clock is used.
+
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/atomic_flag.hpp>
+#include <boost/atomic/ipc_atomic.hpp>
+#include <boost/atomic/ipc_atomic_flag.hpp>
+
+#include <cstddef>
+#include <new>
+#include <vector>
+#include <iomanip>
+#include <iostream>
+#include <algorithm>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/memory_order.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/chrono/chrono.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/smart_ptr/scoped_array.hpp>
+#include <boost/atomic/detail/pause.hpp>
+
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define BOOST_ATOMIC_BENCH_HAS_TSC
+#endif
+
+#if !defined(BOOST_WINDOWS)
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#endif
+
+namespace chrono = boost::chrono;
+
+typedef chrono::steady_clock clock_type;
+
+BOOST_CONSTEXPR_OR_CONST unsigned int latency_sample_count = 10000u;
+BOOST_CONSTEXPR_OR_CONST unsigned int ping_pong_count = 100000u;
+BOOST_CONSTEXPR_OR_CONST unsigned int herd_round_count = 10u;
+BOOST_CONSTEXPR_OR_CONST unsigned int no_waiters_notify_count = 10000000u;
+//! Stack size of the waiting threads in the thundering herd scenario, to allow for a large number of threads
+BOOST_CONSTEXPR_OR_CONST std::size_t herd_thread_stack_size = 64u * 1024u;
+
+//! Timestamp source
+class timestamp
+{
+private:
+    static double g_ns_per_tick;
+
+public:
+    static boost::uint64_t now() BOOST_NOEXCEPT
+    {
+#if defined(BOOST_ATOMIC_BENCH_HAS_TSC)
+        return __rdtsc();
+#else
+        return static_cast< boost::uint64_t >(chrono::duration_cast< chrono::nanoseconds >(clock_type::now().time_since_epoch()).count());
+#endif
+    }
+
+    static double to_ns(boost::uint64_t ticks) BOOST_NOEXCEPT
+    {
+        return static_cast< double >(ticks) * g_ns_per_tick;
+    }
+
+    //! Calibrates the timestamp frequency against the steady clock
+    static void calibrate()
+    {
+#if defined(BOOST_ATOMIC_BENCH_HAS_TSC)
+        const clock_type::time_point start_time = clock_type::now();
+        const boost::uint64_t start_ticks = now();
+        boost::this_thread::sleep_for(chrono::milliseconds(100));
+        const boost::uint64_t end_ticks = now();
+        const clock_type::time_point end_time = clock_type::now();
+
+        g_ns_per_tick = chrono::duration_cast< chrono::duration< double, boost::nano > >(end_time - start_time).count() /
+            static_cast< double >(end_ticks - start_ticks);
+#endif
+    }
+};
+
+double timestamp::g_ns_per_tick = 1.0;
+
+//! Waitable object adapter for atomic objects of integral types
+template< typename Atomic >
+class value_waitable
+{
+private:
+    Atomic m_value;
+
+public:
+    value_waitable() BOOST_NOEXCEPT : m_value(0u)
+    {
+    }
+
+    bool has_native_wait_notify() const BOOST_NOEXCEPT
+    {
+        return m_value.has_native_wait_notify();
+    }
+
+    unsigned int load() const BOOST_NOEXCEPT
+    {
+        return static_cast< unsigned int >(m_value.load(boost::memory_order_acquire));
+    }
+
+    void store(unsigned int value) BOOST_NOEXCEPT
+    {
+        m_value.store(value, boost::memory_order_release);
+    }
+
+    unsigned int wait(unsigned int old_value) const BOOST_NOEXCEPT
+    {
+        return static_cast< unsigned int >(m_value.wait(old_value, boost::memory_order_acquire));
+    }
+
+    void notify_one() BOOST_NOEXCEPT
+    {
+        m_value.notify_one();
+    }
+
+    void notify_all() BOOST_NOEXCEPT
+    {
+        m_value.notify_all();
+    }
+};
+
+//! Waitable object adapter for atomic flags. The flag can only hold values of 0 and 1.
+template< typename Flag >
+class flag_waitable
+{
+private:
+    Flag m_flag;
+
+public:
+    bool has_native_wait_notify() const BOOST_NOEXCEPT
+    {
+        return m_flag.has_native_wait_notify();
+    }
+
+    unsigned int load() const BOOST_NOEXCEPT
+    {
+        return m_flag.test(boost::memory_order_acquire);
+    }
+
+    void store(unsigned int value) BOOST_NOEXCEPT
+    {
+        if (value != 0u)
+            m_flag.test_and_set(boost::memory_order_release);
+        else
+            m_flag.clear(boost::memory_order_release);
+    }
+
+    unsigned int wait(unsigned int old_value) const BOOST_NOEXCEPT
+    {
+        return m_flag.wait(old_value != 0u, boost::memory_order_acquire);
+    }
+
+    void notify_one() BOOST_NOEXCEPT
+    {
+        m_flag.notify_one();
+    }
+
+    void notify_all() BOOST_NOEXCEPT
+    {
+        m_flag.notify_all();
+    }
+};
+
+//! Blocks until \a w holds a value other than \a old_value
+template< typename Waitable >
+inline void wait_for_change(Waitable const& w, unsigned int old_value)
+{
+    unsigned int value = w.load();
+    while (value == old_value)
+        value = w.wait(old_value);
+}
+
+//! Blocks until \a w holds \a value
+template< typename Waitable >
+inline void wait_for_value(Waitable const& w, unsigned int value)
+{
+    unsigned int current = w.load();
+    while (current != value)
+        current = w.wait(current);
+}
+
+inline void print_percentiles(std::vector< double >& samples)
+{
+    std::sort(samples.begin(), samples.end());
+    const std::size_t n = samples.size();
+    std::cout << "p50: " << samples[n / 2u] << " ns, p99: " << samples[n * 99u / 100u] << " ns, p999: " << samples[n * 999u / 1000u]
+        << " ns, max: " << samples[n - 1u] << " ns";
+}
+
+//! The state shared between the threads in the wake latency benchmark
+template< typename Waitable >
+struct latency_state
+{
+    Waitable value;
+    //! The sample number the waiting thread is about to wait for
+    boost::atomic< unsigned int > ready;
+    //! The timestamp of the notifying operation
+    boost::atomic< boost::uint64_t > notify_timestamp;
+
+    latency_state() : ready(0u), notify_timestamp(0u)
+    {
+    }
+};
+
+template< typename Waitable >
+void latency_waiter(latency_state< Waitable >* state, std::vector< double >* samples)
+{
+    unsigned int value = 0u;
+    for (unsigned int i = 0u; i < latency_sample_count; ++i)
+    {
+        state->ready.store(i + 1u, boost::memory_order_release);
+        wait_for_change(state->value, value);
+        const boost::uint64_t wake_timestamp = timestamp::now();
+        value ^= 1u;
+        samples->push_back(timestamp::to_ns(wake_timestamp - state->notify_timestamp.load(boost::memory_order_relaxed)));
+    }
+}
+
+template< typename Waitable >
+void bench_latency(const char* name)
+{
+    latency_state< Waitable > state;
+    std::vector< double > samples;
+    samples.reserve(latency_sample_count);
+
+    boost::thread waiter(boost::bind(&latency_waiter< Waitable >, &state, &samples));
+
+    unsigned int value = 0u;
+    for (unsigned int i = 0u; i < latency_sample_count; ++i)
+    {
+        while (state.ready.load(boost::memory_order_acquire) != i + 1u)
+            boost::atomics::detail::pause();
+
+        // Give the waiting thread time to block
+        boost::this_thread::sleep_for(chrono::microseconds(50));
+
+        value ^= 1u;
+        state.notify_timestamp.store(timestamp::now(), boost::memory_order_relaxed);
+        state.value.store(value);
+        state.value.notify_one();
+    }
+
+    waiter.join();
+
+    std::cout << name << " (native: " << state.value.has_native_wait_notify() << ") wake latency: ";
+    print_percentiles(samples);
+    std::cout << std::endl;
+}
+
+//! The state shared between the ping-pong sides. The initiating side changes the value from 0 to 1, the other side changes it back.
+template< typename Waitable >
+struct ping_pong_state
+{
+    Waitable value;
+};
+
+template< typename Waitable >
+void ping_pong_initiator(ping_pong_state< Waitable >* state, unsigned int count)
+{
+    for (unsigned int i = 0u; i < count; ++i)
+    {
+        state->value.store(1u);
+        state->value.notify_one();
+        wait_for_value(state->value, 0u);
+    }
+}
+
+template< typename Waitable >
+void ping_pong_responder(ping_pong_state< Waitable >* state, unsigned int count)
+{
+    for (unsigned int i = 0u; i < count; ++i)
+    {
+        wait_for_value(state->value, 1u);
+        state->value.store(0u);
+        state->value.notify_one();
+    }
+}
+
+template< typename Waitable >
+void bench_thread_ping_pong(const char* name)
+{
+    ping_pong_state< Waitable > state;
+
+    boost::thread responder(boost::bind(&ping_pong_responder< Waitable >, &state, ping_pong_count));
+
+    const clock_type::time_point start = clock_type::now();
+    ping_pong_initiator(&state, ping_pong_count);
+    const clock_type::time_point end = clock_type::now();
+
+    responder.join();
+
+    std::cout << name << " thread ping-pong round trip: "
+        << chrono::duration_cast< chrono::duration< double, boost::nano > >(end - start).count() / ping_pong_count << " ns" << std::endl;
+}
+
+#if !defined(BOOST_WINDOWS)
+template< typename Waitable >
+void bench_process_ping_pong(const char* name, unsigned int count)
+{
+    typedef ping_pong_state< Waitable > state_type;
+
+    void* mem = mmap(NULL, sizeof(state_type), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED)
+    {
+        std::cerr << "Failed to map shared memory" << std::endl;
+        return;
+    }
+
+    state_type* state = new (mem) state_type();
+
+    pid_t pid = fork();
+    if (pid < 0)
+    {
+        std::cerr << "Failed to create a child process" << std::endl;
+        munmap(mem, sizeof(state_type));
+        return;
+    }
+
+    if (pid == 0)
+    {
+        ping_pong_responder(state, count);
+        _exit(0);
+    }
+
+    const clock_type::time_point start = clock_type::now();
+    ping_pong_initiator(state, count);
+    const clock_type::time_point end = clock_type::now();
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+
+    state->~state_type();
+    munmap(mem, sizeof(state_type));
+
+    std::cout << name << " process ping-pong round trip: "
+        << chrono::duration_cast< chrono::duration< double, boost::nano > >(end - start).count() / count << " ns" << std::endl;
+}
+#endif // !defined(BOOST_WINDOWS)
+
+//! The state shared between the threads in the thundering herd benchmark
+template< typename Waitable >
+struct herd_state
+{
+    Waitable value;
+    //! The number of threads about to wait in the current round
+    boost::atomic< unsigned int > ready;
+    boost::scoped_array< boost::uint64_t > wake_timestamps;
+
+    explicit herd_state(unsigned int waiter_count) : ready(0u), wake_timestamps(new boost::uint64_t[waiter_count])
+    {
+    }
+};
+
+template< typename Waitable >
+void herd_waiter(herd_state< Waitable >* state, unsigned int index)
+{
+    unsigned int value = 0u;
+    for (unsigned int i = 0u; i < herd_round_count; ++i)
+    {
+        state->ready.fetch_add(1u, boost::memory_order_release);
+        wait_for_change(state->value, value);
+        state->wake_timestamps[index] = timestamp::now();
+        value ^= 1u;
+    }
+}
+
+template< typename Waitable >
+void bench_herd(const char* name, unsigned int waiter_count)
+{
+    herd_state< Waitable > state(waiter_count);
+
+    boost::thread::attributes attrs;
+    attrs.set_stack_size(herd_thread_stack_size);
+
+    boost::thread_group waiters;
+    for (unsigned int i = 0u; i < waiter_count; ++i)
+        waiters.add_thread(new boost::thread(attrs, boost::bind(&herd_waiter< Waitable >, &state, i)));
+
+    std::vector< double > notify_durations, first_wakes, median_wakes, last_wakes;
+    std::vector< boost::uint64_t > wake_timestamps(waiter_count);
+    unsigned int value = 0u;
+    while (state.ready.load(boost::memory_order_acquire) != waiter_count)
+        boost::this_thread::yield();
+
+    for (unsigned int i = 0u; i < herd_round_count; ++i)
+    {
+        // Give the waiting threads time to block
+        boost::this_thread::sleep_for(chrono::milliseconds(1) + chrono::microseconds(10) * waiter_count);
+
+        value ^= 1u;
+        const boost::uint64_t notify_start = timestamp::now();
+        state.value.store(value);
+        state.value.notify_all();
+        const boost::uint64_t notify_end = timestamp::now();
+
+        // Wait until all threads wake up and record the timestamps. Every thread announces waiting in the next round after that.
+        if (i + 1u < herd_round_count)
+        {
+            while (state.ready.load(boost::memory_order_acquire) != waiter_count * (i + 2u))
+                boost::this_thread::yield();
+        }
+        else
+        {
+            waiters.join_all();
+        }
+
+        for (unsigned int j = 0u; j < waiter_count; ++j)
+            wake_timestamps[j] = state.wake_timestamps[j] - notify_start;
+        std::sort(wake_timestamps.begin(), wake_timestamps.end());
+
+        notify_durations.push_back(timestamp::to_ns(notify_end - notify_start));
+        first_wakes.push_back(timestamp::to_ns(wake_timestamps.front()));
+        median_wakes.push_back(timestamp::to_ns(wake_timestamps[waiter_count / 2u]));
+        last_wakes.push_back(timestamp::to_ns(wake_timestamps.back()));
+    }
+
+    std::sort(notify_durations.begin(), notify_durations.end());
+    std::sort(first_wakes.begin(), first_wakes.end());
+    std::sort(median_wakes.begin(), median_wakes.end());
+    std::sort(last_wakes.begin(), last_wakes.end());
+
+    const std::size_t m = herd_round_count / 2u;
+    std::cout << name << " thundering herd, " << std::setw(4) << waiter_count << " waiters: notify_all: " << notify_durations[m]
+        << " ns, first wake: " << first_wakes[m] << " ns, median wake: " << median_wakes[m] << " ns, last wake: " << last_wakes[m]
+        << " ns" << std::endl;
+}
+
+template< typename Waitable >
+void bench_herds(const char* name)
+{
+    static const unsigned int waiter_counts[] = { 1u, 10u, 100u, 1000u };
+    for (std::size_t i = 0u; i < sizeof(waiter_counts) / sizeof(*waiter_counts); ++i)
+        bench_herd< Waitable >(name, waiter_counts[i]);
+}
+
+template< typename Waitable >
+void bench_notify_no_waiters(const char* name)
+{
+    Waitable w;
+
+    clock_type::time_point start = clock_type::now();
+    for (unsigned int i = 0u; i < no_waiters_notify_count; ++i)
+    {
+        w.store(i & 1u);
+        w.notify_one();
+    }
+    clock_type::time_point end = clock_type::now();
+    const double notify_one_ns = chrono::duration_cast< chrono::duration< double, boost::nano > >(end - start).count() / no_waiters_notify_count;
+
+    start = clock_type::now();
+    for (unsigned int i = 0u; i < no_waiters_notify_count; ++i)
+    {
+        w.store(i & 1u);
+        w.notify_all();
+    }
+    end = clock_type::now();
+    const double notify_all_ns = chrono::duration_cast< chrono::duration< double, boost::nano > >(end - start).count() / no_waiters_notify_count;
+
+    std::cout << name << " notify without waiters: store + notify_one: " << notify_one_ns << " ns, store + notify_all: " << notify_all_ns
+        << " ns" << std::endl;
+}
+
+typedef value_waitable< boost::atomic< boost::uint32_t > > atomic32_waitable;
+typedef value_waitable< boost::atomic< boost::uint64_t > > atomic64_waitable;
+typedef flag_waitable< boost::atomic_flag > atomic_flag_waitable;
+typedef value_waitable< boost::ipc_atomic< boost::uint32_t > > ipc_atomic32_waitable;
+typedef value_waitable< boost::ipc_atomic< boost::uint64_t > > ipc_atomic64_waitable;
+typedef flag_waitable< boost::ipc_atomic_flag > ipc_atomic_flag_waitable;
+
+int main()
+{
+    timestamp::calibrate();
+    std::cout << std::fixed << std::setprecision(1) << std::boolalpha;
+
+    bench_latency< atomic32_waitable >("atomic<uint32_t>");
+    bench_latency< atomic64_waitable >("atomic<uint64_t>");
+    bench_latency< atomic_flag_waitable >("atomic_flag");
+#if BOOST_ATOMIC_INT64_LOCK_FREE == 2
+    bench_latency< ipc_atomic64_waitable >("ipc_atomic<uint64_t>");
+#endif
+
+    bench_thread_ping_pong< atomic32_waitable >("atomic<uint32_t>");
+    bench_thread_ping_pong< atomic64_waitable >("atomic<uint64_t>");
+    bench_thread_ping_pong< atomic_flag_waitable >("atomic_flag");
+#if BOOST_ATOMIC_INT64_LOCK_FREE == 2
+    bench_thread_ping_pong< ipc_atomic64_waitable >("ipc_atomic<uint64_t>");
+#endif
+
+#if !defined(BOOST_WINDOWS)
+    // Process-shared objects require lock-free operations
+#if BOOST_ATOMIC_INT32_LOCK_FREE == 2
+    bench_process_ping_pong< ipc_atomic32_waitable >("ipc_atomic<uint32_t>", ping_pong_count);
+#endif
+#if BOOST_ATOMIC_FLAG_LOCK_FREE == 2
+    bench_process_ping_pong< ipc_atomic_flag_waitable >("ipc_atomic_flag", ping_pong_count);
+#endif
+#if BOOST_ATOMIC_INT64_LOCK_FREE == 2
+    // The generic implementation of waiting sleeps between checks of the value, so use fewer iterations
+    bench_process_ping_pong< ipc_atomic64_waitable >("ipc_atomic<uint64_t>", ping_pong_count / 100u);
+#endif
+#endif // !defined(BOOST_WINDOWS)
+
+    bench_notify_no_waiters< atomic32_waitable >("atomic<uint32_t>");
+    bench_notify_no_waiters< atomic64_waitable >("atomic<uint64_t>");
+    bench_notify_no_waiters< atomic_flag_waitable >("atomic_flag");
+
+    bench_herds< atomic32_waitable >("atomic<uint32_t>");
+    bench_herds< atomic64_waitable >("atomic<uint64_t>");
+    bench_herds< atomic_flag_waitable >("atomic_flag");
+
+    return 0;
+}
@@ -0,0 +1,148 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares waiting policies. A notifying thread performs busy work for a given duration, then changes
+// the atomic object and notifies the waiting thread, which waits for the change with the given policy. The benchmark
+// reports the average wake latency, which is the time from the change of the value to the return from the waiting operation,
+// and the CPU time consumed by the waiting thread per wait, where the thread CPU clock is available. The benchmark is run
+// for boost::atomic<uint32_t>, which uses native waiting operations where available, and boost::atomic<uint64_t>, which
+// uses the parking lot when there are no native operations for 64-bit objects.
+//
+// Command line arguments: [round_count]
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/wait_policy.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/chrono/chrono.hpp>
+#include <boost/chrono/thread_clock.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/atomic/detail/pause.hpp>
+
+namespace chrono = boost::chrono;
+
+typedef chrono::steady_clock clock_type;
+
+//! Busy work durations of the notifying thread before notifying, in nanoseconds
+const unsigned int delays_ns[] = { 0u, 1000u, 10000u, 100000u };
+
+struct policy_info
+{
+    boost::atomics::wait_policy policy;
+    const char* name;
+};
+
+const policy_info policies[] =
+{
+    { boost::wait_policy_park, "park" },
+    { boost::wait_policy_spin, "spin" },
+    { boost::wait_policy_adaptive, "adaptive" }
+};
+
+inline boost::uint64_t now_ns()
+{
+    return static_cast< boost::uint64_t >(chrono::duration_cast< chrono::nanoseconds >(clock_type::now().time_since_epoch()).count());
+}
+
+template< typename T >
+struct test_state
+{
+    boost::atomic< T > value;
+    //! The round the waiting thread is about to wait in
+    boost::atomic< unsigned int > ready;
+    //! The time of the change of the value
+    boost::atomic< boost::uint64_t > notify_time;
+    boost::uint64_t total_latency_ns;
+    double waiter_cpu_ns;
+
+    test_state() : value(0u), ready(0u), notify_time(0u), total_latency_ns(0u), waiter_cpu_ns(0.0)
+    {
+    }
+};
+
+template< typename T >
+void waiter_thread(test_state< T >* state, boost::atomics::wait_policy policy, unsigned int round_count)
+{
+#if defined(BOOST_CHRONO_HAS_THREAD_CLOCK)
+    const chrono::thread_clock::time_point cpu_start = chrono::thread_clock::now();
+#endif
+
+    for (unsigned int i = 0u; i < round_count; ++i)
+    {
+        state->ready.store(i + 1u, boost::memory_order_release);
+        T value = static_cast< T >(i);
+        while (value == static_cast< T >(i))
+            value = state->value.wait(value, boost::memory_order_acquire, policy);
+        state->total_latency_ns += now_ns() - state->notify_time.load(boost::memory_order_relaxed);
+    }
+
+#if defined(BOOST_CHRONO_HAS_THREAD_CLOCK)
+    state->waiter_cpu_ns = chrono::duration_cast< chrono::duration< double, boost::nano > >(chrono::thread_clock::now() - cpu_start).count();
+#endif
+}
+
+template< typename T >
+void bench(const char* type_name, policy_info const& policy, unsigned int delay_ns, unsigned int round_count)
+{
+    test_state< T > state;
+    boost::thread waiter(boost::bind(&waiter_thread< T >, &state, policy.policy, round_count));
+
+    for (unsigned int i = 0u; i < round_count; ++i)
+    {
+        while (state.ready.load(boost::memory_order_acquire) != i + 1u)
+            boost::this_thread::yield();
+
+        const boost::uint64_t start = now_ns();
+        while (now_ns() - start < delay_ns)
+            boost::atomics::detail::pause();
+
+        state.notify_time.store(now_ns(), boost::memory_order_relaxed);
+        state.value.store(static_cast< T >(i + 1u), boost::memory_order_release);
+        state.value.notify_one();
+    }
+
+    waiter.join();
+
+    std::cout << std::setw(22) << type_name << std::setw(10) << policy.name << ", notify delay " << std::setw(7) << delay_ns
+        << " ns: wake latency: " << std::setw(10) << static_cast< double >(state.total_latency_ns) / round_count << " ns";
+#if defined(BOOST_CHRONO_HAS_THREAD_CLOCK)
+    std::cout << ", waiter CPU time: " << std::setw(10) << state.waiter_cpu_ns / round_count << " ns/wait";
+#endif
+    std::cout << std::endl;
+}
+
+template< typename T >
+void bench_policies(const char* type_name, unsigned int round_count)
+{
+    for (std::size_t i = 0u; i < sizeof(delays_ns) / sizeof(*delays_ns); ++i)
+    {
+        for (std::size_t j = 0u; j < sizeof(policies) / sizeof(*policies); ++j)
+            bench< T >(type_name, policies[j], delays_ns[i], round_count);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned int round_count = 10000u;
+    if (argc > 1)
+        round_count = static_cast< unsigned int >(std::strtoul(argv[1], NULL, 10));
+    if (round_count < 1u)
+        round_count = 1u;
+
+    std::cout << std::fixed << std::setprecision(1);
+
+    bench_policies< boost::uint32_t >("atomic<uint32_t>", round_count);
+    bench_policies< boost::uint64_t >("atomic<uint64_t>", round_count);
+
+    return 0;
+}
@@ -18,7 +18,26 @@
 #include <boost/atomic/ipc_atomic.hpp>
 #include <boost/atomic/ipc_atomic_ref.hpp>
 #include <boost/atomic/ipc_atomic_flag.hpp>
+#include <boost/atomic/atomic_tagged_ptr.hpp>
+#include <boost/atomic/hazard_pointer.hpp>
+#include <boost/atomic/epoch_domain.hpp>
+#include <boost/atomic/bounded_mpmc_queue.hpp>
+#include <boost/atomic/ipc_spsc_ring.hpp>
+#include <boost/atomic/atomic_bitmap.hpp>
+#include <boost/atomic/kcas.hpp>
+#include <boost/atomic/per_byte_memcpy.hpp>
+#include <boost/atomic/mutex.hpp>
+#include <boost/atomic/condition_variable.hpp>
+#include <boost/atomic/counting_semaphore.hpp>
+#include <boost/atomic/latch.hpp>
+#include <boost/atomic/barrier.hpp>
+#include <boost/atomic/eventcount.hpp>
+#include <boost/atomic/interference_size.hpp>
+#include <boost/atomic/cache_isolated.hpp>
+#include <boost/atomic/asymmetric_fence.hpp>
 #include <boost/atomic/fences.hpp>
+#include <boost/atomic/wait_policy.hpp>
+#include <boost/atomic/notify_batch.hpp>
 
 #ifdef BOOST_HAS_PRAGMA_ONCE
 #pragma once
@@ -0,0 +1,78 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/asymmetric_fence.hpp
+ *
+ * This header contains definition of asymmetric fences.
+ */
+
+#ifndef BOOST_ATOMIC_ASYMMETRIC_FENCE_HPP_INCLUDED_
+#define BOOST_ATOMIC_ASYMMETRIC_FENCE_HPP_INCLUDED_
+
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/asymmetric_fence.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+/*
+ * IMPLEMENTATION NOTE: All interface functions MUST be declared with BOOST_FORCEINLINE,
+ *                      see comment for convert_memory_order_to_gcc in gcc_atomic_memory_order_utils.hpp.
+ */
+
+namespace boost {
+
+namespace atomics {
+
+/*!
+ * \brief Initializes asymmetric fences
+ *
+ * Returns \c true if heavy fences are implemented with a process-wide memory barrier, in which case light fences are compiler barriers.
+ * Initialization is performed implicitly by the first heavy fence, but it may take considerable time, and light fences issued before
+ * initialization are sequentially consistent fences. It is recommended to call this function early in the program.
+ */
+BOOST_FORCEINLINE bool asymmetric_fence_init() BOOST_NOEXCEPT
+{
+    return atomics::detail::asymmetric_fence_init();
+}
+
+/*!
+ * \brief Issues a light asymmetric fence
+ *
+ * The light fence is intended for frequently executed code paths. It synchronizes with heavy fences in other threads
+ * as if both were sequentially consistent fences.
+ */
+BOOST_FORCEINLINE void asymmetric_thread_fence_light() BOOST_NOEXCEPT
+{
+    atomics::detail::asymmetric_thread_fence_light();
+}
+
+/*!
+ * \brief Issues a heavy asymmetric fence
+ *
+ * The heavy fence is intended for rarely executed code paths. It synchronizes with light fences in all threads of the process
+ * as if both were sequentially consistent fences.
+ */
+BOOST_FORCEINLINE void asymmetric_thread_fence_heavy() BOOST_NOEXCEPT
+{
+    atomics::detail::asymmetric_thread_fence_heavy();
+}
+
+} // namespace atomics
+
+using atomics::asymmetric_fence_init;
+using atomics::asymmetric_thread_fence_light;
+using atomics::asymmetric_thread_fence_heavy;
+
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_ASYMMETRIC_FENCE_HPP_INCLUDED_
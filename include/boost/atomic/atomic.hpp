@@ -24,6 +24,7 @@
 #include <boost/atomic/detail/config.hpp>
 #include <boost/atomic/detail/classify.hpp>
 #include <boost/atomic/detail/atomic_impl.hpp>
+#include <boost/atomic/detail/fetch_update.hpp>
 #include <boost/atomic/detail/type_traits/is_trivially_copyable.hpp>
 #include <boost/atomic/detail/header.hpp>
 
@@ -75,6 +76,12 @@ public:
         return this->load();
     }
 
+    template< typename F >
+    BOOST_FORCEINLINE bool fetch_update(F f, value_type& old_val, memory_order order = memory_order_seq_cst) volatile
+    {
+        return atomics::detail::fetch_update< value_type >(*this, &base_type::storage(), f, old_val, order);
+    }
+
     // Deprecated, use value() instead
     BOOST_ATOMIC_DETAIL_STORAGE_DEPRECATED
     BOOST_FORCEINLINE typename base_type::storage_type& storage() BOOST_NOEXCEPT { return base_type::storage(); }
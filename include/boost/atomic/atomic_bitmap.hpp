@@ -0,0 +1,278 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/atomic_bitmap.hpp
+ *
+ * This header contains definition of \c atomic_bitmap, a lock-free bitmap allocator.
+ */
+
+#ifndef BOOST_ATOMIC_ATOMIC_BITMAP_HPP_INCLUDED_
+#define BOOST_ATOMIC_ATOMIC_BITMAP_HPP_INCLUDED_
+
+#include <climits>
+#include <cstddef>
+#include <boost/assert.hpp>
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/intptr.hpp>
+#include <boost/atomic/detail/bit_scan.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+namespace detail {
+
+//! The base class holds the constants of \c atomic_bitmap, so that they can be defined in the header
+template< typename Dummy >
+struct atomic_bitmap_constants
+{
+    typedef std::size_t size_type;
+    typedef std::size_t word_type;
+
+    //! The value returned by \c allocate when there are no free indices
+    static BOOST_CONSTEXPR_OR_CONST size_type npos = ~static_cast< size_type >(0u);
+
+    static BOOST_CONSTEXPR_OR_CONST unsigned int bits_per_word = sizeof(word_type) * CHAR_BIT;
+    static BOOST_CONSTEXPR_OR_CONST word_type full_word = ~static_cast< word_type >(0u);
+    //! Number of words that are tested for being full at once when scanning
+    static BOOST_CONSTEXPR_OR_CONST size_type scan_group_size = 4u;
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+template< typename Dummy >
+BOOST_CONSTEXPR_OR_CONST typename atomic_bitmap_constants< Dummy >::size_type atomic_bitmap_constants< Dummy >::npos;
+template< typename Dummy >
+BOOST_CONSTEXPR_OR_CONST unsigned int atomic_bitmap_constants< Dummy >::bits_per_word;
+template< typename Dummy >
+BOOST_CONSTEXPR_OR_CONST typename atomic_bitmap_constants< Dummy >::word_type atomic_bitmap_constants< Dummy >::full_word;
+template< typename Dummy >
+BOOST_CONSTEXPR_OR_CONST typename atomic_bitmap_constants< Dummy >::size_type atomic_bitmap_constants< Dummy >::scan_group_size;
+#endif
+
+} // namespace detail
+
+/*!
+ * \brief Lock-free bitmap allocator
+ *
+ * The bitmap is an array of atomic words, where every set bit indicates an allocated index. Allocation finds the first clear bit
+ * starting from a hint and sets it with an atomic bit test and set operation. Different threads start scanning from different words
+ * to reduce contention, and fully occupied words are skipped in groups.
+ */
+class atomic_bitmap :
+    public atomics::detail::atomic_bitmap_constants< void >
+{
+private:
+    atomics::atomic< word_type >* m_words;
+    size_type m_word_count;
+    size_type m_size;
+
+public:
+    //! Constructs a bitmap of \a size clear bits. Throws \c std::bad_alloc if memory allocation fails.
+    explicit atomic_bitmap(size_type size) :
+        m_words(NULL),
+        m_word_count((size + (bits_per_word - 1u)) / bits_per_word),
+        m_size(size)
+    {
+        if (m_word_count > 0u)
+        {
+            m_words = new atomics::atomic< word_type >[m_word_count];
+            for (size_type i = 0u; i < m_word_count; ++i)
+                m_words[i].store(0u, memory_order_relaxed);
+
+            // Mark the bits past the end of the bitmap as allocated, so that they are never returned
+            const unsigned int tail_bits = static_cast< unsigned int >(size % bits_per_word);
+            if (tail_bits > 0u)
+                m_words[m_word_count - 1u].store(full_word << tail_bits, memory_order_relaxed);
+        }
+    }
+
+    ~atomic_bitmap()
+    {
+        delete[] m_words;
+    }
+
+    //! Returns the number of bits in the bitmap
+    size_type size() const BOOST_NOEXCEPT
+    {
+        return m_size;
+    }
+
+    /*!
+     * \brief Allocates an index
+     *
+     * Finds a clear bit, sets it and returns its index. Returns \c npos if all bits are set. The search starts at a word
+     * selected based on the calling thread's stack address, which spreads concurrent allocations across the bitmap.
+     */
+    size_type allocate() BOOST_NOEXCEPT
+    {
+        // Threads have distinct stacks, so the address of a local variable is a cheap per-thread hint
+        const char marker = 0;
+        atomics::detail::uintptr_t h = reinterpret_cast< atomics::detail::uintptr_t >(&marker) >> 12u;
+        h *= static_cast< atomics::detail::uintptr_t >(2654435761u);
+        size_type hint = static_cast< size_type >(h);
+        return allocate(hint);
+    }
+
+    /*!
+     * \brief Allocates an index
+     *
+     * Finds a clear bit, starting the search at the word containing bit \a hint, sets it and returns its index.
+     * Returns \c npos if all bits are set. On return, \a hint is updated with the index following the allocated one,
+     * so that a thread that keeps its own hint continues the search where the previous allocation ended.
+     */
+    size_type allocate(size_type& hint) BOOST_NOEXCEPT
+    {
+        if (BOOST_UNLIKELY(m_word_count == 0u))
+            return npos;
+
+        const size_type start = (hint / bits_per_word) % m_word_count;
+        size_type index = scan(start, m_word_count);
+        if (index == npos)
+        {
+            index = scan(0u, start);
+            if (index == npos)
+                return npos;
+        }
+
+        hint = index + 1u;
+        return index;
+    }
+
+    //! Sets the bit with the given index. Returns \c true if the bit was clear, i.e. if the index was allocated by the call.
+    bool try_set(size_type index) BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT(index < m_size);
+        return !m_words[index / bits_per_word].bit_test_and_set(static_cast< unsigned int >(index % bits_per_word), memory_order_acquire);
+    }
+
+    //! Frees the index by clearing the corresponding bit
+    void free(size_type index) BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT(index < m_size);
+        m_words[index / bits_per_word].opaque_and(~(static_cast< word_type >(1u) << (index % bits_per_word)), memory_order_release);
+    }
+
+    /*!
+     * \brief Frees multiple indices
+     *
+     * Consecutive elements of \a indices that refer to the same word are freed with a single atomic operation,
+     * so sorting the indices reduces the number of atomic operations.
+     */
+    void free(const size_type* indices, size_type count) BOOST_NOEXCEPT
+    {
+        size_type i = 0u;
+        while (i < count)
+        {
+            BOOST_ASSERT(indices[i] < m_size);
+            const size_type word_index = indices[i] / bits_per_word;
+            word_type mask = static_cast< word_type >(1u) << (indices[i] % bits_per_word);
+            for (++i; i < count && indices[i] / bits_per_word == word_index; ++i)
+            {
+                BOOST_ASSERT(indices[i] < m_size);
+                mask |= static_cast< word_type >(1u) << (indices[i] % bits_per_word);
+            }
+
+            m_words[word_index].opaque_and(~mask, memory_order_release);
+        }
+    }
+
+    //! Returns \c true if the bit with the given index is set
+    bool test(size_type index) const BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT(index < m_size);
+        return (m_words[index / bits_per_word].load(memory_order_acquire) & (static_cast< word_type >(1u) << (index % bits_per_word))) != 0u;
+    }
+
+    //! Returns the number of set bits. The result may be inaccurate if the bitmap is concurrently modified.
+    size_type count() const BOOST_NOEXCEPT
+    {
+        size_type n = 0u;
+        for (size_type i = 0u; i < m_word_count; ++i)
+        {
+            const word_type w = m_words[i].load(memory_order_relaxed);
+            if (w != 0u)
+                n += atomics::detail::count_set_bits(w);
+        }
+
+        // Exclude the bits past the end of the bitmap
+        return n - (m_word_count * bits_per_word - m_size);
+    }
+
+    BOOST_DELETED_FUNCTION(atomic_bitmap(atomic_bitmap const&))
+    BOOST_DELETED_FUNCTION(atomic_bitmap& operator= (atomic_bitmap const&))
+
+private:
+    //! Searches for a clear bit in words [begin, end) and sets it. Returns the bit index or \c npos if all words are full.
+    size_type scan(size_type begin, size_type end) BOOST_NOEXCEPT
+    {
+        size_type i = begin;
+        while (i < end)
+        {
+            size_type group_end = i + scan_group_size;
+            if (group_end <= end)
+            {
+                // Mostly occupied bitmaps are scanned faster when multiple words are tested with a single branch
+                word_type w = m_words[i].load(memory_order_relaxed);
+                for (size_type j = i + 1u; j < group_end; ++j)
+                    w &= m_words[j].load(memory_order_relaxed);
+
+                if (w == full_word)
+                {
+                    i = group_end;
+                    continue;
+                }
+            }
+            else
+            {
+                group_end = end;
+            }
+
+            for (; i < group_end; ++i)
+            {
+                const size_type index = try_allocate_in_word(i);
+                if (index != npos)
+                    return index;
+            }
+        }
+
+        return npos;
+    }
+
+    //! Sets a clear bit in the given word. Returns the bit index or \c npos if the word is full.
+    size_type try_allocate_in_word(size_type word_index) BOOST_NOEXCEPT
+    {
+        atomics::atomic< word_type >& word = m_words[word_index];
+        word_type w = word.load(memory_order_relaxed);
+        while (w != full_word)
+        {
+            const unsigned int bit = atomics::detail::count_trailing_zeros(~w);
+            if (!word.bit_test_and_set(bit, memory_order_acquire))
+                return word_index * bits_per_word + bit;
+
+            // Another thread has set the bit first
+            w = word.load(memory_order_relaxed);
+        }
+
+        return npos;
+    }
+};
+
+} // namespace atomics
+
+using atomics::atomic_bitmap;
+
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_ATOMIC_BITMAP_HPP_INCLUDED_
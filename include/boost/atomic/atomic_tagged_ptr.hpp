@@ -0,0 +1,231 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/atomic_tagged_ptr.hpp
+ *
+ * This header contains definition of \c atomic_tagged_ptr and \c tagged_ptr templates.
+ */
+
+#ifndef BOOST_ATOMIC_ATOMIC_TAGGED_PTR_HPP_INCLUDED_
+#define BOOST_ATOMIC_ATOMIC_TAGGED_PTR_HPP_INCLUDED_
+
+#include <cstddef>
+#include <boost/assert.hpp>
+#include <boost/memory_order.hpp>
+#include <boost/atomic/capabilities.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/intptr.hpp>
+#include <boost/atomic/detail/aligned_variable.hpp>
+#include <boost/atomic/detail/memory_order_utils.hpp>
+#include <boost/atomic/detail/tagged_ptr_operations.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+
+//! A pointer with an associated tag, which is used to detect ABA conditions
+template< typename T >
+class tagged_ptr
+{
+public:
+    typedef T* pointer;
+    typedef atomics::detail::uintptr_t tag_type;
+
+private:
+    pointer m_ptr;
+    tag_type m_tag;
+
+public:
+    BOOST_CONSTEXPR tagged_ptr() BOOST_NOEXCEPT : m_ptr(NULL), m_tag(0u)
+    {
+    }
+
+    BOOST_CONSTEXPR explicit tagged_ptr(pointer p, tag_type tag = 0u) BOOST_NOEXCEPT : m_ptr(p), m_tag(tag)
+    {
+    }
+
+    BOOST_FORCEINLINE BOOST_CONSTEXPR pointer get_ptr() const BOOST_NOEXCEPT { return m_ptr; }
+    BOOST_FORCEINLINE void set_ptr(pointer p) BOOST_NOEXCEPT { m_ptr = p; }
+    BOOST_FORCEINLINE BOOST_CONSTEXPR tag_type get_tag() const BOOST_NOEXCEPT { return m_tag; }
+    BOOST_FORCEINLINE void set_tag(tag_type tag) BOOST_NOEXCEPT { m_tag = tag; }
+
+    BOOST_FORCEINLINE BOOST_CONSTEXPR pointer operator-> () const BOOST_NOEXCEPT { return m_ptr; }
+
+    friend BOOST_FORCEINLINE BOOST_CONSTEXPR bool operator== (tagged_ptr const& left, tagged_ptr const& right) BOOST_NOEXCEPT
+    {
+        return left.m_ptr == right.m_ptr && left.m_tag == right.m_tag;
+    }
+
+    friend BOOST_FORCEINLINE BOOST_CONSTEXPR bool operator!= (tagged_ptr const& left, tagged_ptr const& right) BOOST_NOEXCEPT
+    {
+        return !(left == right);
+    }
+};
+
+/*!
+ * \brief Atomic pointer with an associated tag
+ *
+ * The pointer and the tag are modified atomically as a whole. Depending on the target, the pair is either stored
+ * in a double-width atomic storage, or the tag is packed into the unused most significant bits of the pointer.
+ * In the latter case only \c tag_bits least significant bits of the tag are preserved.
+ */
+template< typename T >
+class atomic_tagged_ptr
+{
+public:
+    typedef atomics::tagged_ptr< T > value_type;
+    typedef typename value_type::pointer pointer;
+    typedef typename value_type::tag_type tag_type;
+
+private:
+    typedef atomics::detail::default_tagged_ptr_operations operations;
+    typedef operations::core_operations core_operations;
+    typedef operations::storage_type storage_type;
+
+public:
+    static BOOST_CONSTEXPR_OR_CONST bool is_always_lock_free = core_operations::is_always_lock_free;
+    //! Number of least significant bits of the tag that are preserved in the atomic storage
+    static BOOST_CONSTEXPR_OR_CONST unsigned int tag_bits = operations::tag_bits;
+
+private:
+    BOOST_ATOMIC_DETAIL_ALIGNED_VAR_TPL(core_operations::storage_alignment, storage_type, m_storage);
+
+public:
+    BOOST_FORCEINLINE atomic_tagged_ptr() BOOST_NOEXCEPT : m_storage(operations::pack(0u, 0u))
+    {
+    }
+
+    BOOST_FORCEINLINE explicit atomic_tagged_ptr(value_type v) BOOST_NOEXCEPT : m_storage(pack(v))
+    {
+    }
+
+    BOOST_FORCEINLINE explicit atomic_tagged_ptr(pointer p, tag_type tag = 0u) BOOST_NOEXCEPT : m_storage(pack(value_type(p, tag)))
+    {
+    }
+
+    BOOST_FORCEINLINE bool is_lock_free() const volatile BOOST_NOEXCEPT
+    {
+        return is_always_lock_free;
+    }
+
+    BOOST_FORCEINLINE void store(value_type v, memory_order order = memory_order_seq_cst) volatile BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT(order != memory_order_consume);
+        BOOST_ASSERT(order != memory_order_acquire);
+        BOOST_ASSERT(order != memory_order_acq_rel);
+
+        core_operations::store(m_storage, pack(v), order);
+    }
+
+    BOOST_FORCEINLINE value_type load(memory_order order = memory_order_seq_cst) const volatile BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT(order != memory_order_release);
+        BOOST_ASSERT(order != memory_order_acq_rel);
+
+        return unpack(core_operations::load(m_storage, order));
+    }
+
+    BOOST_FORCEINLINE value_type exchange(value_type v, memory_order order = memory_order_seq_cst) volatile BOOST_NOEXCEPT
+    {
+        return unpack(core_operations::exchange(m_storage, pack(v), order));
+    }
+
+    BOOST_FORCEINLINE bool compare_exchange_strong(value_type& expected, value_type desired, memory_order success_order, memory_order failure_order) volatile BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT(failure_order != memory_order_release);
+        BOOST_ASSERT(failure_order != memory_order_acq_rel);
+        BOOST_ASSERT(atomics::detail::cas_failure_order_must_not_be_stronger_than_success_order(success_order, failure_order));
+
+        storage_type old_value = pack(expected);
+        const bool res = core_operations::compare_exchange_strong(m_storage, old_value, pack(desired), success_order, failure_order);
+        expected = unpack(old_value);
+        return res;
+    }
+
+    BOOST_FORCEINLINE bool compare_exchange_strong(value_type& expected, value_type desired, memory_order order = memory_order_seq_cst) volatile BOOST_NOEXCEPT
+    {
+        return compare_exchange_strong(expected, desired, order, atomics::detail::deduce_failure_order(order));
+    }
+
+    BOOST_FORCEINLINE bool compare_exchange_weak(value_type& expected, value_type desired, memory_order success_order, memory_order failure_order) volatile BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT(failure_order != memory_order_release);
+        BOOST_ASSERT(failure_order != memory_order_acq_rel);
+        BOOST_ASSERT(atomics::detail::cas_failure_order_must_not_be_stronger_than_success_order(success_order, failure_order));
+
+        storage_type old_value = pack(expected);
+        const bool res = core_operations::compare_exchange_weak(m_storage, old_value, pack(desired), success_order, failure_order);
+        expected = unpack(old_value);
+        return res;
+    }
+
+    BOOST_FORCEINLINE bool compare_exchange_weak(value_type& expected, value_type desired, memory_order order = memory_order_seq_cst) volatile BOOST_NOEXCEPT
+    {
+        return compare_exchange_weak(expected, desired, order, atomics::detail::deduce_failure_order(order));
+    }
+
+    //! Compares the stored value with \a expected and, if equal, stores \a desired pointer with the tag of \a expected incremented by one
+    BOOST_FORCEINLINE bool compare_exchange_strong(value_type& expected, pointer desired, memory_order success_order, memory_order failure_order) volatile BOOST_NOEXCEPT
+    {
+        return compare_exchange_strong(expected, value_type(desired, expected.get_tag() + 1u), success_order, failure_order);
+    }
+
+    //! Compares the stored value with \a expected and, if equal, stores \a desired pointer with the tag of \a expected incremented by one
+    BOOST_FORCEINLINE bool compare_exchange_strong(value_type& expected, pointer desired, memory_order order = memory_order_seq_cst) volatile BOOST_NOEXCEPT
+    {
+        return compare_exchange_strong(expected, value_type(desired, expected.get_tag() + 1u), order);
+    }
+
+    //! Compares the stored value with \a expected and, if equal, stores \a desired pointer with the tag of \a expected incremented by one
+    BOOST_FORCEINLINE bool compare_exchange_weak(value_type& expected, pointer desired, memory_order success_order, memory_order failure_order) volatile BOOST_NOEXCEPT
+    {
+        return compare_exchange_weak(expected, value_type(desired, expected.get_tag() + 1u), success_order, failure_order);
+    }
+
+    //! Compares the stored value with \a expected and, if equal, stores \a desired pointer with the tag of \a expected incremented by one
+    BOOST_FORCEINLINE bool compare_exchange_weak(value_type& expected, pointer desired, memory_order order = memory_order_seq_cst) volatile BOOST_NOEXCEPT
+    {
+        return compare_exchange_weak(expected, value_type(desired, expected.get_tag() + 1u), order);
+    }
+
+    BOOST_DELETED_FUNCTION(atomic_tagged_ptr(atomic_tagged_ptr const&))
+    BOOST_DELETED_FUNCTION(atomic_tagged_ptr& operator= (atomic_tagged_ptr const&))
+
+private:
+    static BOOST_FORCEINLINE storage_type pack(value_type const& v) BOOST_NOEXCEPT
+    {
+        return operations::pack(reinterpret_cast< atomics::detail::uintptr_t >(v.get_ptr()), v.get_tag());
+    }
+
+    static BOOST_FORCEINLINE value_type unpack(storage_type const& s) BOOST_NOEXCEPT
+    {
+        return value_type(reinterpret_cast< pointer >(operations::get_ptr(s)), operations::get_tag(s));
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+template< typename T >
+BOOST_CONSTEXPR_OR_CONST bool atomic_tagged_ptr< T >::is_always_lock_free;
+template< typename T >
+BOOST_CONSTEXPR_OR_CONST unsigned int atomic_tagged_ptr< T >::tag_bits;
+#endif
+
+} // namespace atomics
+
+using atomics::tagged_ptr;
+using atomics::atomic_tagged_ptr;
+
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_ATOMIC_TAGGED_PTR_HPP_INCLUDED_
@@ -0,0 +1,202 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/barrier.hpp
+ *
+ * This header contains definition of \c barrier, a reusable thread barrier.
+ */
+
+#ifndef BOOST_ATOMIC_BARRIER_HPP_INCLUDED_
+#define BOOST_ATOMIC_BARRIER_HPP_INCLUDED_
+
+#include <cstddef>
+#include <boost/assert.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/wait_policy.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/pause.hpp>
+#include <boost/atomic/detail/sync_spin_count.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+namespace detail {
+
+//! The default completion function of \c barrier, which does nothing
+struct barrier_empty_completion
+{
+    void operator() () const BOOST_NOEXCEPT
+    {
+    }
+};
+
+} // namespace detail
+
+/*!
+ * \brief Reusable thread barrier
+ *
+ * The barrier state is a 32-bit atomic, which consists of the phase number in the upper bits and the number of arrivals pending
+ * in the current phase in the lower bits. Arriving threads decrement the number of pending arrivals, and the last one runs
+ * the completion function and starts the next phase. Waiting threads block on the state with waiting and notifying operations
+ * until the phase number changes. Because the phase number is updated along with the number of pending arrivals,
+ * an arrival always obtains the phase it belongs to.
+ */
+template< typename CompletionFunction = atomics::detail::barrier_empty_completion >
+class barrier
+{
+private:
+    //! Number of bits for the pending arrival count
+    static BOOST_CONSTEXPR_OR_CONST unsigned int count_bits = 24u;
+    static BOOST_CONSTEXPR_OR_CONST boost::uint32_t count_mask = (static_cast< boost::uint32_t >(1u) << count_bits) - 1u;
+
+public:
+    //! The token that identifies the barrier phase in which the thread arrived
+    class arrival_token
+    {
+        friend class barrier;
+
+    private:
+        boost::uint32_t m_phase;
+
+        explicit arrival_token(boost::uint32_t phase) BOOST_NOEXCEPT : m_phase(phase)
+        {
+        }
+    };
+
+private:
+    atomics::atomic< boost::uint32_t > m_state;
+    mutable atomics::atomic< boost::int32_t > m_waiter_count;
+    //! The number of expected arrivals in the next phases, which is decremented by \c arrive_and_drop
+    atomics::atomic< boost::int32_t > m_expected;
+    CompletionFunction m_completion;
+
+public:
+    //! Returns the maximum number of expected arrivals
+    static BOOST_CONSTEXPR std::ptrdiff_t (max)() BOOST_NOEXCEPT
+    {
+        return static_cast< std::ptrdiff_t >(count_mask);
+    }
+
+    //! Initializes the barrier for \a expected arrivals in every phase. \a expected must be in range [0, max()].
+    explicit barrier(std::ptrdiff_t expected, CompletionFunction completion = CompletionFunction()) :
+        m_state(static_cast< boost::uint32_t >(expected)),
+        m_waiter_count(0),
+        m_expected(static_cast< boost::int32_t >(expected)),
+        m_completion(completion)
+    {
+        BOOST_ASSERT(expected >= 0 && expected <= (max)());
+    }
+
+    /*!
+     * \brief Arrives at the barrier
+     *
+     * Decrements the number of pending arrivals in the current phase by \a update. If the number reaches zero, runs the completion
+     * function and starts the next phase. Returns the token that can be passed to \c wait.
+     */
+    arrival_token arrive(std::ptrdiff_t update = 1) BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT(update > 0);
+        const boost::uint32_t prev_state = m_state.fetch_sub(static_cast< boost::uint32_t >(update), boost::memory_order_acq_rel);
+        BOOST_ASSERT((prev_state & count_mask) >= static_cast< boost::uint32_t >(update));
+        if ((prev_state & count_mask) == static_cast< boost::uint32_t >(update))
+            complete_phase(prev_state);
+
+        return arrival_token(prev_state >> count_bits);
+    }
+
+    //! Blocks until the phase identified by \a token completes
+    void wait(arrival_token token) const BOOST_NOEXCEPT
+    {
+        for (unsigned int i = 0u; i < atomics::detail::sync_spin_count; ++i)
+        {
+            if ((m_state.load(boost::memory_order_acquire) >> count_bits) != token.m_phase)
+                return;
+
+            atomics::detail::pause();
+        }
+
+        wait_slow_path(token.m_phase, wait_policy_park);
+    }
+
+    //! Blocks until the phase identified by \a token completes, waiting according to \a policy
+    void wait(arrival_token token, wait_policy policy) const BOOST_NOEXCEPT
+    {
+        if ((m_state.load(boost::memory_order_acquire) >> count_bits) == token.m_phase)
+            wait_slow_path(token.m_phase, policy);
+    }
+
+    //! Arrives at the barrier and blocks until the current phase completes
+    void arrive_and_wait() BOOST_NOEXCEPT
+    {
+        wait(arrive());
+    }
+
+    //! Arrives at the barrier and blocks until the current phase completes, waiting according to \a policy
+    void arrive_and_wait(wait_policy policy) BOOST_NOEXCEPT
+    {
+        wait(arrive(), policy);
+    }
+
+    //! Decrements the number of expected arrivals in the next phases and arrives at the barrier in the current phase
+    void arrive_and_drop() BOOST_NOEXCEPT
+    {
+        m_expected.fetch_sub(1, boost::memory_order_relaxed);
+        arrive();
+    }
+
+    BOOST_DELETED_FUNCTION(barrier(barrier const&))
+    BOOST_DELETED_FUNCTION(barrier& operator= (barrier const&))
+
+private:
+    void complete_phase(boost::uint32_t prev_state) BOOST_NOEXCEPT
+    {
+        m_completion();
+
+        // No other thread can modify the state until the next phase starts. The acquire operation in arrive() synchronizes
+        // with the decrements of the expected count made by arrive_and_drop() before arriving in the completed phase.
+        const boost::uint32_t next_phase = ((prev_state >> count_bits) + 1u) << count_bits;
+        const boost::uint32_t expected = static_cast< boost::uint32_t >(m_expected.load(boost::memory_order_relaxed));
+        // Pairs with the increment of the waiter count in wait_slow_path
+        m_state.store(next_phase | expected, boost::memory_order_seq_cst);
+
+        if (m_waiter_count.load(boost::memory_order_seq_cst) != 0)
+            m_state.notify_all();
+    }
+
+    void wait_slow_path(boost::uint32_t phase, wait_policy policy) const BOOST_NOEXCEPT
+    {
+        m_waiter_count.opaque_add(1, boost::memory_order_seq_cst);
+
+        // The state also changes on arrivals, in which case the thread continues to wait with the updated value
+        boost::uint32_t state = m_state.load(boost::memory_order_seq_cst);
+        while ((state >> count_bits) == phase)
+            state = m_state.wait(state, boost::memory_order_acquire, policy);
+
+        m_waiter_count.opaque_sub(1, boost::memory_order_relaxed);
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+template< typename CompletionFunction >
+BOOST_CONSTEXPR_OR_CONST unsigned int barrier< CompletionFunction >::count_bits;
+template< typename CompletionFunction >
+BOOST_CONSTEXPR_OR_CONST boost::uint32_t barrier< CompletionFunction >::count_mask;
+#endif
+
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_BARRIER_HPP_INCLUDED_
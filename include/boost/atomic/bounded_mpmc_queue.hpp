@@ -0,0 +1,336 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/bounded_mpmc_queue.hpp
+ *
+ * This header contains definition of \c bounded_mpmc_queue, a bounded lock-free multi-producer/multi-consumer queue.
+ */
+
+#ifndef BOOST_ATOMIC_BOUNDED_MPMC_QUEUE_HPP_INCLUDED_
+#define BOOST_ATOMIC_BOUNDED_MPMC_QUEUE_HPP_INCLUDED_
+
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <boost/memory_order.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+#include <boost/type_traits/aligned_storage.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/fences.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/intptr.hpp>
+#include <boost/atomic/detail/cache_line_size.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+
+/*!
+ * \brief Bounded lock-free multi-producer/multi-consumer queue
+ *
+ * The queue is a ring buffer of cells, each marked with a sequence number, which indicates whether the cell is ready
+ * to be written by a producer or read by a consumer at the given position. Producers and consumers only contend
+ * on the enqueue and dequeue positions, respectively, and on the cells they access. Each cell occupies a whole number of cache lines.
+ *
+ * Blocking operations use \c atomic<>::wait and \c atomic<>::notify_all on the cell sequence numbers. Producers and consumers
+ * only issue notifications when there are threads blocked in the opposite operation.
+ *
+ * The copy and move constructors, assignment operators and the destructor of \c T must not throw.
+ */
+template< typename T >
+class bounded_mpmc_queue
+{
+public:
+    typedef T value_type;
+    typedef std::size_t size_type;
+
+private:
+    //! Queue cell
+    struct BOOST_ALIGNMENT(BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE) cell
+    {
+        //! Sequence number. Equals to the position for which the cell can be written, or to the position plus one if the cell can be read.
+        atomics::atomic< size_type > m_sequence;
+        //! Storage for the element
+        typename boost::aligned_storage< sizeof(T), boost::alignment_of< T >::value >::type m_storage;
+
+        T* value() BOOST_NOEXCEPT
+        {
+            return static_cast< T* >(static_cast< void* >(&m_storage));
+        }
+    };
+
+private:
+    //! Pointer to the allocated memory block
+    void* m_block;
+    //! Pointer to the first cell
+    cell* m_cells;
+    //! Index mask, equals to the capacity minus one
+    size_type m_mask;
+
+    // The padding separates the immutable members above from the positions, which are frequently modified
+    char m_padding1[BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE];
+    //! Position of the next element to push
+    atomics::atomic< size_type > m_enqueue_pos;
+    char m_padding2[BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE];
+    //! Position of the next element to pop
+    atomics::atomic< size_type > m_dequeue_pos;
+    char m_padding3[BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE];
+    //! Number of producers blocked in \c push_wait
+    atomics::atomic< unsigned int > m_push_waiters;
+    //! Number of consumers blocked in \c pop_wait
+    atomics::atomic< unsigned int > m_pop_waiters;
+
+public:
+    /*!
+     * \brief Constructs an empty queue
+     *
+     * The capacity is rounded up to the nearest power of two, but not less than 2. Throws \c std::length_error if the rounded capacity
+     * exceeds the maximum size of the memory block for the elements, or \c std::bad_alloc if memory allocation fails.
+     */
+    explicit bounded_mpmc_queue(size_type capacity) : m_enqueue_pos(0u), m_dequeue_pos(0u), m_push_waiters(0u), m_pop_waiters(0u)
+    {
+        // Since a cell is larger than one byte, the maximum number of cells is less than half the range of size_type,
+        // so rounding up the capacity does not overflow after the first check
+        const size_type max_size = (~static_cast< size_type >(0u) - (BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE - 1u)) / sizeof(cell);
+        if (BOOST_UNLIKELY(capacity > max_size))
+            boost::throw_exception(std::length_error("Boost.Atomic: bounded_mpmc_queue capacity is too large"));
+
+        size_type size = 2u;
+        while (size < capacity)
+            size <<= 1u;
+
+        if (BOOST_UNLIKELY(size > max_size))
+            boost::throw_exception(std::length_error("Boost.Atomic: bounded_mpmc_queue capacity is too large"));
+
+        m_block = ::operator new(size * sizeof(cell) + BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE - 1u);
+        const atomics::detail::uintptr_t addr = (reinterpret_cast< atomics::detail::uintptr_t >(m_block) + (BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE - 1u)) &
+            ~static_cast< atomics::detail::uintptr_t >(BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE - 1u);
+        m_cells = reinterpret_cast< cell* >(addr);
+        m_mask = size - 1u;
+
+        for (size_type i = 0u; i < size; ++i)
+        {
+            cell* c = new (m_cells + i) cell;
+            c->m_sequence.store(i, memory_order_relaxed);
+        }
+    }
+
+    //! Destroys the elements remaining in the queue. No threads must be accessing the queue at this point.
+    ~bounded_mpmc_queue()
+    {
+        const size_type end = m_enqueue_pos.load(memory_order_relaxed);
+        for (size_type pos = m_dequeue_pos.load(memory_order_relaxed); pos != end; ++pos)
+        {
+            cell& c = m_cells[pos & m_mask];
+            if (c.m_sequence.load(memory_order_relaxed) == pos + 1u)
+                c.value()->~T();
+        }
+
+        for (size_type i = 0u; i <= m_mask; ++i)
+            m_cells[i].~cell();
+
+        ::operator delete(m_block);
+    }
+
+    //! Returns the maximum number of elements the queue can hold
+    size_type capacity() const BOOST_NOEXCEPT
+    {
+        return m_mask + 1u;
+    }
+
+    //! Pushes an element to the queue. Returns \c false if the queue is full.
+    bool try_push(T const& value) BOOST_NOEXCEPT
+    {
+        size_type pos;
+        cell* c = acquire_push_cell(pos);
+        if (!c)
+            return false;
+
+        new (c->value()) T(value);
+        publish_push_cell(c, pos);
+        return true;
+    }
+
+    //! Pushes an element to the queue. Blocks while the queue is full.
+    void push_wait(T const& value) BOOST_NOEXCEPT
+    {
+        while (!try_push(value))
+            wait_not_full();
+    }
+
+#if !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    //! Pushes an element to the queue. Returns \c false if the queue is full, in which case \a value is not modified.
+    bool try_push(T&& value) BOOST_NOEXCEPT
+    {
+        size_type pos;
+        cell* c = acquire_push_cell(pos);
+        if (!c)
+            return false;
+
+        new (c->value()) T(static_cast< T&& >(value));
+        publish_push_cell(c, pos);
+        return true;
+    }
+
+    //! Pushes an element to the queue. Blocks while the queue is full.
+    void push_wait(T&& value) BOOST_NOEXCEPT
+    {
+        while (!try_push(static_cast< T&& >(value)))
+            wait_not_full();
+    }
+#endif // !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+
+    //! Pops an element from the queue. Returns \c false if the queue is empty.
+    bool try_pop(T& value) BOOST_NOEXCEPT
+    {
+        size_type pos;
+        cell* c = acquire_pop_cell(pos);
+        if (!c)
+            return false;
+
+        T* p = c->value();
+#if !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+        value = static_cast< T&& >(*p);
+#else
+        value = *p;
+#endif
+        p->~T();
+        release_pop_cell(c, pos);
+        return true;
+    }
+
+    //! Pops an element from the queue. Blocks while the queue is empty.
+    void pop_wait(T& value) BOOST_NOEXCEPT
+    {
+        while (!try_pop(value))
+            wait_not_empty();
+    }
+
+    BOOST_DELETED_FUNCTION(bounded_mpmc_queue(bounded_mpmc_queue const&))
+    BOOST_DELETED_FUNCTION(bounded_mpmc_queue& operator= (bounded_mpmc_queue const&))
+
+private:
+    //! Claims a cell for pushing an element. Returns \c NULL if the queue is full.
+    cell* acquire_push_cell(size_type& pos) BOOST_NOEXCEPT
+    {
+        pos = m_enqueue_pos.load(memory_order_relaxed);
+        while (true)
+        {
+            cell* c = m_cells + (pos & m_mask);
+            const size_type seq = c->m_sequence.load(memory_order_acquire);
+            const std::ptrdiff_t diff = static_cast< std::ptrdiff_t >(seq - pos);
+            if (diff == 0)
+            {
+                if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1u, memory_order_relaxed, memory_order_relaxed))
+                    return c;
+            }
+            else if (diff < 0)
+            {
+                // The cell still contains the element pushed one lap ago
+                return NULL;
+            }
+            else
+            {
+                pos = m_enqueue_pos.load(memory_order_relaxed);
+            }
+        }
+    }
+
+    //! Makes the pushed element available to consumers
+    void publish_push_cell(cell* c, size_type pos) BOOST_NOEXCEPT
+    {
+        c->m_sequence.store(pos + 1u, memory_order_release);
+        // Order the store above before the load below. Pairs with the fence in wait_not_empty.
+        atomics::atomic_thread_fence(memory_order_seq_cst);
+        if (BOOST_UNLIKELY(m_pop_waiters.load(memory_order_relaxed) != 0u))
+            c->m_sequence.notify_all();
+    }
+
+    //! Claims a cell for popping an element. Returns \c NULL if the queue is empty.
+    cell* acquire_pop_cell(size_type& pos) BOOST_NOEXCEPT
+    {
+        pos = m_dequeue_pos.load(memory_order_relaxed);
+        while (true)
+        {
+            cell* c = m_cells + (pos & m_mask);
+            const size_type seq = c->m_sequence.load(memory_order_acquire);
+            const std::ptrdiff_t diff = static_cast< std::ptrdiff_t >(seq - (pos + 1u));
+            if (diff == 0)
+            {
+                if (m_dequeue_pos.compare_exchange_weak(pos, pos + 1u, memory_order_relaxed, memory_order_relaxed))
+                    return c;
+            }
+            else if (diff < 0)
+            {
+                // The cell has not been written yet
+                return NULL;
+            }
+            else
+            {
+                pos = m_dequeue_pos.load(memory_order_relaxed);
+            }
+        }
+    }
+
+    //! Makes the cell available to producers on the next lap
+    void release_pop_cell(cell* c, size_type pos) BOOST_NOEXCEPT
+    {
+        c->m_sequence.store(pos + m_mask + 1u, memory_order_release);
+        // Order the store above before the load below. Pairs with the fence in wait_not_full.
+        atomics::atomic_thread_fence(memory_order_seq_cst);
+        if (BOOST_UNLIKELY(m_push_waiters.load(memory_order_relaxed) != 0u))
+            c->m_sequence.notify_all();
+    }
+
+    //! Blocks until the cell at the current enqueue position is released by a consumer
+    void wait_not_full() BOOST_NOEXCEPT
+    {
+        const size_type pos = m_enqueue_pos.load(memory_order_relaxed);
+        cell* c = m_cells + (pos & m_mask);
+        const size_type seq = c->m_sequence.load(memory_order_relaxed);
+        if (static_cast< std::ptrdiff_t >(seq - pos) >= 0)
+            return;
+
+        m_push_waiters.fetch_add(1u, memory_order_relaxed);
+        // Order the increment above before the load in wait. Pairs with the fence in release_pop_cell.
+        atomics::atomic_thread_fence(memory_order_seq_cst);
+        c->m_sequence.wait(seq, memory_order_relaxed);
+        m_push_waiters.fetch_sub(1u, memory_order_relaxed);
+    }
+
+    //! Blocks until the cell at the current dequeue position is written by a producer
+    void wait_not_empty() BOOST_NOEXCEPT
+    {
+        const size_type pos = m_dequeue_pos.load(memory_order_relaxed);
+        cell* c = m_cells + (pos & m_mask);
+        const size_type seq = c->m_sequence.load(memory_order_relaxed);
+        if (static_cast< std::ptrdiff_t >(seq - (pos + 1u)) >= 0)
+            return;
+
+        m_pop_waiters.fetch_add(1u, memory_order_relaxed);
+        // Order the increment above before the load in wait. Pairs with the fence in publish_push_cell.
+        atomics::atomic_thread_fence(memory_order_seq_cst);
+        c->m_sequence.wait(seq, memory_order_relaxed);
+        m_pop_waiters.fetch_sub(1u, memory_order_relaxed);
+    }
+};
+
+} // namespace atomics
+
+using atomics::bounded_mpmc_queue;
+
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_BOUNDED_MPMC_QUEUE_HPP_INCLUDED_
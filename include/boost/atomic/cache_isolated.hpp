@@ -0,0 +1,110 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/cache_isolated.hpp
+ *
+ * This header contains definition of \c cache_isolated and \c padded_atomic wrappers, which avoid false sharing.
+ */
+
+#ifndef BOOST_ATOMIC_CACHE_ISOLATED_HPP_INCLUDED_
+#define BOOST_ATOMIC_CACHE_ISOLATED_HPP_INCLUDED_
+
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/interference_size.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+
+/*!
+ * \brief Wrapper that places an object in its own cache lines
+ *
+ * The wrapper is aligned to \c BOOST_ATOMIC_DESTRUCTIVE_INTERFERENCE_SIZE, and its size is a multiple of the alignment,
+ * so no other object shares cache lines with the wrapped object. Note that before C++17 dynamic allocation of the wrapper
+ * with operator new may not respect the alignment.
+ */
+template< typename T >
+class BOOST_ALIGNMENT(BOOST_ATOMIC_DESTRUCTIVE_INTERFERENCE_SIZE) cache_isolated
+{
+public:
+    typedef T value_type;
+
+private:
+    value_type m_value;
+
+public:
+    cache_isolated() : m_value()
+    {
+    }
+
+    template< typename Arg >
+    explicit cache_isolated(Arg const& arg) : m_value(arg)
+    {
+    }
+
+    value_type& get() BOOST_NOEXCEPT { return m_value; }
+    value_type const& get() const BOOST_NOEXCEPT { return m_value; }
+
+    value_type& operator* () BOOST_NOEXCEPT { return m_value; }
+    value_type const& operator* () const BOOST_NOEXCEPT { return m_value; }
+
+    value_type* operator-> () BOOST_NOEXCEPT { return &m_value; }
+    value_type const* operator-> () const BOOST_NOEXCEPT { return &m_value; }
+};
+
+/*!
+ * \brief Atomic object that occupies its own cache lines
+ *
+ * The class has the same interface as \c atomic and the same alignment and size guarantees as \c cache_isolated.
+ */
+template< typename T >
+class BOOST_ALIGNMENT(BOOST_ATOMIC_DESTRUCTIVE_INTERFERENCE_SIZE) padded_atomic :
+    public atomics::atomic< T >
+{
+private:
+    typedef atomics::atomic< T > base_type;
+
+public:
+    typedef typename base_type::value_type value_type;
+
+public:
+    BOOST_DEFAULTED_FUNCTION(padded_atomic() BOOST_ATOMIC_DETAIL_DEF_NOEXCEPT_DECL, BOOST_ATOMIC_DETAIL_DEF_NOEXCEPT_IMPL {})
+    BOOST_FORCEINLINE BOOST_ATOMIC_DETAIL_CONSTEXPR_UNION_INIT padded_atomic(value_type v) BOOST_NOEXCEPT : base_type(v) {}
+
+    BOOST_FORCEINLINE value_type operator= (value_type v) BOOST_NOEXCEPT
+    {
+        this->store(v);
+        return v;
+    }
+
+    BOOST_FORCEINLINE value_type operator= (value_type v) volatile BOOST_NOEXCEPT
+    {
+        this->store(v);
+        return v;
+    }
+
+    BOOST_DELETED_FUNCTION(padded_atomic(padded_atomic const&))
+    BOOST_DELETED_FUNCTION(padded_atomic& operator= (padded_atomic const&))
+    BOOST_DELETED_FUNCTION(padded_atomic& operator= (padded_atomic const&) volatile)
+};
+
+} // namespace atomics
+
+using atomics::cache_isolated;
+using atomics::padded_atomic;
+
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_CACHE_ISOLATED_HPP_INCLUDED_
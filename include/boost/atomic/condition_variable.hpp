@@ -0,0 +1,143 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/condition_variable.hpp
+ *
+ * This header contains definition of \c condition_variable and \c ipc_condition_variable, compact condition variables based on futexes.
+ */
+
+#ifndef BOOST_ATOMIC_CONDITION_VARIABLE_HPP_INCLUDED_
+#define BOOST_ATOMIC_CONDITION_VARIABLE_HPP_INCLUDED_
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/mutex.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/intptr.hpp>
+#include <boost/atomic/detail/core_operations.hpp>
+#include <boost/atomic/detail/aligned_variable.hpp>
+#include <boost/atomic/detail/mutex_operations.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+
+/*!
+ * \brief A compact condition variable
+ *
+ * The condition variable can only be used with \c basic_mutex with the same \a Interprocess template argument.
+ * When futexes are supported, notifying operations move the blocked threads to the mutex instead of waking them up,
+ * which avoids the blocked threads being woken up only to block again on the mutex. Notifying operations can be
+ * called with or without the mutex locked.
+ *
+ * The condition variable refers to the mutex by its offset relative to the condition variable, so that an \c ipc_condition_variable
+ * and an \c ipc_mutex placed in the same shared memory segment can be used by processes that map the segment at different addresses.
+ */
+template< bool Interprocess >
+class basic_condition_variable
+{
+public:
+    typedef basic_mutex< Interprocess > mutex_type;
+
+private:
+    typedef atomics::detail::mutex_operations< Interprocess > operations;
+    typedef typename operations::storage_type storage_type;
+    typedef atomics::detail::core_operations< sizeof(atomics::detail::intptr_t), true, Interprocess > offset_operations;
+    typedef typename offset_operations::storage_type offset_storage_type;
+
+public:
+    static BOOST_CONSTEXPR_OR_CONST bool is_always_lock_free = operations::is_always_lock_free && offset_operations::is_always_lock_free;
+
+private:
+    //! Notification counter, which is also the futex the blocked threads wait on
+    BOOST_ATOMIC_DETAIL_ALIGNED_VAR_TPL(operations::core_operations::storage_alignment, storage_type, m_cond);
+    //! Number of blocked threads
+    BOOST_ATOMIC_DETAIL_ALIGNED_VAR_TPL(operations::core_operations::storage_alignment, storage_type, m_waiter_count);
+    //! Offset of the mutex used by the blocked threads relative to the condition variable, or 0 if not known
+    BOOST_ATOMIC_DETAIL_ALIGNED_VAR_TPL(offset_operations::storage_alignment, offset_storage_type, m_mutex_offset);
+
+public:
+    BOOST_FORCEINLINE BOOST_ATOMIC_DETAIL_CONSTEXPR_UNION_INIT basic_condition_variable() BOOST_NOEXCEPT : m_cond(0u), m_waiter_count(0u), m_mutex_offset(0)
+    {
+    }
+
+    /*!
+     * \brief Blocks until notified
+     *
+     * \a lock must be a lock object, such as <tt>std::unique_lock< mutex_type ></tt> or <tt>boost::unique_lock< mutex_type ></tt>, that has locked the mutex.
+     * The mutex is unlocked while the thread is blocked and is locked again before returning. The function may return spuriously.
+     * All threads waiting on the condition variable concurrently must use the same mutex.
+     */
+    template< typename Lock >
+    BOOST_FORCEINLINE void wait(Lock& lock) BOOST_NOEXCEPT
+    {
+        mutex_type& m = *lock.mutex();
+        offset_operations::store(m_mutex_offset, compute_offset(m), boost::memory_order_relaxed);
+        operations::wait(m_cond, m_waiter_count, m.m_state);
+    }
+
+    //! Blocks until \a pred returns \c true. Equivalent to <tt>while (!pred()) wait(lock);</tt>.
+    template< typename Lock, typename Predicate >
+    BOOST_FORCEINLINE void wait(Lock& lock, Predicate pred)
+    {
+        while (!pred())
+            wait(lock);
+    }
+
+    //! Wakes up one thread blocked on the condition variable
+    BOOST_FORCEINLINE void notify_one() BOOST_NOEXCEPT
+    {
+        operations::notify(m_cond, m_waiter_count, get_mutex_state(), false);
+    }
+
+    //! Wakes up all threads blocked on the condition variable
+    BOOST_FORCEINLINE void notify_all() BOOST_NOEXCEPT
+    {
+        operations::notify(m_cond, m_waiter_count, get_mutex_state(), true);
+    }
+
+    BOOST_DELETED_FUNCTION(basic_condition_variable(basic_condition_variable const&))
+    BOOST_DELETED_FUNCTION(basic_condition_variable& operator= (basic_condition_variable const&))
+
+private:
+    BOOST_FORCEINLINE offset_storage_type compute_offset(mutex_type& m) const BOOST_NOEXCEPT
+    {
+        return static_cast< offset_storage_type >(reinterpret_cast< atomics::detail::uintptr_t >(&m) - reinterpret_cast< atomics::detail::uintptr_t >(this));
+    }
+
+    BOOST_FORCEINLINE storage_type volatile* get_mutex_state() BOOST_NOEXCEPT
+    {
+        // If the offset is not yet visible, notify() wakes up the blocked threads directly instead of moving them to the mutex, which is also correct
+        const offset_storage_type offset = offset_operations::load(m_mutex_offset, boost::memory_order_relaxed);
+        if (offset == 0)
+            return NULL;
+
+        mutex_type* m = reinterpret_cast< mutex_type* >(reinterpret_cast< atomics::detail::uintptr_t >(this) + static_cast< atomics::detail::uintptr_t >(offset));
+        return &m->m_state;
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+template< bool Interprocess >
+BOOST_CONSTEXPR_OR_CONST bool basic_condition_variable< Interprocess >::is_always_lock_free;
+#endif
+
+//! Condition variable for synchronizing threads within a process
+typedef basic_condition_variable< false > condition_variable;
+//! Condition variable for synchronizing threads in different processes
+typedef basic_condition_variable< true > ipc_condition_variable;
+
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_CONDITION_VARIABLE_HPP_INCLUDED_
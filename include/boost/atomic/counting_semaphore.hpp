@@ -0,0 +1,151 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/counting_semaphore.hpp
+ *
+ * This header contains definition of \c counting_semaphore and \c binary_semaphore.
+ */
+
+#ifndef BOOST_ATOMIC_COUNTING_SEMAPHORE_HPP_INCLUDED_
+#define BOOST_ATOMIC_COUNTING_SEMAPHORE_HPP_INCLUDED_
+
+#include <cstddef>
+#include <boost/assert.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/wait_policy.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/pause.hpp>
+#include <boost/atomic/detail/sync_spin_count.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+
+/*!
+ * \brief Counting semaphore
+ *
+ * The semaphore is implemented on top of waiting and notifying operations of a 32-bit atomic counter. The number of blocked threads
+ * is tracked separately, so that \c release does not issue a notifying operation when there are no blocked threads.
+ */
+template< std::ptrdiff_t LeastMaxValue = 0x7FFFFFFF >
+class counting_semaphore
+{
+    BOOST_STATIC_ASSERT_MSG(LeastMaxValue >= 0 && LeastMaxValue <= 0x7FFFFFFF, "Boost.Atomic: counting_semaphore maximum value must be in range [0, 2^31-1]");
+
+private:
+    atomics::atomic< boost::int32_t > m_count;
+    atomics::atomic< boost::int32_t > m_waiter_count;
+
+public:
+    //! Returns the maximum value of the counter
+    static BOOST_CONSTEXPR std::ptrdiff_t (max)() BOOST_NOEXCEPT
+    {
+        return LeastMaxValue;
+    }
+
+    //! Initializes the counter with \a desired, which must be in range [0, max()]
+    explicit counting_semaphore(std::ptrdiff_t desired) BOOST_NOEXCEPT :
+        m_count(static_cast< boost::int32_t >(desired)),
+        m_waiter_count(0)
+    {
+        BOOST_ASSERT(desired >= 0 && desired <= LeastMaxValue);
+    }
+
+    //! Increments the counter by \a update and unblocks threads waiting for the counter to become positive
+    void release(std::ptrdiff_t update = 1) BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT(update >= 0);
+        // Pairs with the increment of the waiter count in acquire_slow_path
+        const boost::int32_t prev_count = m_count.fetch_add(static_cast< boost::int32_t >(update), boost::memory_order_seq_cst);
+        BOOST_ASSERT(prev_count <= LeastMaxValue - update);
+        (void)prev_count;
+
+        if (m_waiter_count.load(boost::memory_order_seq_cst) != 0)
+        {
+            if (update == 1)
+                m_count.notify_one();
+            else
+                m_count.notify_all();
+        }
+    }
+
+    //! Decrements the counter, if it is positive. Returns \c true if the counter was decremented.
+    bool try_acquire() BOOST_NOEXCEPT
+    {
+        boost::int32_t count = m_count.load(boost::memory_order_relaxed);
+        while (count > 0)
+        {
+            if (m_count.compare_exchange_weak(count, count - 1, boost::memory_order_acquire, boost::memory_order_relaxed))
+                return true;
+        }
+
+        return false;
+    }
+
+    //! Decrements the counter, blocking while it is zero
+    void acquire() BOOST_NOEXCEPT
+    {
+        for (unsigned int i = 0u; i < atomics::detail::sync_spin_count; ++i)
+        {
+            if (try_acquire())
+                return;
+
+            atomics::detail::pause();
+        }
+
+        acquire_slow_path(wait_policy_park);
+    }
+
+    //! Decrements the counter, blocking while it is zero and waiting according to \a policy
+    void acquire(wait_policy policy) BOOST_NOEXCEPT
+    {
+        if (!try_acquire())
+            acquire_slow_path(policy);
+    }
+
+    BOOST_DELETED_FUNCTION(counting_semaphore(counting_semaphore const&))
+    BOOST_DELETED_FUNCTION(counting_semaphore& operator= (counting_semaphore const&))
+
+private:
+    void acquire_slow_path(wait_policy policy) BOOST_NOEXCEPT
+    {
+        m_waiter_count.opaque_add(1, boost::memory_order_seq_cst);
+
+        while (true)
+        {
+            boost::int32_t count = m_count.load(boost::memory_order_seq_cst);
+            while (count > 0)
+            {
+                if (m_count.compare_exchange_weak(count, count - 1, boost::memory_order_acquire, boost::memory_order_relaxed))
+                {
+                    m_waiter_count.opaque_sub(1, boost::memory_order_relaxed);
+                    return;
+                }
+            }
+
+            m_count.wait(0, boost::memory_order_relaxed, policy);
+        }
+    }
+};
+
+//! Semaphore with the maximum counter value of 1
+typedef counting_semaphore< 1 > binary_semaphore;
+
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_COUNTING_SEMAPHORE_HPP_INCLUDED_
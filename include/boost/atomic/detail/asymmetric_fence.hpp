@@ -0,0 +1,73 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/detail/asymmetric_fence.hpp
+ *
+ * This header contains declaration of asymmetric fences. An asymmetric fence pair consists of a light fence,
+ * which is issued on a frequently executed code path, and a heavy fence, which is issued on a rarely executed path.
+ * The heavy fence synchronizes with light fences in all threads of the process as if both were sequentially consistent fences.
+ */
+
+#ifndef BOOST_ATOMIC_DETAIL_ASYMMETRIC_FENCE_HPP_INCLUDED_
+#define BOOST_ATOMIC_DETAIL_ASYMMETRIC_FENCE_HPP_INCLUDED_
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/link.hpp>
+#include <boost/atomic/detail/once_flag.hpp>
+#include <boost/atomic/detail/fence_operations.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+namespace detail {
+
+//! Asymmetric fences state
+enum asymmetric_fence_state
+{
+    asymmetric_fence_uninitialized = 0u,
+    asymmetric_fence_native = 1u,
+    asymmetric_fence_emulated = 2u
+};
+
+//! The state of asymmetric fences, one of \c asymmetric_fence_state values
+extern BOOST_ATOMIC_DECL once_flag g_asymmetric_fence_state;
+
+//! Initializes asymmetric fences. Returns \c true if the heavy fence is implemented with a process-wide memory barrier, in which case light fences may be reduced to compiler barriers.
+BOOST_ATOMIC_DECL bool asymmetric_fence_init() BOOST_NOEXCEPT;
+//! Issues a heavy fence
+BOOST_ATOMIC_DECL void asymmetric_thread_fence_heavy() BOOST_NOEXCEPT;
+
+//! Issues a light fence. \a native must be the result of \c asymmetric_fence_init.
+BOOST_FORCEINLINE void asymmetric_thread_fence_light(bool native) BOOST_NOEXCEPT
+{
+    if (BOOST_LIKELY(native))
+        atomics::detail::fence_operations::signal_fence(memory_order_seq_cst);
+    else
+        atomics::detail::fence_operations::thread_fence(memory_order_seq_cst);
+}
+
+//! Issues a light fence. If asymmetric fences have not been initialized yet, issues a sequentially consistent fence.
+BOOST_FORCEINLINE void asymmetric_thread_fence_light() BOOST_NOEXCEPT
+{
+    // The state only changes from uninitialized once, and heavy fences are native after the state is set to native,
+    // so a relaxed load is enough. A full fence is always compatible with heavy fences.
+    atomics::detail::asymmetric_thread_fence_light(once_flag_operations::load(g_asymmetric_fence_state.m_flag, memory_order_relaxed) == asymmetric_fence_native);
+}
+
+} // namespace detail
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_DETAIL_ASYMMETRIC_FENCE_HPP_INCLUDED_
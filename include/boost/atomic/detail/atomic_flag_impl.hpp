@@ -16,11 +16,13 @@
 #ifndef BOOST_ATOMIC_DETAIL_ATOMIC_FLAG_IMPL_HPP_INCLUDED_
 #define BOOST_ATOMIC_DETAIL_ATOMIC_FLAG_IMPL_HPP_INCLUDED_
 
+#include <cstddef>
 #include <boost/assert.hpp>
 #include <boost/memory_order.hpp>
 #include <boost/atomic/detail/config.hpp>
 #include <boost/atomic/detail/core_operations.hpp>
 #include <boost/atomic/detail/wait_operations.hpp>
+#include <boost/atomic/detail/policy_wait.hpp>
 #include <boost/atomic/detail/aligned_variable.hpp>
 #include <boost/atomic/detail/header.hpp>
 
@@ -91,12 +93,12 @@ struct atomic_flag_impl
         core_operations::clear(m_storage, order);
     }
 
-    BOOST_FORCEINLINE bool wait(bool old_val, memory_order order = memory_order_seq_cst) const volatile BOOST_NOEXCEPT
+    BOOST_FORCEINLINE bool wait(bool old_val, memory_order order = memory_order_seq_cst, wait_policy policy = wait_policy_park) const volatile BOOST_NOEXCEPT
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
-        return !!wait_operations::wait(m_storage, static_cast< storage_type >(old_val), order);
+        return !!atomics::detail::policy_wait< wait_operations >(m_storage, static_cast< storage_type >(old_val), order, policy);
     }
 
     BOOST_FORCEINLINE void notify_one() volatile BOOST_NOEXCEPT
@@ -111,6 +113,15 @@ struct atomic_flag_impl
 
     BOOST_DELETED_FUNCTION(atomic_flag_impl(atomic_flag_impl const&))
     BOOST_DELETED_FUNCTION(atomic_flag_impl& operator= (atomic_flag_impl const&))
+
+private:
+    friend class atomics::notify_batch;
+
+    //! Unblocks up to \a count threads waiting on the flag
+    BOOST_FORCEINLINE void notify_n(std::size_t count) volatile BOOST_NOEXCEPT
+    {
+        wait_operations::notify_n(m_storage, count);
+    }
 };
 
 #if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
@@ -26,6 +26,7 @@
 #include <boost/atomic/detail/integral_conversions.hpp>
 #include <boost/atomic/detail/core_operations.hpp>
 #include <boost/atomic/detail/wait_operations.hpp>
+#include <boost/atomic/detail/policy_wait.hpp>
 #include <boost/atomic/detail/extra_operations.hpp>
 #include <boost/atomic/detail/memory_order_utils.hpp>
 #include <boost/atomic/detail/aligned_variable.hpp>
@@ -115,6 +116,15 @@ public:
     {
         wait_operations::notify_all(this->storage());
     }
+
+private:
+    friend class atomics::notify_batch;
+
+    //! Unblocks up to \a count threads waiting on the object
+    BOOST_FORCEINLINE void notify_n(std::size_t count) volatile BOOST_NOEXCEPT
+    {
+        wait_operations::notify_n(this->storage(), count);
+    }
 };
 
 #if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
@@ -246,12 +256,12 @@ public:
         return compare_exchange_weak(expected, desired, order, atomics::detail::deduce_failure_order(order));
     }
 
-    BOOST_FORCEINLINE value_type wait(value_arg_type old_val, memory_order order = memory_order_seq_cst) const volatile BOOST_NOEXCEPT
+    BOOST_FORCEINLINE value_type wait(value_arg_type old_val, memory_order order = memory_order_seq_cst, wait_policy policy = wait_policy_park) const volatile BOOST_NOEXCEPT
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
-        return atomics::detail::bitwise_cast< value_type >(wait_operations::wait(this->storage(), atomics::detail::bitwise_cast< storage_type >(old_val), order));
+        return atomics::detail::bitwise_cast< value_type >(atomics::detail::policy_wait< wait_operations >(this->storage(), atomics::detail::bitwise_cast< storage_type >(old_val), order, policy));
     }
 
     BOOST_DELETED_FUNCTION(base_atomic(base_atomic const&))
@@ -407,6 +417,16 @@ public:
         return atomics::detail::integral_truncate< value_type >(extra_operations::fetch_complement(this->storage(), order));
     }
 
+    BOOST_FORCEINLINE value_type fetch_max(value_arg_type v, memory_order order = memory_order_seq_cst) volatile BOOST_NOEXCEPT
+    {
+        return atomics::detail::integral_truncate< value_type >(extra_operations::fetch_max(this->storage(), static_cast< storage_type >(v), order));
+    }
+
+    BOOST_FORCEINLINE value_type fetch_min(value_arg_type v, memory_order order = memory_order_seq_cst) volatile BOOST_NOEXCEPT
+    {
+        return atomics::detail::integral_truncate< value_type >(extra_operations::fetch_min(this->storage(), static_cast< storage_type >(v), order));
+    }
+
     BOOST_FORCEINLINE value_type add(difference_type v, memory_order order = memory_order_seq_cst) volatile BOOST_NOEXCEPT
     {
         return atomics::detail::integral_truncate< value_type >(extra_operations::add(this->storage(), static_cast< storage_type >(v), order));
@@ -477,6 +497,16 @@ public:
         extra_operations::opaque_complement(this->storage(), order);
     }
 
+    BOOST_FORCEINLINE void opaque_max(value_arg_type v, memory_order order = memory_order_seq_cst) volatile BOOST_NOEXCEPT
+    {
+        extra_operations::opaque_max(this->storage(), static_cast< storage_type >(v), order);
+    }
+
+    BOOST_FORCEINLINE void opaque_min(value_arg_type v, memory_order order = memory_order_seq_cst) volatile BOOST_NOEXCEPT
+    {
+        extra_operations::opaque_min(this->storage(), static_cast< storage_type >(v), order);
+    }
+
     BOOST_FORCEINLINE bool add_and_test(difference_type v, memory_order order = memory_order_seq_cst) volatile BOOST_NOEXCEPT
     {
         return extra_operations::add_and_test(this->storage(), static_cast< storage_type >(v), order);
@@ -576,12 +606,12 @@ public:
         return bitwise_xor(v);
     }
 
-    BOOST_FORCEINLINE value_type wait(value_type old_val, memory_order order = memory_order_seq_cst) const volatile BOOST_NOEXCEPT
+    BOOST_FORCEINLINE value_type wait(value_type old_val, memory_order order = memory_order_seq_cst, wait_policy policy = wait_policy_park) const volatile BOOST_NOEXCEPT
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
-        return atomics::detail::integral_truncate< value_type >(wait_operations::wait(this->storage(), static_cast< storage_type >(old_val), order));
+        return atomics::detail::integral_truncate< value_type >(atomics::detail::policy_wait< wait_operations >(this->storage(), static_cast< storage_type >(old_val), order, policy));
     }
 
     BOOST_DELETED_FUNCTION(base_atomic(base_atomic const&))
@@ -698,12 +728,12 @@ public:
         return compare_exchange_weak(expected, desired, order, atomics::detail::deduce_failure_order(order));
     }
 
-    BOOST_FORCEINLINE value_type wait(value_type old_val, memory_order order = memory_order_seq_cst) const volatile BOOST_NOEXCEPT
+    BOOST_FORCEINLINE value_type wait(value_type old_val, memory_order order = memory_order_seq_cst, wait_policy policy = wait_policy_park) const volatile BOOST_NOEXCEPT
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
-        return !!wait_operations::wait(this->storage(), static_cast< storage_type >(old_val), order);
+        return !!atomics::detail::policy_wait< wait_operations >(this->storage(), static_cast< storage_type >(old_val), order, policy);
     }
 
     BOOST_DELETED_FUNCTION(base_atomic(base_atomic const&))
@@ -844,6 +874,16 @@ public:
         return extra_fp_operations::fetch_negate(this->storage(), order);
     }
 
+    BOOST_FORCEINLINE value_type fetch_max(value_arg_type v, memory_order order = memory_order_seq_cst) volatile BOOST_NOEXCEPT
+    {
+        return extra_fp_operations::fetch_max(this->storage(), v, order);
+    }
+
+    BOOST_FORCEINLINE value_type fetch_min(value_arg_type v, memory_order order = memory_order_seq_cst) volatile BOOST_NOEXCEPT
+    {
+        return extra_fp_operations::fetch_min(this->storage(), v, order);
+    }
+
     BOOST_FORCEINLINE value_type add(difference_type v, memory_order order = memory_order_seq_cst) volatile BOOST_NOEXCEPT
     {
         return extra_fp_operations::add(this->storage(), v, order);
@@ -874,6 +914,16 @@ public:
         extra_fp_operations::opaque_negate(this->storage(), order);
     }
 
+    BOOST_FORCEINLINE void opaque_max(value_arg_type v, memory_order order = memory_order_seq_cst) volatile BOOST_NOEXCEPT
+    {
+        extra_fp_operations::opaque_max(this->storage(), v, order);
+    }
+
+    BOOST_FORCEINLINE void opaque_min(value_arg_type v, memory_order order = memory_order_seq_cst) volatile BOOST_NOEXCEPT
+    {
+        extra_fp_operations::opaque_min(this->storage(), v, order);
+    }
+
     // Operators
     BOOST_FORCEINLINE value_type operator+=(difference_type v) volatile BOOST_NOEXCEPT
     {
@@ -885,12 +935,12 @@ public:
         return sub(v);
     }
 
-    BOOST_FORCEINLINE value_type wait(value_arg_type old_val, memory_order order = memory_order_seq_cst) const volatile BOOST_NOEXCEPT
+    BOOST_FORCEINLINE value_type wait(value_arg_type old_val, memory_order order = memory_order_seq_cst, wait_policy policy = wait_policy_park) const volatile BOOST_NOEXCEPT
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
-        return atomics::detail::bitwise_fp_cast< value_type >(wait_operations::wait(this->storage(), atomics::detail::bitwise_fp_cast< storage_type >(old_val), order));
+        return atomics::detail::bitwise_fp_cast< value_type >(atomics::detail::policy_wait< wait_operations >(this->storage(), atomics::detail::bitwise_fp_cast< storage_type >(old_val), order, policy));
     }
 
     BOOST_DELETED_FUNCTION(base_atomic(base_atomic const&))
@@ -1090,12 +1140,12 @@ public:
         return sub(v);
     }
 
-    BOOST_FORCEINLINE value_type wait(value_arg_type old_val, memory_order order = memory_order_seq_cst) const volatile BOOST_NOEXCEPT
+    BOOST_FORCEINLINE value_type wait(value_arg_type old_val, memory_order order = memory_order_seq_cst, wait_policy policy = wait_policy_park) const volatile BOOST_NOEXCEPT
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
-        return atomics::detail::bitwise_cast< value_type >(static_cast< uintptr_storage_type >(wait_operations::wait(this->storage(), atomics::detail::bitwise_cast< uintptr_storage_type >(old_val), order)));
+        return atomics::detail::bitwise_cast< value_type >(static_cast< uintptr_storage_type >(atomics::detail::policy_wait< wait_operations >(this->storage(), atomics::detail::bitwise_cast< uintptr_storage_type >(old_val), order, policy)));
     }
 
     BOOST_DELETED_FUNCTION(base_atomic(base_atomic const&))
@@ -0,0 +1,86 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/detail/bit_scan.hpp
+ *
+ * This header defines bit scanning functions.
+ */
+
+#ifndef BOOST_ATOMIC_DETAIL_BIT_SCAN_HPP_INCLUDED_
+#define BOOST_ATOMIC_DETAIL_BIT_SCAN_HPP_INCLUDED_
+
+#include <cstddef>
+#include <boost/atomic/detail/config.hpp>
+#if defined(BOOST_MSVC)
+#include <intrin.h>
+#endif
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+namespace detail {
+
+//! Returns the index of the least significant set bit in \a x. \a x must not be zero.
+BOOST_FORCEINLINE unsigned int count_trailing_zeros(std::size_t x) BOOST_NOEXCEPT
+{
+#if defined(__GNUC__)
+#if defined(__SIZEOF_SIZE_T__) && defined(__SIZEOF_LONG__) && __SIZEOF_SIZE_T__ == __SIZEOF_LONG__
+    return static_cast< unsigned int >(__builtin_ctzl(x));
+#else
+    return static_cast< unsigned int >(__builtin_ctzll(x));
+#endif
+#elif defined(BOOST_MSVC) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long index;
+    _BitScanForward64(&index, x);
+    return static_cast< unsigned int >(index);
+#elif defined(BOOST_MSVC)
+    unsigned long index;
+    _BitScanForward(&index, x);
+    return static_cast< unsigned int >(index);
+#else
+    unsigned int index = 0u;
+    while ((x & 1u) == 0u)
+    {
+        x >>= 1u;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+//! Returns the number of set bits in \a x
+BOOST_FORCEINLINE unsigned int count_set_bits(std::size_t x) BOOST_NOEXCEPT
+{
+#if defined(__GNUC__)
+#if defined(__SIZEOF_SIZE_T__) && defined(__SIZEOF_LONG__) && __SIZEOF_SIZE_T__ == __SIZEOF_LONG__
+    return static_cast< unsigned int >(__builtin_popcountl(x));
+#else
+    return static_cast< unsigned int >(__builtin_popcountll(x));
+#endif
+#else
+    unsigned int count = 0u;
+    while (x != 0u)
+    {
+        x &= x - 1u;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+} // namespace detail
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_DETAIL_BIT_SCAN_HPP_INCLUDED_
@@ -0,0 +1,33 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/detail/cache_line_size.hpp
+ *
+ * This header defines the cache line size used to avoid false sharing between internal data structures.
+ */
+
+#ifndef BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE_HPP_INCLUDED_
+#define BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE_HPP_INCLUDED_
+
+#include <boost/atomic/detail/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+// Cache line size, in bytes
+// NOTE: This constant is made as a macro because some compilers (gcc 4.4 for one) don't allow enums or namespace scope constants in alignment attributes
+#if defined(__s390__) || defined(__s390x__)
+#define BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE 256
+#elif defined(powerpc) || defined(__powerpc__) || defined(__ppc__)
+#define BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE 128
+#else
+#define BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE 64
+#endif
+
+#endif // BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE_HPP_INCLUDED_
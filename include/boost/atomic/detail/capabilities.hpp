@@ -150,6 +150,25 @@
 
 #define BOOST_ATOMIC_ADDRESS_LOCK_FREE BOOST_ATOMIC_POINTER_LOCK_FREE
 
+#if !defined(BOOST_ATOMIC_TAGGED_PTR_ADDRESS_BITS) && (BOOST_ATOMIC_DETAIL_SIZEOF_POINTER + 0) == 8 && (defined(__x86_64__) || defined(_M_AMD64))
+// User-space pointers on x86-64 are canonical addresses with the most significant 16 bits equal to zero
+#define BOOST_ATOMIC_TAGGED_PTR_ADDRESS_BITS 48
+#endif
+
+#if (BOOST_ATOMIC_DETAIL_SIZEOF_POINTER + 0) == 4
+#define BOOST_ATOMIC_TAGGED_PTR_LOCK_FREE BOOST_ATOMIC_INT64_LOCK_FREE
+#elif (BOOST_ATOMIC_DETAIL_SIZEOF_POINTER + 0) == 8
+#if BOOST_ATOMIC_INT128_LOCK_FREE != 2 && BOOST_ATOMIC_INT64_LOCK_FREE == 2 && defined(BOOST_ATOMIC_TAGGED_PTR_ADDRESS_BITS) && (BOOST_ATOMIC_TAGGED_PTR_ADDRESS_BITS + 0) < 64
+// Double-width CAS is not available, but the tag can be packed into the unused most significant bits of the pointer
+#define BOOST_ATOMIC_DETAIL_TAGGED_PTR_PACKED
+#define BOOST_ATOMIC_TAGGED_PTR_LOCK_FREE BOOST_ATOMIC_INT64_LOCK_FREE
+#else
+#define BOOST_ATOMIC_TAGGED_PTR_LOCK_FREE BOOST_ATOMIC_INT128_LOCK_FREE
+#endif
+#else
+#define BOOST_ATOMIC_TAGGED_PTR_LOCK_FREE 0
+#endif
+
 #ifndef BOOST_ATOMIC_BOOL_LOCK_FREE
 // We store bools in 1-byte storage in all backends
 #define BOOST_ATOMIC_BOOL_LOCK_FREE BOOST_ATOMIC_INT8_LOCK_FREE
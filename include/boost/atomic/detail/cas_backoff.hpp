@@ -0,0 +1,107 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/detail/cas_backoff.hpp
+ *
+ * This header contains the backoff policy for CAS loops.
+ */
+
+#ifndef BOOST_ATOMIC_DETAIL_CAS_BACKOFF_HPP_INCLUDED_
+#define BOOST_ATOMIC_DETAIL_CAS_BACKOFF_HPP_INCLUDED_
+
+#include <boost/atomic/detail/config.hpp>
+#if defined(BOOST_ATOMIC_CAS_BACKOFF)
+#include <boost/atomic/detail/pause.hpp>
+#endif
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+#if defined(BOOST_ATOMIC_CAS_BACKOFF)
+
+#if !defined(BOOST_ATOMIC_CAS_BACKOFF_MAX_PAUSE_COUNT)
+#define BOOST_ATOMIC_CAS_BACKOFF_MAX_PAUSE_COUNT 64
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_AMD64) || defined(_M_IX86))
+extern "C" void _m_prefetchw(volatile const void*);
+#if defined(BOOST_MSVC)
+#pragma intrinsic(_m_prefetchw)
+#endif
+#endif
+
+#endif // defined(BOOST_ATOMIC_CAS_BACKOFF)
+
+namespace boost {
+namespace atomics {
+namespace detail {
+
+/*!
+ * \brief Backoff policy for CAS loops
+ *
+ * If \c BOOST_ATOMIC_CAS_BACKOFF is defined, the constructor prefetches the atomic object for writing, so that the initial load
+ * does not fetch the cache line in a shared state, and every failed CAS is followed by a number of pause instructions, which
+ * doubles with every failure up to \c BOOST_ATOMIC_CAS_BACKOFF_MAX_PAUSE_COUNT. Otherwise, the policy does nothing.
+ */
+class cas_backoff
+{
+#if defined(BOOST_ATOMIC_CAS_BACKOFF)
+private:
+    unsigned int m_pause_count;
+
+public:
+    explicit BOOST_FORCEINLINE cas_backoff(const volatile void* addr) BOOST_NOEXCEPT : m_pause_count(1u)
+    {
+#if defined(_MSC_VER) && (defined(_M_AMD64) || defined(_M_IX86))
+        _m_prefetchw(addr);
+#elif defined(__GNUC__) && (defined(__x86_64__) || (defined(__i386__) && (defined(__PRFCHW__) || defined(__3dNOW__))))
+        // x86-64 CPUs that do not support prefetchw execute it as a nop. Compilers only generate prefetchw if the target supports it.
+        __asm__ __volatile__ ("prefetchw %0" : : "m" (*static_cast< const volatile char* >(addr)));
+#elif defined(__GNUC__)
+        __builtin_prefetch(const_cast< const void* >(addr), 1);
+#else
+        (void)addr;
+#endif
+    }
+
+    //! Performs backoff after a failed CAS. Always returns \c true, so that it can be used in loop conditions.
+    BOOST_FORCEINLINE bool on_failure() BOOST_NOEXCEPT
+    {
+        for (unsigned int i = 0u; i < m_pause_count; ++i)
+            atomics::detail::pause();
+
+        if (m_pause_count < static_cast< unsigned int >(BOOST_ATOMIC_CAS_BACKOFF_MAX_PAUSE_COUNT))
+            m_pause_count *= 2u;
+
+        return true;
+    }
+#else // defined(BOOST_ATOMIC_CAS_BACKOFF)
+public:
+    explicit BOOST_FORCEINLINE cas_backoff(const volatile void*) BOOST_NOEXCEPT
+    {
+    }
+
+    BOOST_FORCEINLINE bool on_failure() BOOST_NOEXCEPT
+    {
+        return true;
+    }
+#endif // defined(BOOST_ATOMIC_CAS_BACKOFF)
+
+    BOOST_DELETED_FUNCTION(cas_backoff(cas_backoff const&))
+    BOOST_DELETED_FUNCTION(cas_backoff& operator= (cas_backoff const&))
+};
+
+} // namespace detail
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_DETAIL_CAS_BACKOFF_HPP_INCLUDED_
@@ -16,6 +16,7 @@
 
 #include <boost/memory_order.hpp>
 #include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/cas_backoff.hpp>
 #include <boost/atomic/detail/header.hpp>
 
 #ifdef BOOST_HAS_PRAGMA_ONCE
@@ -35,8 +36,9 @@ struct cas_based_exchange :
     static BOOST_FORCEINLINE storage_type exchange(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
     {
         storage_type old_val;
+        atomics::detail::cas_backoff backoff(&storage);
         atomics::detail::non_atomic_load(storage, old_val);
-        while (!Base::compare_exchange_weak(storage, old_val, v, order, memory_order_relaxed)) {}
+        while (!Base::compare_exchange_weak(storage, old_val, v, order, memory_order_relaxed) && backoff.on_failure()) {}
         return old_val;
     }
 };
@@ -22,6 +22,9 @@
 #include <boost/atomic/detail/storage_traits.hpp>
 #include <boost/atomic/detail/core_arch_operations_fwd.hpp>
 #include <boost/atomic/detail/capabilities.hpp>
+#if defined(BOOST_ATOMIC_CAS_BACKOFF)
+#include <boost/atomic/detail/cas_backoff.hpp>
+#endif
 #if defined(BOOST_ATOMIC_DETAIL_X86_HAS_CMPXCHG8B) || defined(BOOST_ATOMIC_DETAIL_X86_HAS_CMPXCHG16B)
 #include <boost/cstdint.hpp>
 #include <boost/atomic/detail/intptr.hpp>
@@ -99,6 +102,32 @@ struct core_arch_operations_gcc_x86 :
         return Derived::compare_exchange_strong(storage, expected, desired, success_order, failure_order);
     }
 
+#if defined(BOOST_ATOMIC_CAS_BACKOFF)
+#define BOOST_ATOMIC_DETAIL_CAS_LOOP(op)\
+    storage_type old_val;\
+    atomics::detail::cas_backoff backoff(&storage);\
+    old_val = storage;\
+    while (!Derived::compare_exchange_weak(storage, old_val, static_cast< storage_type >(old_val op v), order, memory_order_relaxed) && backoff.on_failure()) {}\
+    return old_val
+
+    static BOOST_FORCEINLINE storage_type fetch_and(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        BOOST_ATOMIC_DETAIL_CAS_LOOP(&);
+    }
+
+    static BOOST_FORCEINLINE storage_type fetch_or(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        BOOST_ATOMIC_DETAIL_CAS_LOOP(|);
+    }
+
+    static BOOST_FORCEINLINE storage_type fetch_xor(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        BOOST_ATOMIC_DETAIL_CAS_LOOP(^);
+    }
+
+#undef BOOST_ATOMIC_DETAIL_CAS_LOOP
+#endif // defined(BOOST_ATOMIC_CAS_BACKOFF)
+
     static BOOST_FORCEINLINE bool test_and_set(storage_type volatile& storage, memory_order order) BOOST_NOEXCEPT
     {
         return !!Derived::exchange(storage, (storage_type)1, order);
@@ -169,6 +198,7 @@ struct core_arch_operations< 1u, Signed, Interprocess > :
         return success;
     }
 
+#if !defined(BOOST_ATOMIC_CAS_BACKOFF)
 #define BOOST_ATOMIC_DETAIL_CAS_LOOP(op, argument, result)\
     temp_storage_type new_val;\
     __asm__ __volatile__\
@@ -205,6 +235,7 @@ struct core_arch_operations< 1u, Signed, Interprocess > :
     }
 
 #undef BOOST_ATOMIC_DETAIL_CAS_LOOP
+#endif // !defined(BOOST_ATOMIC_CAS_BACKOFF)
 };
 
 template< bool Signed, bool Interprocess >
@@ -266,6 +297,7 @@ struct core_arch_operations< 2u, Signed, Interprocess > :
         return success;
     }
 
+#if !defined(BOOST_ATOMIC_CAS_BACKOFF)
 #define BOOST_ATOMIC_DETAIL_CAS_LOOP(op, argument, result)\
     temp_storage_type new_val;\
     __asm__ __volatile__\
@@ -302,6 +334,7 @@ struct core_arch_operations< 2u, Signed, Interprocess > :
     }
 
 #undef BOOST_ATOMIC_DETAIL_CAS_LOOP
+#endif // !defined(BOOST_ATOMIC_CAS_BACKOFF)
 };
 
 template< bool Signed, bool Interprocess >
@@ -362,6 +395,7 @@ struct core_arch_operations< 4u, Signed, Interprocess > :
         return success;
     }
 
+#if !defined(BOOST_ATOMIC_CAS_BACKOFF)
 #define BOOST_ATOMIC_DETAIL_CAS_LOOP(op, argument, result)\
     storage_type new_val;\
     __asm__ __volatile__\
@@ -398,6 +432,7 @@ struct core_arch_operations< 4u, Signed, Interprocess > :
     }
 
 #undef BOOST_ATOMIC_DETAIL_CAS_LOOP
+#endif // !defined(BOOST_ATOMIC_CAS_BACKOFF)
 };
 
 #if defined(BOOST_ATOMIC_DETAIL_X86_HAS_CMPXCHG8B)
@@ -813,6 +848,7 @@ struct core_arch_operations< 8u, Signed, Interprocess > :
         return success;
     }
 
+#if !defined(BOOST_ATOMIC_CAS_BACKOFF)
 #define BOOST_ATOMIC_DETAIL_CAS_LOOP(op, argument, result)\
     storage_type new_val;\
     __asm__ __volatile__\
@@ -849,6 +885,7 @@ struct core_arch_operations< 8u, Signed, Interprocess > :
     }
 
 #undef BOOST_ATOMIC_DETAIL_CAS_LOOP
+#endif // !defined(BOOST_ATOMIC_CAS_BACKOFF)
 };
 
 #endif
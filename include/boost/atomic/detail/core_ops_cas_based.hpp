@@ -16,6 +16,7 @@
 
 #include <boost/memory_order.hpp>
 #include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/cas_backoff.hpp>
 #include <boost/atomic/detail/header.hpp>
 
 #ifdef BOOST_HAS_PRAGMA_ONCE
@@ -37,40 +38,45 @@ struct core_operations_cas_based :
     static BOOST_FORCEINLINE storage_type fetch_add(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
     {
         storage_type old_val;
+        atomics::detail::cas_backoff backoff(&storage);
         atomics::detail::non_atomic_load(storage, old_val);
-        while (!Base::compare_exchange_weak(storage, old_val, old_val + v, order, memory_order_relaxed)) {}
+        while (!Base::compare_exchange_weak(storage, old_val, old_val + v, order, memory_order_relaxed) && backoff.on_failure()) {}
         return old_val;
     }
 
     static BOOST_FORCEINLINE storage_type fetch_sub(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
     {
         storage_type old_val;
+        atomics::detail::cas_backoff backoff(&storage);
         atomics::detail::non_atomic_load(storage, old_val);
-        while (!Base::compare_exchange_weak(storage, old_val, old_val - v, order, memory_order_relaxed)) {}
+        while (!Base::compare_exchange_weak(storage, old_val, old_val - v, order, memory_order_relaxed) && backoff.on_failure()) {}
         return old_val;
     }
 
     static BOOST_FORCEINLINE storage_type fetch_and(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
     {
         storage_type old_val;
+        atomics::detail::cas_backoff backoff(&storage);
         atomics::detail::non_atomic_load(storage, old_val);
-        while (!Base::compare_exchange_weak(storage, old_val, old_val & v, order, memory_order_relaxed)) {}
+        while (!Base::compare_exchange_weak(storage, old_val, old_val & v, order, memory_order_relaxed) && backoff.on_failure()) {}
         return old_val;
     }
 
     static BOOST_FORCEINLINE storage_type fetch_or(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
     {
         storage_type old_val;
+        atomics::detail::cas_backoff backoff(&storage);
         atomics::detail::non_atomic_load(storage, old_val);
-        while (!Base::compare_exchange_weak(storage, old_val, old_val | v, order, memory_order_relaxed)) {}
+        while (!Base::compare_exchange_weak(storage, old_val, old_val | v, order, memory_order_relaxed) && backoff.on_failure()) {}
         return old_val;
     }
 
     static BOOST_FORCEINLINE storage_type fetch_xor(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
     {
         storage_type old_val;
+        atomics::detail::cas_backoff backoff(&storage);
         atomics::detail::non_atomic_load(storage, old_val);
-        while (!Base::compare_exchange_weak(storage, old_val, old_val ^ v, order, memory_order_relaxed)) {}
+        while (!Base::compare_exchange_weak(storage, old_val, old_val ^ v, order, memory_order_relaxed) && backoff.on_failure()) {}
         return old_val;
     }
 
@@ -22,6 +22,9 @@
 #include <boost/atomic/detail/core_arch_operations.hpp>
 #include <boost/atomic/detail/capabilities.hpp>
 #include <boost/atomic/detail/gcc_atomic_memory_order_utils.hpp>
+#if defined(BOOST_ATOMIC_CAS_BACKOFF) && (defined(__i386__) || defined(__x86_64__))
+#include <boost/atomic/detail/cas_backoff.hpp>
+#endif
 
 #if BOOST_ATOMIC_DETAIL_GCC_ATOMIC_INT8_LOCK_FREE < BOOST_ATOMIC_DETAIL_GCC_ATOMIC_INT16_LOCK_FREE || BOOST_ATOMIC_DETAIL_GCC_ATOMIC_INT16_LOCK_FREE < BOOST_ATOMIC_DETAIL_GCC_ATOMIC_INT32_LOCK_FREE ||\
     BOOST_ATOMIC_DETAIL_GCC_ATOMIC_INT32_LOCK_FREE < BOOST_ATOMIC_DETAIL_GCC_ATOMIC_INT64_LOCK_FREE || BOOST_ATOMIC_DETAIL_GCC_ATOMIC_INT64_LOCK_FREE < BOOST_ATOMIC_DETAIL_GCC_ATOMIC_INT128_LOCK_FREE
@@ -126,6 +129,33 @@ struct core_operations_gcc_atomic
         );
     }
 
+#if defined(BOOST_ATOMIC_CAS_BACKOFF) && (defined(__i386__) || defined(__x86_64__))
+    // On x86 the compiler implements these operations with a CAS loop when the result is used. Implement the loop explicitly
+    // to be able to apply backoff on contention.
+#define BOOST_ATOMIC_DETAIL_CAS_LOOP(op)\
+    storage_type old_val;\
+    atomics::detail::cas_backoff backoff(&storage);\
+    old_val = __atomic_load_n(&storage, __ATOMIC_RELAXED);\
+    while (!compare_exchange_weak(storage, old_val, static_cast< storage_type >(old_val op v), order, memory_order_relaxed) && backoff.on_failure()) {}\
+    return old_val
+
+    static BOOST_FORCEINLINE storage_type fetch_and(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        BOOST_ATOMIC_DETAIL_CAS_LOOP(&);
+    }
+
+    static BOOST_FORCEINLINE storage_type fetch_or(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        BOOST_ATOMIC_DETAIL_CAS_LOOP(|);
+    }
+
+    static BOOST_FORCEINLINE storage_type fetch_xor(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        BOOST_ATOMIC_DETAIL_CAS_LOOP(^);
+    }
+
+#undef BOOST_ATOMIC_DETAIL_CAS_LOOP
+#else // defined(BOOST_ATOMIC_CAS_BACKOFF) && (defined(__i386__) || defined(__x86_64__))
     static BOOST_FORCEINLINE storage_type fetch_and(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
     {
         return __atomic_fetch_and(&storage, v, atomics::detail::convert_memory_order_to_gcc(order));
@@ -140,6 +170,7 @@ struct core_operations_gcc_atomic
     {
         return __atomic_fetch_xor(&storage, v, atomics::detail::convert_memory_order_to_gcc(order));
     }
+#endif // defined(BOOST_ATOMIC_CAS_BACKOFF) && (defined(__i386__) || defined(__x86_64__))
 
     static BOOST_FORCEINLINE bool test_and_set(storage_type volatile& storage, memory_order order) BOOST_NOEXCEPT
     {
@@ -17,6 +17,7 @@
 #include <cstddef>
 #include <boost/memory_order.hpp>
 #include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/cas_backoff.hpp>
 #include <boost/atomic/detail/storage_traits.hpp>
 #include <boost/atomic/detail/integral_conversions.hpp>
 #include <boost/atomic/detail/header.hpp>
@@ -39,26 +40,28 @@ struct extending_cas_based_arithmetic :
     static BOOST_FORCEINLINE storage_type fetch_add(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
     {
         storage_type old_val;
+        atomics::detail::cas_backoff backoff(&storage);
         atomics::detail::non_atomic_load(storage, old_val);
         storage_type new_val;
         do
         {
             new_val = atomics::detail::integral_extend< Signed, storage_type >(static_cast< emulated_storage_type >(old_val + v));
         }
-        while (!Base::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed));
+        while (!Base::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed) && backoff.on_failure());
         return old_val;
     }
 
     static BOOST_FORCEINLINE storage_type fetch_sub(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
     {
         storage_type old_val;
+        atomics::detail::cas_backoff backoff(&storage);
         atomics::detail::non_atomic_load(storage, old_val);
         storage_type new_val;
         do
         {
             new_val = atomics::detail::integral_extend< Signed, storage_type >(static_cast< emulated_storage_type >(old_val - v));
         }
-        while (!Base::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed));
+        while (!Base::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed) && backoff.on_failure());
         return old_val;
     }
 };
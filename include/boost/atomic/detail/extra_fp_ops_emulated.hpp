@@ -84,6 +84,28 @@ struct extra_fp_operations_emulated :
         return new_val;
     }
 
+    static value_type fetch_max(storage_type volatile& storage, value_type v, memory_order) BOOST_NOEXCEPT
+    {
+        BOOST_STATIC_ASSERT_MSG(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
+        storage_type& s = const_cast< storage_type& >(storage);
+        scoped_lock lock(&storage);
+        value_type old_val = atomics::detail::bitwise_fp_cast< value_type >(s);
+        if (old_val < v)
+            s = atomics::detail::bitwise_fp_cast< storage_type >(v);
+        return old_val;
+    }
+
+    static value_type fetch_min(storage_type volatile& storage, value_type v, memory_order) BOOST_NOEXCEPT
+    {
+        BOOST_STATIC_ASSERT_MSG(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
+        storage_type& s = const_cast< storage_type& >(storage);
+        scoped_lock lock(&storage);
+        value_type old_val = atomics::detail::bitwise_fp_cast< value_type >(s);
+        if (v < old_val)
+            s = atomics::detail::bitwise_fp_cast< storage_type >(v);
+        return old_val;
+    }
+
     static BOOST_FORCEINLINE void opaque_negate(storage_type volatile& storage, memory_order order) BOOST_NOEXCEPT
     {
         BOOST_STATIC_ASSERT_MSG(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
@@ -101,6 +123,18 @@ struct extra_fp_operations_emulated :
         BOOST_STATIC_ASSERT_MSG(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
         base_type::fetch_sub(storage, v, order);
     }
+
+    static BOOST_FORCEINLINE void opaque_max(storage_type volatile& storage, value_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        BOOST_STATIC_ASSERT_MSG(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
+        fetch_max(storage, v, order);
+    }
+
+    static BOOST_FORCEINLINE void opaque_min(storage_type volatile& storage, value_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        BOOST_STATIC_ASSERT_MSG(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
+        fetch_min(storage, v, order);
+    }
 };
 
 template< typename Base, typename Value, std::size_t Size >
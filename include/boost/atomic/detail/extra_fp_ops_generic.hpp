@@ -17,8 +17,10 @@
 #include <cstddef>
 #include <boost/memory_order.hpp>
 #include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/cas_backoff.hpp>
 #include <boost/atomic/detail/bitwise_fp_cast.hpp>
 #include <boost/atomic/detail/storage_traits.hpp>
+#include <boost/atomic/detail/memory_order_utils.hpp>
 #include <boost/atomic/detail/extra_fp_operations_fwd.hpp>
 #include <boost/atomic/detail/type_traits/is_iec559.hpp>
 #include <boost/atomic/detail/type_traits/is_integral.hpp>
@@ -58,6 +60,7 @@ struct extra_fp_negate_generic :
     {
         storage_type old_storage, new_storage;
         value_type old_val, new_val;
+        atomics::detail::cas_backoff backoff(&storage);
         atomics::detail::non_atomic_load(storage, old_storage);
         do
         {
@@ -65,7 +68,7 @@ struct extra_fp_negate_generic :
             new_val = -old_val;
             new_storage = atomics::detail::bitwise_fp_cast< storage_type >(new_val);
         }
-        while (!base_type::compare_exchange_weak(storage, old_storage, new_storage, order, memory_order_relaxed));
+        while (!base_type::compare_exchange_weak(storage, old_storage, new_storage, order, memory_order_relaxed) && backoff.on_failure());
         return old_val;
     }
 
@@ -73,6 +76,7 @@ struct extra_fp_negate_generic :
     {
         storage_type old_storage, new_storage;
         value_type old_val, new_val;
+        atomics::detail::cas_backoff backoff(&storage);
         atomics::detail::non_atomic_load(storage, old_storage);
         do
         {
@@ -80,7 +84,7 @@ struct extra_fp_negate_generic :
             new_val = -old_val;
             new_storage = atomics::detail::bitwise_fp_cast< storage_type >(new_val);
         }
-        while (!base_type::compare_exchange_weak(storage, old_storage, new_storage, order, memory_order_relaxed));
+        while (!base_type::compare_exchange_weak(storage, old_storage, new_storage, order, memory_order_relaxed) && backoff.on_failure());
         return new_val;
     }
 
@@ -135,6 +139,7 @@ struct extra_fp_operations_generic :
     {
         storage_type old_storage, new_storage;
         value_type old_val, new_val;
+        atomics::detail::cas_backoff backoff(&storage);
         atomics::detail::non_atomic_load(storage, old_storage);
         do
         {
@@ -142,7 +147,7 @@ struct extra_fp_operations_generic :
             new_val = old_val + v;
             new_storage = atomics::detail::bitwise_fp_cast< storage_type >(new_val);
         }
-        while (!base_type::compare_exchange_weak(storage, old_storage, new_storage, order, memory_order_relaxed));
+        while (!base_type::compare_exchange_weak(storage, old_storage, new_storage, order, memory_order_relaxed) && backoff.on_failure());
         return new_val;
     }
 
@@ -150,6 +155,7 @@ struct extra_fp_operations_generic :
     {
         storage_type old_storage, new_storage;
         value_type old_val, new_val;
+        atomics::detail::cas_backoff backoff(&storage);
         atomics::detail::non_atomic_load(storage, old_storage);
         do
         {
@@ -157,10 +163,51 @@ struct extra_fp_operations_generic :
             new_val = old_val - v;
             new_storage = atomics::detail::bitwise_fp_cast< storage_type >(new_val);
         }
-        while (!base_type::compare_exchange_weak(storage, old_storage, new_storage, order, memory_order_relaxed));
+        while (!base_type::compare_exchange_weak(storage, old_storage, new_storage, order, memory_order_relaxed) && backoff.on_failure());
         return new_val;
     }
 
+    static BOOST_FORCEINLINE value_type fetch_max(storage_type volatile& storage, value_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        // Don't modify the atomic object (and don't take its cache line exclusively) if the value is not going to change
+        const memory_order load_order = atomics::detail::deduce_failure_order(order);
+        storage_type old_storage = base_type::load(storage, load_order);
+        value_type old_val = atomics::detail::bitwise_fp_cast< value_type >(old_storage);
+        if (old_val < v)
+        {
+            const storage_type new_storage = atomics::detail::bitwise_fp_cast< storage_type >(v);
+            atomics::detail::cas_backoff backoff(&storage);
+            while (!base_type::compare_exchange_weak(storage, old_storage, new_storage, order, load_order))
+            {
+                old_val = atomics::detail::bitwise_fp_cast< value_type >(old_storage);
+                if (!(old_val < v))
+                    break;
+                backoff.on_failure();
+            }
+        }
+        return old_val;
+    }
+
+    static BOOST_FORCEINLINE value_type fetch_min(storage_type volatile& storage, value_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        const memory_order load_order = atomics::detail::deduce_failure_order(order);
+        storage_type old_storage = base_type::load(storage, load_order);
+        value_type old_val = atomics::detail::bitwise_fp_cast< value_type >(old_storage);
+        if (v < old_val)
+        {
+            const storage_type new_storage = atomics::detail::bitwise_fp_cast< storage_type >(v);
+            atomics::detail::cas_backoff backoff(&storage);
+            while (!base_type::compare_exchange_weak(storage, old_storage, new_storage, order, load_order))
+            {
+                old_val = atomics::detail::bitwise_fp_cast< value_type >(old_storage);
+                if (!(v < old_val))
+                    break;
+                backoff.on_failure();
+            }
+        }
+        return old_val;
+    }
+
     static BOOST_FORCEINLINE void opaque_add(storage_type volatile& storage, value_type v, memory_order order) BOOST_NOEXCEPT
     {
         base_type::fetch_add(storage, v, order);
@@ -170,6 +217,16 @@ struct extra_fp_operations_generic :
     {
         base_type::fetch_sub(storage, v, order);
     }
+
+    static BOOST_FORCEINLINE void opaque_max(storage_type volatile& storage, value_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        fetch_max(storage, v, order);
+    }
+
+    static BOOST_FORCEINLINE void opaque_min(storage_type volatile& storage, value_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        fetch_min(storage, v, order);
+    }
 };
 
 // Default extra_fp_operations template definition will be used unless specialized for a specific platform
@@ -19,6 +19,7 @@
 #include <boost/memory_order.hpp>
 #include <boost/atomic/detail/config.hpp>
 #include <boost/atomic/detail/storage_traits.hpp>
+#include <boost/atomic/detail/integral_conversions.hpp>
 #include <boost/atomic/detail/extra_operations_fwd.hpp>
 #include <boost/atomic/detail/header.hpp>
 
@@ -134,6 +135,28 @@ struct extra_operations_emulated :
         return new_val;
     }
 
+    static storage_type fetch_max(storage_type volatile& storage, storage_type v, memory_order) BOOST_NOEXCEPT
+    {
+        BOOST_STATIC_ASSERT_MSG(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
+        storage_type& s = const_cast< storage_type& >(storage);
+        scoped_lock lock(&storage);
+        storage_type old_val = s;
+        if (atomics::detail::integral_less< Signed, storage_type >(old_val, v))
+            s = v;
+        return old_val;
+    }
+
+    static storage_type fetch_min(storage_type volatile& storage, storage_type v, memory_order) BOOST_NOEXCEPT
+    {
+        BOOST_STATIC_ASSERT_MSG(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
+        storage_type& s = const_cast< storage_type& >(storage);
+        scoped_lock lock(&storage);
+        storage_type old_val = s;
+        if (atomics::detail::integral_less< Signed, storage_type >(v, old_val))
+            s = v;
+        return old_val;
+    }
+
     static BOOST_FORCEINLINE void opaque_add(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
     {
         BOOST_STATIC_ASSERT_MSG(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
@@ -176,6 +199,18 @@ struct extra_operations_emulated :
         fetch_complement(storage, order);
     }
 
+    static BOOST_FORCEINLINE void opaque_max(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        BOOST_STATIC_ASSERT_MSG(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
+        fetch_max(storage, v, order);
+    }
+
+    static BOOST_FORCEINLINE void opaque_min(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        BOOST_STATIC_ASSERT_MSG(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
+        fetch_min(storage, v, order);
+    }
+
     static BOOST_FORCEINLINE bool add_and_test(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
     {
         BOOST_STATIC_ASSERT_MSG(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
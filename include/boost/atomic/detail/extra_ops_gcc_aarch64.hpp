@@ -80,6 +80,16 @@ struct extra_operations_gcc_aarch64_common :
         base_type::bitwise_xor(storage, v, order);
     }
 
+    static BOOST_FORCEINLINE void opaque_max(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        base_type::fetch_max(storage, v, order);
+    }
+
+    static BOOST_FORCEINLINE void opaque_min(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        base_type::fetch_min(storage, v, order);
+    }
+
     static BOOST_FORCEINLINE bool negate_and_test(storage_type volatile& storage, memory_order order) BOOST_NOEXCEPT
     {
         return !!base_type::negate(storage, order);
@@ -345,6 +355,80 @@ struct extra_operations_gcc_aarch64< Base, 1u, Signed > :
     }
 
 #endif // !defined(BOOST_ATOMIC_DETAIL_AARCH64_HAS_LSE)
+
+#if defined(BOOST_ATOMIC_DETAIL_AARCH64_HAS_LSE)
+
+    static BOOST_FORCEINLINE storage_type fetch_max(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        storage_type original;
+        if (Signed)
+        {
+#define BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN(ld_mo, st_mo)\
+            __asm__ __volatile__\
+            (\
+                "ldsmax" ld_mo st_mo "b %w[value], %w[original], %[storage]\n\t"\
+                : [storage] "+Q" (storage), [original] "=r" (original)\
+                : [value] "r" (v)\
+                : "memory"\
+            );
+
+            BOOST_ATOMIC_DETAIL_AARCH64_MO_SWITCH(order)
+#undef BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN
+        }
+        else
+        {
+#define BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN(ld_mo, st_mo)\
+            __asm__ __volatile__\
+            (\
+                "ldumax" ld_mo st_mo "b %w[value], %w[original], %[storage]\n\t"\
+                : [storage] "+Q" (storage), [original] "=r" (original)\
+                : [value] "r" (v)\
+                : "memory"\
+            );
+
+            BOOST_ATOMIC_DETAIL_AARCH64_MO_SWITCH(order)
+#undef BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN
+        }
+
+        return original;
+    }
+
+    static BOOST_FORCEINLINE storage_type fetch_min(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        storage_type original;
+        if (Signed)
+        {
+#define BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN(ld_mo, st_mo)\
+            __asm__ __volatile__\
+            (\
+                "ldsmin" ld_mo st_mo "b %w[value], %w[original], %[storage]\n\t"\
+                : [storage] "+Q" (storage), [original] "=r" (original)\
+                : [value] "r" (v)\
+                : "memory"\
+            );
+
+            BOOST_ATOMIC_DETAIL_AARCH64_MO_SWITCH(order)
+#undef BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN
+        }
+        else
+        {
+#define BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN(ld_mo, st_mo)\
+            __asm__ __volatile__\
+            (\
+                "ldumin" ld_mo st_mo "b %w[value], %w[original], %[storage]\n\t"\
+                : [storage] "+Q" (storage), [original] "=r" (original)\
+                : [value] "r" (v)\
+                : "memory"\
+            );
+
+            BOOST_ATOMIC_DETAIL_AARCH64_MO_SWITCH(order)
+#undef BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN
+        }
+
+        return original;
+    }
+
+#endif // defined(BOOST_ATOMIC_DETAIL_AARCH64_HAS_LSE)
 };
 
 template< typename Base, bool Signed >
@@ -580,6 +664,80 @@ struct extra_operations_gcc_aarch64< Base, 2u, Signed > :
     }
 
 #endif // !defined(BOOST_ATOMIC_DETAIL_AARCH64_HAS_LSE)
+
+#if defined(BOOST_ATOMIC_DETAIL_AARCH64_HAS_LSE)
+
+    static BOOST_FORCEINLINE storage_type fetch_max(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        storage_type original;
+        if (Signed)
+        {
+#define BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN(ld_mo, st_mo)\
+            __asm__ __volatile__\
+            (\
+                "ldsmax" ld_mo st_mo "h %w[value], %w[original], %[storage]\n\t"\
+                : [storage] "+Q" (storage), [original] "=r" (original)\
+                : [value] "r" (v)\
+                : "memory"\
+            );
+
+            BOOST_ATOMIC_DETAIL_AARCH64_MO_SWITCH(order)
+#undef BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN
+        }
+        else
+        {
+#define BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN(ld_mo, st_mo)\
+            __asm__ __volatile__\
+            (\
+                "ldumax" ld_mo st_mo "h %w[value], %w[original], %[storage]\n\t"\
+                : [storage] "+Q" (storage), [original] "=r" (original)\
+                : [value] "r" (v)\
+                : "memory"\
+            );
+
+            BOOST_ATOMIC_DETAIL_AARCH64_MO_SWITCH(order)
+#undef BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN
+        }
+
+        return original;
+    }
+
+    static BOOST_FORCEINLINE storage_type fetch_min(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        storage_type original;
+        if (Signed)
+        {
+#define BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN(ld_mo, st_mo)\
+            __asm__ __volatile__\
+            (\
+                "ldsmin" ld_mo st_mo "h %w[value], %w[original], %[storage]\n\t"\
+                : [storage] "+Q" (storage), [original] "=r" (original)\
+                : [value] "r" (v)\
+                : "memory"\
+            );
+
+            BOOST_ATOMIC_DETAIL_AARCH64_MO_SWITCH(order)
+#undef BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN
+        }
+        else
+        {
+#define BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN(ld_mo, st_mo)\
+            __asm__ __volatile__\
+            (\
+                "ldumin" ld_mo st_mo "h %w[value], %w[original], %[storage]\n\t"\
+                : [storage] "+Q" (storage), [original] "=r" (original)\
+                : [value] "r" (v)\
+                : "memory"\
+            );
+
+            BOOST_ATOMIC_DETAIL_AARCH64_MO_SWITCH(order)
+#undef BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN
+        }
+
+        return original;
+    }
+
+#endif // defined(BOOST_ATOMIC_DETAIL_AARCH64_HAS_LSE)
 };
 
 template< typename Base, bool Signed >
@@ -815,6 +973,80 @@ struct extra_operations_gcc_aarch64< Base, 4u, Signed > :
     }
 
 #endif // !defined(BOOST_ATOMIC_DETAIL_AARCH64_HAS_LSE)
+
+#if defined(BOOST_ATOMIC_DETAIL_AARCH64_HAS_LSE)
+
+    static BOOST_FORCEINLINE storage_type fetch_max(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        storage_type original;
+        if (Signed)
+        {
+#define BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN(ld_mo, st_mo)\
+            __asm__ __volatile__\
+            (\
+                "ldsmax" ld_mo st_mo " %w[value], %w[original], %[storage]\n\t"\
+                : [storage] "+Q" (storage), [original] "=r" (original)\
+                : [value] "r" (v)\
+                : "memory"\
+            );
+
+            BOOST_ATOMIC_DETAIL_AARCH64_MO_SWITCH(order)
+#undef BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN
+        }
+        else
+        {
+#define BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN(ld_mo, st_mo)\
+            __asm__ __volatile__\
+            (\
+                "ldumax" ld_mo st_mo " %w[value], %w[original], %[storage]\n\t"\
+                : [storage] "+Q" (storage), [original] "=r" (original)\
+                : [value] "r" (v)\
+                : "memory"\
+            );
+
+            BOOST_ATOMIC_DETAIL_AARCH64_MO_SWITCH(order)
+#undef BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN
+        }
+
+        return original;
+    }
+
+    static BOOST_FORCEINLINE storage_type fetch_min(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        storage_type original;
+        if (Signed)
+        {
+#define BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN(ld_mo, st_mo)\
+            __asm__ __volatile__\
+            (\
+                "ldsmin" ld_mo st_mo " %w[value], %w[original], %[storage]\n\t"\
+                : [storage] "+Q" (storage), [original] "=r" (original)\
+                : [value] "r" (v)\
+                : "memory"\
+            );
+
+            BOOST_ATOMIC_DETAIL_AARCH64_MO_SWITCH(order)
+#undef BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN
+        }
+        else
+        {
+#define BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN(ld_mo, st_mo)\
+            __asm__ __volatile__\
+            (\
+                "ldumin" ld_mo st_mo " %w[value], %w[original], %[storage]\n\t"\
+                : [storage] "+Q" (storage), [original] "=r" (original)\
+                : [value] "r" (v)\
+                : "memory"\
+            );
+
+            BOOST_ATOMIC_DETAIL_AARCH64_MO_SWITCH(order)
+#undef BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN
+        }
+
+        return original;
+    }
+
+#endif // defined(BOOST_ATOMIC_DETAIL_AARCH64_HAS_LSE)
 };
 
 template< typename Base, bool Signed >
@@ -1050,6 +1282,80 @@ struct extra_operations_gcc_aarch64< Base, 8u, Signed > :
     }
 
 #endif // !defined(BOOST_ATOMIC_DETAIL_AARCH64_HAS_LSE)
+
+#if defined(BOOST_ATOMIC_DETAIL_AARCH64_HAS_LSE)
+
+    static BOOST_FORCEINLINE storage_type fetch_max(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        storage_type original;
+        if (Signed)
+        {
+#define BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN(ld_mo, st_mo)\
+            __asm__ __volatile__\
+            (\
+                "ldsmax" ld_mo st_mo " %x[value], %x[original], %[storage]\n\t"\
+                : [storage] "+Q" (storage), [original] "=r" (original)\
+                : [value] "r" (v)\
+                : "memory"\
+            );
+
+            BOOST_ATOMIC_DETAIL_AARCH64_MO_SWITCH(order)
+#undef BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN
+        }
+        else
+        {
+#define BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN(ld_mo, st_mo)\
+            __asm__ __volatile__\
+            (\
+                "ldumax" ld_mo st_mo " %x[value], %x[original], %[storage]\n\t"\
+                : [storage] "+Q" (storage), [original] "=r" (original)\
+                : [value] "r" (v)\
+                : "memory"\
+            );
+
+            BOOST_ATOMIC_DETAIL_AARCH64_MO_SWITCH(order)
+#undef BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN
+        }
+
+        return original;
+    }
+
+    static BOOST_FORCEINLINE storage_type fetch_min(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        storage_type original;
+        if (Signed)
+        {
+#define BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN(ld_mo, st_mo)\
+            __asm__ __volatile__\
+            (\
+                "ldsmin" ld_mo st_mo " %x[value], %x[original], %[storage]\n\t"\
+                : [storage] "+Q" (storage), [original] "=r" (original)\
+                : [value] "r" (v)\
+                : "memory"\
+            );
+
+            BOOST_ATOMIC_DETAIL_AARCH64_MO_SWITCH(order)
+#undef BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN
+        }
+        else
+        {
+#define BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN(ld_mo, st_mo)\
+            __asm__ __volatile__\
+            (\
+                "ldumin" ld_mo st_mo " %x[value], %x[original], %[storage]\n\t"\
+                : [storage] "+Q" (storage), [original] "=r" (original)\
+                : [value] "r" (v)\
+                : "memory"\
+            );
+
+            BOOST_ATOMIC_DETAIL_AARCH64_MO_SWITCH(order)
+#undef BOOST_ATOMIC_DETAIL_AARCH64_MO_INSN
+        }
+
+        return original;
+    }
+
+#endif // defined(BOOST_ATOMIC_DETAIL_AARCH64_HAS_LSE)
 };
 
 template< typename Base, bool Signed >
@@ -39,6 +39,8 @@ struct extra_operations< Base, 1u, Signed, true > :
     typedef typename base_type::storage_type storage_type;
     typedef typename storage_traits< 4u >::type temp_storage_type;
 
+#if !defined(BOOST_ATOMIC_CAS_BACKOFF)
+
 #define BOOST_ATOMIC_DETAIL_CAS_LOOP(op, original, result)\
     __asm__ __volatile__\
     (\
@@ -125,6 +127,14 @@ struct extra_operations< Base, 1u, Signed, true > :
 
 #undef BOOST_ATOMIC_DETAIL_CAS_LOOP
 
+#else // !defined(BOOST_ATOMIC_CAS_BACKOFF)
+
+    // Use CAS loops with backoff from the generic implementation
+    using base_type::negate;
+    using base_type::bitwise_complement;
+
+#endif // !defined(BOOST_ATOMIC_CAS_BACKOFF)
+
     static BOOST_FORCEINLINE bool negate_and_test(storage_type volatile& storage, memory_order order) BOOST_NOEXCEPT
     {
         return !!negate(storage, order);
@@ -421,6 +431,8 @@ struct extra_operations< Base, 2u, Signed, true > :
     typedef typename base_type::storage_type storage_type;
     typedef typename storage_traits< 4u >::type temp_storage_type;
 
+#if !defined(BOOST_ATOMIC_CAS_BACKOFF)
+
 #define BOOST_ATOMIC_DETAIL_CAS_LOOP(op, original, result)\
     __asm__ __volatile__\
     (\
@@ -507,6 +519,14 @@ struct extra_operations< Base, 2u, Signed, true > :
 
 #undef BOOST_ATOMIC_DETAIL_CAS_LOOP
 
+#else // !defined(BOOST_ATOMIC_CAS_BACKOFF)
+
+    // Use CAS loops with backoff from the generic implementation
+    using base_type::negate;
+    using base_type::bitwise_complement;
+
+#endif // !defined(BOOST_ATOMIC_CAS_BACKOFF)
+
     static BOOST_FORCEINLINE bool negate_and_test(storage_type volatile& storage, memory_order order) BOOST_NOEXCEPT
     {
         return !!negate(storage, order);
@@ -874,6 +894,8 @@ struct extra_operations< Base, 4u, Signed, true > :
     typedef extra_operations_generic< Base, 4u, Signed > base_type;
     typedef typename base_type::storage_type storage_type;
 
+#if !defined(BOOST_ATOMIC_CAS_BACKOFF)
+
 #define BOOST_ATOMIC_DETAIL_CAS_LOOP(op, original, result)\
     __asm__ __volatile__\
     (\
@@ -960,6 +982,14 @@ struct extra_operations< Base, 4u, Signed, true > :
 
 #undef BOOST_ATOMIC_DETAIL_CAS_LOOP
 
+#else // !defined(BOOST_ATOMIC_CAS_BACKOFF)
+
+    // Use CAS loops with backoff from the generic implementation
+    using base_type::negate;
+    using base_type::bitwise_complement;
+
+#endif // !defined(BOOST_ATOMIC_CAS_BACKOFF)
+
     static BOOST_FORCEINLINE bool negate_and_test(storage_type volatile& storage, memory_order order) BOOST_NOEXCEPT
     {
         return !!negate(storage, order);
@@ -1329,6 +1359,8 @@ struct extra_operations< Base, 8u, Signed, true > :
     typedef extra_operations_generic< Base, 8u, Signed > base_type;
     typedef typename base_type::storage_type storage_type;
 
+#if !defined(BOOST_ATOMIC_CAS_BACKOFF)
+
 #define BOOST_ATOMIC_DETAIL_CAS_LOOP(op, original, result)\
     __asm__ __volatile__\
     (\
@@ -1415,6 +1447,14 @@ struct extra_operations< Base, 8u, Signed, true > :
 
 #undef BOOST_ATOMIC_DETAIL_CAS_LOOP
 
+#else // !defined(BOOST_ATOMIC_CAS_BACKOFF)
+
+    // Use CAS loops with backoff from the generic implementation
+    using base_type::negate;
+    using base_type::bitwise_complement;
+
+#endif // !defined(BOOST_ATOMIC_CAS_BACKOFF)
+
     static BOOST_FORCEINLINE bool negate_and_test(storage_type volatile& storage, memory_order order) BOOST_NOEXCEPT
     {
         return !!negate(storage, order);
@@ -17,7 +17,9 @@
 #include <cstddef>
 #include <boost/memory_order.hpp>
 #include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/cas_backoff.hpp>
 #include <boost/atomic/detail/storage_traits.hpp>
+#include <boost/atomic/detail/memory_order_utils.hpp>
 #include <boost/atomic/detail/integral_conversions.hpp>
 #include <boost/atomic/detail/extra_operations_fwd.hpp>
 #include <boost/atomic/detail/header.hpp>
@@ -42,20 +44,22 @@ struct extra_operations_generic :
     static BOOST_FORCEINLINE storage_type fetch_negate(storage_type volatile& storage, memory_order order) BOOST_NOEXCEPT
     {
         storage_type old_val;
+        atomics::detail::cas_backoff backoff(&storage);
         atomics::detail::non_atomic_load(storage, old_val);
-        while (!base_type::compare_exchange_weak(storage, old_val, atomics::detail::integral_extend< Signed, storage_type >(static_cast< emulated_storage_type >(-old_val)), order, memory_order_relaxed)) {}
+        while (!base_type::compare_exchange_weak(storage, old_val, atomics::detail::integral_extend< Signed, storage_type >(static_cast< emulated_storage_type >(-old_val)), order, memory_order_relaxed) && backoff.on_failure()) {}
         return old_val;
     }
 
     static BOOST_FORCEINLINE storage_type negate(storage_type volatile& storage, memory_order order) BOOST_NOEXCEPT
     {
         storage_type old_val, new_val;
+        atomics::detail::cas_backoff backoff(&storage);
         atomics::detail::non_atomic_load(storage, old_val);
         do
         {
             new_val = atomics::detail::integral_extend< Signed, storage_type >(static_cast< emulated_storage_type >(-old_val));
         }
-        while (!base_type::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed));
+        while (!base_type::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed) && backoff.on_failure());
         return new_val;
     }
 
@@ -95,6 +99,33 @@ struct extra_operations_generic :
         return base_type::fetch_xor(storage, mask, order) ^ mask;
     }
 
+    static BOOST_FORCEINLINE storage_type fetch_max(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        // Don't modify the atomic object (and don't take its cache line exclusively) if the value is not going to change
+        const memory_order load_order = atomics::detail::deduce_failure_order(order);
+        storage_type old_val = base_type::load(storage, load_order);
+        if (atomics::detail::integral_less< Signed, emulated_storage_type >(old_val, v))
+        {
+            atomics::detail::cas_backoff backoff(&storage);
+            while (!base_type::compare_exchange_weak(storage, old_val, v, order, load_order) &&
+                atomics::detail::integral_less< Signed, emulated_storage_type >(old_val, v) && backoff.on_failure()) {}
+        }
+        return old_val;
+    }
+
+    static BOOST_FORCEINLINE storage_type fetch_min(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        const memory_order load_order = atomics::detail::deduce_failure_order(order);
+        storage_type old_val = base_type::load(storage, load_order);
+        if (atomics::detail::integral_less< Signed, emulated_storage_type >(v, old_val))
+        {
+            atomics::detail::cas_backoff backoff(&storage);
+            while (!base_type::compare_exchange_weak(storage, old_val, v, order, load_order) &&
+                atomics::detail::integral_less< Signed, emulated_storage_type >(v, old_val) && backoff.on_failure()) {}
+        }
+        return old_val;
+    }
+
     static BOOST_FORCEINLINE void opaque_add(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
     {
         base_type::fetch_add(storage, v, order);
@@ -130,6 +161,16 @@ struct extra_operations_generic :
         fetch_complement(storage, order);
     }
 
+    static BOOST_FORCEINLINE void opaque_max(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        fetch_max(storage, v, order);
+    }
+
+    static BOOST_FORCEINLINE void opaque_min(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        fetch_min(storage, v, order);
+    }
+
     static BOOST_FORCEINLINE bool add_and_test(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
     {
         return !!static_cast< emulated_storage_type >(add(storage, v, order));
@@ -199,80 +240,87 @@ struct extra_operations_generic< Base, Size, Signed, true > :
     static BOOST_FORCEINLINE storage_type fetch_negate(storage_type volatile& storage, memory_order order) BOOST_NOEXCEPT
     {
         storage_type old_val;
+        atomics::detail::cas_backoff backoff(&storage);
         atomics::detail::non_atomic_load(storage, old_val);
-        while (!base_type::compare_exchange_weak(storage, old_val, atomics::detail::integral_extend< Signed, storage_type >(static_cast< emulated_storage_type >(-old_val)), order, memory_order_relaxed)) {}
+        while (!base_type::compare_exchange_weak(storage, old_val, atomics::detail::integral_extend< Signed, storage_type >(static_cast< emulated_storage_type >(-old_val)), order, memory_order_relaxed) && backoff.on_failure()) {}
         return old_val;
     }
 
     static BOOST_FORCEINLINE storage_type negate(storage_type volatile& storage, memory_order order) BOOST_NOEXCEPT
     {
         storage_type old_val, new_val;
+        atomics::detail::cas_backoff backoff(&storage);
         atomics::detail::non_atomic_load(storage, old_val);
         do
         {
             new_val = atomics::detail::integral_extend< Signed, storage_type >(static_cast< emulated_storage_type >(-old_val));
         }
-        while (!base_type::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed));
+        while (!base_type::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed) && backoff.on_failure());
         return new_val;
     }
 
     static BOOST_FORCEINLINE storage_type add(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
     {
         storage_type old_val, new_val;
+        atomics::detail::cas_backoff backoff(&storage);
         atomics::detail::non_atomic_load(storage, old_val);
         do
         {
             new_val = atomics::detail::integral_extend< Signed, storage_type >(static_cast< emulated_storage_type >(old_val + v));
         }
-        while (!base_type::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed));
+        while (!base_type::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed) && backoff.on_failure());
         return new_val;
     }
 
     static BOOST_FORCEINLINE storage_type sub(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
     {
         storage_type old_val, new_val;
+        atomics::detail::cas_backoff backoff(&storage);
         atomics::detail::non_atomic_load(storage, old_val);
         do
         {
             new_val = atomics::detail::integral_extend< Signed, storage_type >(static_cast< emulated_storage_type >(old_val - v));
         }
-        while (!base_type::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed));
+        while (!base_type::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed) && backoff.on_failure());
         return new_val;
     }
 
     static BOOST_FORCEINLINE storage_type bitwise_and(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
     {
         storage_type old_val, new_val;
+        atomics::detail::cas_backoff backoff(&storage);
         atomics::detail::non_atomic_load(storage, old_val);
         do
         {
             new_val = atomics::detail::integral_extend< Signed, storage_type >(static_cast< emulated_storage_type >(old_val & v));
         }
-        while (!base_type::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed));
+        while (!base_type::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed) && backoff.on_failure());
         return new_val;
     }
 
     static BOOST_FORCEINLINE storage_type bitwise_or(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
     {
         storage_type old_val, new_val;
+        atomics::detail::cas_backoff backoff(&storage);
         atomics::detail::non_atomic_load(storage, old_val);
         do
         {
             new_val = atomics::detail::integral_extend< Signed, storage_type >(static_cast< emulated_storage_type >(old_val | v));
         }
-        while (!base_type::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed));
+        while (!base_type::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed) && backoff.on_failure());
         return new_val;
     }
 
     static BOOST_FORCEINLINE storage_type bitwise_xor(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
     {
         storage_type old_val, new_val;
+        atomics::detail::cas_backoff backoff(&storage);
         atomics::detail::non_atomic_load(storage, old_val);
         do
         {
             new_val = atomics::detail::integral_extend< Signed, storage_type >(static_cast< emulated_storage_type >(old_val ^ v));
         }
-        while (!base_type::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed));
+        while (!base_type::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed) && backoff.on_failure());
         return new_val;
     }
 
@@ -286,6 +334,33 @@ struct extra_operations_generic< Base, Size, Signed, true > :
         return bitwise_xor(storage, atomics::detail::integral_extend< Signed, storage_type >(static_cast< emulated_storage_type >(~static_cast< emulated_storage_type >(0u))), order);
     }
 
+    static BOOST_FORCEINLINE storage_type fetch_max(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        // Don't modify the atomic object (and don't take its cache line exclusively) if the value is not going to change
+        const memory_order load_order = atomics::detail::deduce_failure_order(order);
+        storage_type old_val = base_type::load(storage, load_order);
+        if (atomics::detail::integral_less< Signed, emulated_storage_type >(old_val, v))
+        {
+            atomics::detail::cas_backoff backoff(&storage);
+            while (!base_type::compare_exchange_weak(storage, old_val, v, order, load_order) &&
+                atomics::detail::integral_less< Signed, emulated_storage_type >(old_val, v) && backoff.on_failure()) {}
+        }
+        return old_val;
+    }
+
+    static BOOST_FORCEINLINE storage_type fetch_min(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        const memory_order load_order = atomics::detail::deduce_failure_order(order);
+        storage_type old_val = base_type::load(storage, load_order);
+        if (atomics::detail::integral_less< Signed, emulated_storage_type >(v, old_val))
+        {
+            atomics::detail::cas_backoff backoff(&storage);
+            while (!base_type::compare_exchange_weak(storage, old_val, v, order, load_order) &&
+                atomics::detail::integral_less< Signed, emulated_storage_type >(v, old_val) && backoff.on_failure()) {}
+        }
+        return old_val;
+    }
+
     static BOOST_FORCEINLINE void opaque_add(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
     {
         base_type::fetch_add(storage, v, order);
@@ -321,6 +396,16 @@ struct extra_operations_generic< Base, Size, Signed, true > :
         fetch_complement(storage, order);
     }
 
+    static BOOST_FORCEINLINE void opaque_max(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        fetch_max(storage, v, order);
+    }
+
+    static BOOST_FORCEINLINE void opaque_min(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
+    {
+        fetch_min(storage, v, order);
+    }
+
     static BOOST_FORCEINLINE bool add_and_test(storage_type volatile& storage, storage_type v, memory_order order) BOOST_NOEXCEPT
     {
         return !!static_cast< emulated_storage_type >(add(storage, v, order));
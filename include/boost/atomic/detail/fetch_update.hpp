@@ -0,0 +1,63 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/detail/fetch_update.hpp
+ *
+ * This header contains implementation of the generic \c fetch_update operation.
+ */
+
+#ifndef BOOST_ATOMIC_DETAIL_FETCH_UPDATE_HPP_INCLUDED_
+#define BOOST_ATOMIC_DETAIL_FETCH_UPDATE_HPP_INCLUDED_
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/cas_backoff.hpp>
+#include <boost/atomic/detail/memory_order_utils.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+namespace detail {
+
+/*!
+ * \brief Applies the updater function to the atomic object in a CAS loop
+ *
+ * The updater is called as <tt>f(old_val, new_val)</tt>, where \c old_val is the current value and \c new_val is a reference
+ * to the value to be stored. If the updater returns \c false, the loop terminates without modifying the atomic object.
+ * Returns \c true if the atomic object has been updated and \c false if the updater aborted the operation. In both cases,
+ * \a old_val receives the value that was passed to the last call of the updater.
+ */
+template< typename Value, typename Atomic, typename F >
+BOOST_FORCEINLINE bool fetch_update(Atomic& a, const volatile void* addr, F& f, Value& old_val, memory_order order)
+{
+    const memory_order failure_order = atomics::detail::deduce_failure_order(order);
+    atomics::detail::cas_backoff backoff(addr);
+    old_val = a.load(failure_order);
+    Value new_val = old_val;
+    while (f(static_cast< const Value& >(old_val), new_val))
+    {
+        if (a.compare_exchange_weak(old_val, new_val, order, failure_order))
+            return true;
+
+        backoff.on_failure();
+    }
+
+    return false;
+}
+
+} // namespace detail
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_DETAIL_FETCH_UPDATE_HPP_INCLUDED_
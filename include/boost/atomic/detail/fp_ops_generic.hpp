@@ -17,6 +17,7 @@
 #include <cstddef>
 #include <boost/memory_order.hpp>
 #include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/cas_backoff.hpp>
 #include <boost/atomic/detail/bitwise_fp_cast.hpp>
 #include <boost/atomic/detail/storage_traits.hpp>
 #include <boost/atomic/detail/fp_operations_fwd.hpp>
@@ -43,6 +44,7 @@ struct fp_operations_generic :
     {
         storage_type old_storage, new_storage;
         value_type old_val, new_val;
+        atomics::detail::cas_backoff backoff(&storage);
         atomics::detail::non_atomic_load(storage, old_storage);
         do
         {
@@ -50,7 +52,7 @@ struct fp_operations_generic :
             new_val = old_val + v;
             new_storage = atomics::detail::bitwise_fp_cast< storage_type >(new_val);
         }
-        while (!base_type::compare_exchange_weak(storage, old_storage, new_storage, order, memory_order_relaxed));
+        while (!base_type::compare_exchange_weak(storage, old_storage, new_storage, order, memory_order_relaxed) && backoff.on_failure());
         return old_val;
     }
 
@@ -58,6 +60,7 @@ struct fp_operations_generic :
     {
         storage_type old_storage, new_storage;
         value_type old_val, new_val;
+        atomics::detail::cas_backoff backoff(&storage);
         atomics::detail::non_atomic_load(storage, old_storage);
         do
         {
@@ -65,7 +68,7 @@ struct fp_operations_generic :
             new_val = old_val - v;
             new_storage = atomics::detail::bitwise_fp_cast< storage_type >(new_val);
         }
-        while (!base_type::compare_exchange_weak(storage, old_storage, new_storage, order, memory_order_relaxed));
+        while (!base_type::compare_exchange_weak(storage, old_storage, new_storage, order, memory_order_relaxed) && backoff.on_failure());
         return old_val;
     }
 };
@@ -99,6 +99,26 @@ BOOST_FORCEINLINE Output integral_extend(Input input) BOOST_NOEXCEPT
     return atomics::detail::integral_extend< Output >(input, atomics::detail::integral_constant< bool, Signed >());
 }
 
+template< typename Value, typename Input >
+BOOST_FORCEINLINE bool integral_less_impl(Input x, Input y, atomics::detail::true_type) BOOST_NOEXCEPT
+{
+    typedef typename atomics::detail::make_signed< Value >::type signed_value_type;
+    return atomics::detail::integral_truncate< signed_value_type >(x) < atomics::detail::integral_truncate< signed_value_type >(y);
+}
+
+template< typename Value, typename Input >
+BOOST_FORCEINLINE bool integral_less_impl(Input x, Input y, atomics::detail::false_type) BOOST_NOEXCEPT
+{
+    return atomics::detail::integral_truncate< Value >(x) < atomics::detail::integral_truncate< Value >(y);
+}
+
+//! Compares input operands as signed or unsigned integers of the same size as the unsigned type Value. The operands may be extended to a larger type.
+template< bool Signed, typename Value, typename Input >
+BOOST_FORCEINLINE bool integral_less(Input x, Input y) BOOST_NOEXCEPT
+{
+    return atomics::detail::integral_less_impl< Value >(x, y, atomics::detail::integral_constant< bool, Signed >());
+}
+
 } // namespace detail
 } // namespace atomics
 } // namespace boost
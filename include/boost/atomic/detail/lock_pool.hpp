@@ -19,6 +19,11 @@
 #include <boost/atomic/detail/config.hpp>
 #include <boost/atomic/detail/link.hpp>
 #include <boost/atomic/detail/intptr.hpp>
+#if defined(BOOST_ATOMIC_INLINE_LOCK_POOL)
+#include <boost/cstdint.hpp>
+#include <boost/atomic/detail/futex.hpp>
+#include <boost/atomic/detail/cache_line_size.hpp>
+#endif
 #if defined(BOOST_WINDOWS)
 #include <boost/winapi/thread.hpp>
 #elif defined(BOOST_HAS_NANOSLEEP)
@@ -32,6 +37,13 @@
 #pragma once
 #endif
 
+// The inline fast path uses compiler intrinsics directly because core_operations depend on this header for emulated operations.
+// The library only exports the fast path interface if it uses futex-based mutexes in the lock pool.
+#if defined(BOOST_ATOMIC_INLINE_LOCK_POOL) && defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX) &&\
+    defined(__ATOMIC_RELAXED) && defined(__GCC_ATOMIC_INT_LOCK_FREE) && (__GCC_ATOMIC_INT_LOCK_FREE == 2)
+#define BOOST_ATOMIC_DETAIL_LOCK_POOL_INLINE_FAST_PATH
+#endif
+
 namespace boost {
 namespace atomics {
 namespace detail {
@@ -58,16 +70,73 @@ namespace lock_pool {
 BOOST_ATOMIC_DECL void* short_lock(atomics::detail::uintptr_t h) BOOST_NOEXCEPT;
 BOOST_ATOMIC_DECL void* long_lock(atomics::detail::uintptr_t h) BOOST_NOEXCEPT;
 BOOST_ATOMIC_DECL void unlock(void* ls) BOOST_NOEXCEPT;
-
-BOOST_ATOMIC_DECL void* allocate_wait_state(void* ls, const volatile void* addr) BOOST_NOEXCEPT;
-BOOST_ATOMIC_DECL void free_wait_state(void* ls, void* ws) BOOST_NOEXCEPT;
-BOOST_ATOMIC_DECL void wait(void* ls, void* ws) BOOST_NOEXCEPT;
-BOOST_ATOMIC_DECL void notify_one(void* ls, const volatile void* addr) BOOST_NOEXCEPT;
-BOOST_ATOMIC_DECL void notify_all(void* ls, const volatile void* addr) BOOST_NOEXCEPT;
+//! Locks the lock pool entries for all \a hashes in a globally consistent order. Fills \a locks with the distinct locked entries and returns their number. Modifies \a hashes.
+BOOST_ATOMIC_DECL std::size_t short_lock_multiple(atomics::detail::uintptr_t* hashes, std::size_t count, void** locks) BOOST_NOEXCEPT;
 
 BOOST_ATOMIC_DECL void thread_fence() BOOST_NOEXCEPT;
 BOOST_ATOMIC_DECL void signal_fence() BOOST_NOEXCEPT;
 
+#if defined(BOOST_ATOMIC_DETAIL_LOCK_POOL_INLINE_FAST_PATH)
+
+//! Location of the lock pool entries, exported by the library for the inline fast path
+struct pool_descriptor
+{
+    //! Pointer to the first entry. Each entry occupies a cache line and starts with a 32-bit futex-based mutex.
+    unsigned char* entries;
+    //! Mask applied to the address hash to obtain the entry index
+    std::size_t index_mask;
+};
+
+BOOST_ATOMIC_DECL extern const pool_descriptor g_pool_descriptor;
+
+//! Locks the lock pool entry after the inline fast path failed to lock it
+BOOST_ATOMIC_DECL void short_lock_slow_path(void* ls) BOOST_NOEXCEPT;
+//! Wakes up a thread blocked on the lock pool entry after the inline fast path unlocked it
+BOOST_ATOMIC_DECL void unlock_slow_path(void* ls, boost::uint32_t new_state) BOOST_NOEXCEPT;
+
+//! Mutex state bits, must be consistent with mutex_operations
+BOOST_CONSTEXPR_OR_CONST boost::uint32_t inline_mutex_locked = 1u;
+BOOST_CONSTEXPR_OR_CONST boost::uint32_t inline_mutex_contended = 1u << 1;
+BOOST_CONSTEXPR_OR_CONST boost::uint32_t inline_mutex_counter_one = 1u << 2;
+
+//! Locks the lock pool entry for the hash value, only calling into the library if the entry is already locked
+BOOST_FORCEINLINE void* fast_short_lock(atomics::detail::uintptr_t h) BOOST_NOEXCEPT
+{
+    void* ls = g_pool_descriptor.entries + (h & g_pool_descriptor.index_mask) * static_cast< std::size_t >(BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE);
+    boost::uint32_t* mutex = static_cast< boost::uint32_t* >(ls);
+    boost::uint32_t state = __atomic_load_n(mutex, __ATOMIC_RELAXED);
+    if (BOOST_UNLIKELY((state & inline_mutex_locked) != 0u ||
+        !__atomic_compare_exchange_n(mutex, &state, state | inline_mutex_locked, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)))
+    {
+        lock_pool::short_lock_slow_path(ls);
+    }
+
+    return ls;
+}
+
+//! Unlocks the lock pool entry, only calling into the library if there are blocked threads
+BOOST_FORCEINLINE void fast_unlock(void* ls) BOOST_NOEXCEPT
+{
+    // The locked bit is known to be set, so clearing it and incrementing the counter can be done with a single addition
+    const boost::uint32_t prev_state = __atomic_fetch_add(static_cast< boost::uint32_t* >(ls), inline_mutex_counter_one - inline_mutex_locked, __ATOMIC_RELEASE);
+    if (BOOST_UNLIKELY((prev_state & inline_mutex_contended) != 0u))
+        lock_pool::unlock_slow_path(ls, prev_state + (inline_mutex_counter_one - inline_mutex_locked));
+}
+
+#else // defined(BOOST_ATOMIC_DETAIL_LOCK_POOL_INLINE_FAST_PATH)
+
+BOOST_FORCEINLINE void* fast_short_lock(atomics::detail::uintptr_t h) BOOST_NOEXCEPT
+{
+    return lock_pool::short_lock(h);
+}
+
+BOOST_FORCEINLINE void fast_unlock(void* ls) BOOST_NOEXCEPT
+{
+    lock_pool::unlock(ls);
+}
+
+#endif // defined(BOOST_ATOMIC_DETAIL_LOCK_POOL_INLINE_FAST_PATH)
+
 template< std::size_t Alignment >
 BOOST_FORCEINLINE atomics::detail::uintptr_t hash_ptr(const volatile void* addr) BOOST_NOEXCEPT
 {
@@ -96,13 +165,13 @@ public:
     {
         atomics::detail::uintptr_t h = lock_pool::hash_ptr< Alignment >(addr);
         BOOST_IF_CONSTEXPR (!LongLock)
-            m_lock = lock_pool::short_lock(h);
+            m_lock = lock_pool::fast_short_lock(h);
         else
             m_lock = lock_pool::long_lock(h);
     }
     ~scoped_lock() BOOST_NOEXCEPT
     {
-        lock_pool::unlock(m_lock);
+        lock_pool::fast_unlock(m_lock);
     }
 
     void* get_lock_state() const BOOST_NOEXCEPT
@@ -114,33 +183,6 @@ public:
     BOOST_DELETED_FUNCTION(scoped_lock& operator=(scoped_lock const&))
 };
 
-template< std::size_t Alignment >
-class scoped_wait_state :
-    public scoped_lock< Alignment, true >
-{
-private:
-    void* m_wait_state;
-
-public:
-    explicit scoped_wait_state(const volatile void* addr) BOOST_NOEXCEPT :
-        scoped_lock< Alignment, true >(addr)
-    {
-        m_wait_state = lock_pool::allocate_wait_state(this->get_lock_state(), addr);
-    }
-    ~scoped_wait_state() BOOST_NOEXCEPT
-    {
-        lock_pool::free_wait_state(this->get_lock_state(), m_wait_state);
-    }
-
-    void wait() BOOST_NOEXCEPT
-    {
-        lock_pool::wait(this->get_lock_state(), m_wait_state);
-    }
-
-    BOOST_DELETED_FUNCTION(scoped_wait_state(scoped_wait_state const&))
-    BOOST_DELETED_FUNCTION(scoped_wait_state& operator=(scoped_wait_state const&))
-};
-
 } // namespace lock_pool
 } // namespace detail
 } // namespace atomics
@@ -0,0 +1,334 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/detail/mutex_operations.hpp
+ *
+ * This header contains implementation of a compact mutex and condition variable on top of a 32-bit atomic storage.
+ * The implementation uses futexes directly, if available, and waiting and notifying operations otherwise.
+ */
+
+#ifndef BOOST_ATOMIC_DETAIL_MUTEX_OPERATIONS_HPP_INCLUDED_
+#define BOOST_ATOMIC_DETAIL_MUTEX_OPERATIONS_HPP_INCLUDED_
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/capabilities.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/core_operations.hpp>
+#include <boost/atomic/detail/extra_operations.hpp>
+#include <boost/atomic/detail/wait_operations.hpp>
+#include <boost/atomic/detail/pause.hpp>
+#include <boost/atomic/detail/parking_lot.hpp>
+#include <boost/atomic/detail/futex.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+#if defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX) && BOOST_ATOMIC_INT32_LOCK_FREE == 2
+#define BOOST_ATOMIC_DETAIL_MUTEX_USE_FUTEX
+#endif
+
+namespace boost {
+namespace atomics {
+namespace detail {
+
+/*!
+ * \brief Mutex and condition variable operations
+ *
+ * The mutex state consists of the locked bit, the contended bit, which indicates that there may be threads blocked on the mutex,
+ * and a counter that is incremented on every unlock to mitigate ABA problem. The condition variable consists of a sequence
+ * counter, which is incremented on every notification and is used as the futex blocked threads wait on, and the number of blocked threads.
+ * When futexes are supported, notifying operations move the blocked threads to the mutex futex instead of waking them up,
+ * so that the threads are woken one by one, as the mutex is unlocked.
+ */
+template< bool Interprocess >
+struct mutex_operations
+{
+    // The storage must be a 32-bit object, as required by futex API
+    typedef atomics::detail::core_operations< 4u, false, Interprocess > core_operations;
+    typedef atomics::detail::extra_operations< core_operations > extra_operations;
+    typedef atomics::detail::wait_operations< core_operations > wait_operations;
+    typedef typename core_operations::storage_type storage_type;
+
+    static BOOST_CONSTEXPR_OR_CONST bool is_always_lock_free = core_operations::is_always_lock_free;
+
+    //! The bit indicates a locked mutex
+    static BOOST_CONSTEXPR_OR_CONST storage_type locked = 1u;
+    //! The bit indicates that there is at least one thread blocked waiting for the mutex to be released
+    static BOOST_CONSTEXPR_OR_CONST storage_type contended = 1u << 1;
+    //! The lowest bit of the counter bits used to mitigate ABA problem. This and any higher bits in the mutex state constitute the counter.
+    static BOOST_CONSTEXPR_OR_CONST storage_type counter_one = 1u << 2;
+
+    //! Attempts to lock the mutex without blocking
+    static BOOST_FORCEINLINE bool try_lock(storage_type volatile& mutex) BOOST_NOEXCEPT
+    {
+        storage_type prev_state = core_operations::load(mutex, boost::memory_order_relaxed);
+        return (prev_state & locked) == 0u &&
+            core_operations::compare_exchange_strong(mutex, prev_state, prev_state | locked, boost::memory_order_acquire, boost::memory_order_relaxed);
+    }
+
+    //! Locks the mutex
+    static BOOST_FORCEINLINE void lock(storage_type volatile& mutex) BOOST_NOEXCEPT
+    {
+        if (BOOST_LIKELY(try_lock(mutex)))
+            return;
+
+        lock_adaptive(mutex);
+    }
+
+    /*!
+     * \brief Locks the contended mutex, blocking if needed
+     *
+     * The number of attempts to lock the mutex before blocking adapts to the number of attempts that were needed to lock
+     * the same mutex previously, which reflects how long the mutex is typically held. The estimate is maintained by the parking lot.
+     */
+    static BOOST_NOINLINE void lock_adaptive(storage_type volatile& mutex) BOOST_NOEXCEPT
+    {
+        const unsigned int max_spin_count = parking_lot::get_adaptive_spin_count(&mutex);
+        unsigned int spin_count = 0u;
+        while (spin_count < max_spin_count)
+        {
+            atomics::detail::pause();
+            ++spin_count;
+
+            storage_type prev_state = core_operations::load(mutex, boost::memory_order_relaxed);
+            if (BOOST_LIKELY((prev_state & locked) == 0u))
+            {
+                if (BOOST_LIKELY(core_operations::compare_exchange_strong(mutex, prev_state, prev_state | locked, boost::memory_order_acquire, boost::memory_order_relaxed)))
+                {
+                    parking_lot::update_adaptive_spin_count(&mutex, spin_count, false);
+                    return;
+                }
+            }
+            else if ((prev_state & contended) != 0u)
+            {
+                // There are threads blocked on the mutex already, which means the mutex is held for long enough for spinning to be ineffective
+                break;
+            }
+        }
+
+        parking_lot::update_adaptive_spin_count(&mutex, spin_count, true);
+        lock_slow_path(mutex);
+    }
+
+    //! Locks the mutex, making at most \a max_spin_count attempts before blocking
+    static BOOST_FORCEINLINE void lock(storage_type volatile& mutex, unsigned int max_spin_count) BOOST_NOEXCEPT
+    {
+        for (unsigned int i = 0u; i < max_spin_count; ++i)
+        {
+            storage_type prev_state = core_operations::load(mutex, boost::memory_order_relaxed);
+            if (BOOST_LIKELY((prev_state & locked) == 0u))
+            {
+                if (BOOST_LIKELY(core_operations::compare_exchange_strong(mutex, prev_state, prev_state | locked, boost::memory_order_acquire, boost::memory_order_relaxed)))
+                    return;
+            }
+            else if ((prev_state & contended) != 0u)
+            {
+                // There are threads blocked on the mutex already, which means the mutex is held for long enough for spinning to be ineffective
+                break;
+            }
+
+            atomics::detail::pause();
+        }
+
+        lock_slow_path(mutex);
+    }
+
+    //! Locks the mutex, blocking if needed
+    static void lock_slow_path(storage_type volatile& mutex) BOOST_NOEXCEPT
+    {
+#if !defined(BOOST_ATOMIC_DETAIL_MUTEX_USE_FUTEX)
+        // Without futexes, unlock() cannot tell whether there are more blocked threads, so it always clears the contended bit.
+        // A thread that has been blocked sets it back when it locks the mutex, as other threads may still be blocked.
+        storage_type lock_bits = locked;
+#else
+        BOOST_CONSTEXPR_OR_CONST storage_type lock_bits = locked;
+#endif
+        storage_type prev_state = core_operations::load(mutex, boost::memory_order_relaxed);
+        while (true)
+        {
+            if (BOOST_LIKELY((prev_state & locked) == 0u))
+            {
+                storage_type new_state = prev_state | lock_bits;
+                if (BOOST_LIKELY(core_operations::compare_exchange_weak(mutex, prev_state, new_state, boost::memory_order_acquire, boost::memory_order_relaxed)))
+                    return;
+            }
+            else
+            {
+                storage_type new_state = prev_state | contended;
+                if (BOOST_LIKELY(core_operations::compare_exchange_weak(mutex, prev_state, new_state, boost::memory_order_relaxed, boost::memory_order_relaxed)))
+                {
+                    block(mutex, new_state);
+#if !defined(BOOST_ATOMIC_DETAIL_MUTEX_USE_FUTEX)
+                    lock_bits = locked | contended;
+#endif
+                    prev_state = core_operations::load(mutex, boost::memory_order_relaxed);
+                }
+            }
+        }
+    }
+
+    //! Unlocks the mutex
+    static BOOST_FORCEINLINE void unlock(storage_type volatile& mutex) BOOST_NOEXCEPT
+    {
+#if defined(BOOST_ATOMIC_DETAIL_MUTEX_USE_FUTEX)
+        // The locked bit is known to be set, so clearing it and incrementing the counter can be done with a single addition
+        const storage_type prev_state = core_operations::fetch_add(mutex, counter_one - locked, boost::memory_order_release);
+        const storage_type new_state = prev_state + (counter_one - locked);
+#else
+        storage_type prev_state = core_operations::load(mutex, boost::memory_order_relaxed);
+        storage_type new_state;
+        while (true)
+        {
+            new_state = (prev_state & ~(locked | contended)) + counter_one;
+            if (BOOST_LIKELY(core_operations::compare_exchange_weak(mutex, prev_state, new_state, boost::memory_order_release, boost::memory_order_relaxed)))
+                break;
+        }
+#endif
+
+        if ((prev_state & contended) != 0u)
+            unlock_slow_path(mutex, new_state);
+    }
+
+    //! Wakes up a thread blocked on the mutex
+    static void unlock_slow_path(storage_type volatile& mutex, storage_type new_state) BOOST_NOEXCEPT
+    {
+#if defined(BOOST_ATOMIC_DETAIL_MUTEX_USE_FUTEX)
+        if (wake_one(mutex) == 0)
+        {
+            // No threads were blocked, clear the contended bit unless the mutex state has changed
+            storage_type prev_state = new_state;
+            new_state &= ~contended;
+            core_operations::compare_exchange_strong(mutex, prev_state, new_state, boost::memory_order_relaxed, boost::memory_order_relaxed);
+        }
+#else
+        (void)new_state;
+        wake_one(mutex);
+#endif
+    }
+
+    /*!
+     * \brief Blocks on the condition variable until notified
+     *
+     * The calling thread must have locked the mutex, which is unlocked while the thread is blocked and locked again before returning.
+     * The function may return spuriously.
+     */
+    static void wait(storage_type volatile& cond, storage_type volatile& waiter_count, storage_type volatile& mutex) BOOST_NOEXCEPT
+    {
+        const storage_type prev_cond = core_operations::load(cond, boost::memory_order_seq_cst);
+        // Pairs with the load of the waiter count in notify
+        core_operations::fetch_add(waiter_count, 1u, boost::memory_order_seq_cst);
+
+        unlock(mutex);
+        block(cond, prev_cond);
+        lock(mutex);
+
+        core_operations::fetch_sub(waiter_count, 1u, boost::memory_order_relaxed);
+    }
+
+    /*!
+     * \brief Wakes up one or all threads blocked on the condition variable
+     *
+     * If \a mutex is not \c NULL, it must point to the mutex the blocked threads use. In this case, the threads are moved
+     * to the mutex and woken up as the mutex is unlocked. The calling thread need not lock the mutex.
+     */
+    static void notify(storage_type volatile& cond, storage_type volatile& waiter_count, storage_type volatile* mutex, bool all) BOOST_NOEXCEPT
+    {
+        core_operations::fetch_add(cond, 1u, boost::memory_order_seq_cst);
+        if (BOOST_LIKELY(core_operations::load(waiter_count, boost::memory_order_seq_cst) == 0u))
+            return;
+
+#if defined(BOOST_ATOMIC_DETAIL_MUTEX_USE_FUTEX)
+        if (mutex)
+        {
+            // Move blocked threads to the mutex futex and mark the mutex contended so that a thread is unblocked on unlock()
+            const unsigned int requeue_count = all ? ((~static_cast< unsigned int >(0u)) >> 1) : 1u;
+            if (Interprocess)
+                atomics::detail::futex_requeue(const_cast< storage_type* >(&cond), const_cast< storage_type* >(mutex), 0u, requeue_count);
+            else
+                atomics::detail::futex_requeue_private(const_cast< storage_type* >(&cond), const_cast< storage_type* >(mutex), 0u, requeue_count);
+
+            // If the mutex is not locked, no unlock() is pending to wake up the moved threads, so wake up one of them now
+            const storage_type prev_state = extra_operations::fetch_or(*mutex, contended, boost::memory_order_relaxed);
+            if ((prev_state & locked) == 0u)
+                wake_one(*mutex);
+
+            return;
+        }
+
+        if (Interprocess)
+        {
+            if (all)
+                atomics::detail::futex_broadcast(const_cast< storage_type* >(&cond));
+            else
+                atomics::detail::futex_signal(const_cast< storage_type* >(&cond));
+        }
+        else
+        {
+            if (all)
+                atomics::detail::futex_broadcast_private(const_cast< storage_type* >(&cond));
+            else
+                atomics::detail::futex_signal_private(const_cast< storage_type* >(&cond));
+        }
+#else // defined(BOOST_ATOMIC_DETAIL_MUTEX_USE_FUTEX)
+        (void)mutex;
+        if (all)
+            wait_operations::notify_all(cond);
+        else
+            wait_operations::notify_one(cond);
+#endif // defined(BOOST_ATOMIC_DETAIL_MUTEX_USE_FUTEX)
+    }
+
+private:
+    //! Blocks while \a storage contains \a value. May return spuriously.
+    static BOOST_FORCEINLINE void block(storage_type volatile& storage, storage_type value) BOOST_NOEXCEPT
+    {
+#if defined(BOOST_ATOMIC_DETAIL_MUTEX_USE_FUTEX)
+        if (Interprocess)
+            atomics::detail::futex_wait(const_cast< storage_type* >(&storage), value);
+        else
+            atomics::detail::futex_wait_private(const_cast< storage_type* >(&storage), value);
+#else
+        wait_operations::wait(storage, value, boost::memory_order_relaxed);
+#endif
+    }
+
+    //! Wakes up one thread blocked on \a storage. Returns the number of woken threads, or a negative value if the number is unknown.
+    static BOOST_FORCEINLINE int wake_one(storage_type volatile& storage) BOOST_NOEXCEPT
+    {
+#if defined(BOOST_ATOMIC_DETAIL_MUTEX_USE_FUTEX)
+        if (Interprocess)
+            return atomics::detail::futex_signal(const_cast< storage_type* >(&storage));
+        else
+            return atomics::detail::futex_signal_private(const_cast< storage_type* >(&storage));
+#else
+        wait_operations::notify_one(storage);
+        return -1;
+#endif
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+template< bool Interprocess >
+BOOST_CONSTEXPR_OR_CONST bool mutex_operations< Interprocess >::is_always_lock_free;
+template< bool Interprocess >
+BOOST_CONSTEXPR_OR_CONST typename mutex_operations< Interprocess >::storage_type mutex_operations< Interprocess >::locked;
+template< bool Interprocess >
+BOOST_CONSTEXPR_OR_CONST typename mutex_operations< Interprocess >::storage_type mutex_operations< Interprocess >::contended;
+template< bool Interprocess >
+BOOST_CONSTEXPR_OR_CONST typename mutex_operations< Interprocess >::storage_type mutex_operations< Interprocess >::counter_one;
+#endif
+
+} // namespace detail
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_DETAIL_MUTEX_OPERATIONS_HPP_INCLUDED_
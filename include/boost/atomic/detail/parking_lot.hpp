@@ -0,0 +1,85 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/detail/parking_lot.hpp
+ *
+ * This header contains declaration of the parking lot used to implement waiting and notifying operations without native support.
+ */
+
+#ifndef BOOST_ATOMIC_DETAIL_PARKING_LOT_HPP_INCLUDED_
+#define BOOST_ATOMIC_DETAIL_PARKING_LOT_HPP_INCLUDED_
+
+#include <cstddef>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/link.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+namespace detail {
+namespace parking_lot {
+
+/*!
+ * \brief Park validation function
+ *
+ * The function is called by \c park while the queue of threads parked on \a addr is locked. It must return \c true if the thread should block.
+ * The function must not call any parking lot functions.
+ */
+typedef bool (*validate_func)(const volatile void* addr, const void* context);
+
+/*!
+ * \brief Blocks the calling thread on \a addr until it is unparked, if \a validate returns \c true
+ *
+ * The function may return without blocking if the system is out of resources.
+ */
+BOOST_ATOMIC_DECL void park(const volatile void* addr, validate_func validate, const void* context) BOOST_NOEXCEPT;
+//! Unblocks up to \a count threads parked on \a addr in the order they were parked. Returns the number of unblocked threads.
+BOOST_ATOMIC_DECL std::size_t unpark(const volatile void* addr, std::size_t count) BOOST_NOEXCEPT;
+
+//! Request to unblock up to \c count threads parked on \c addr
+struct unpark_request
+{
+    const volatile void* addr;
+    std::size_t count;
+};
+
+/*!
+ * \brief Performs multiple unpark requests
+ *
+ * The requests are grouped so that every queue of parked threads is locked once. The addresses in the requests must be distinct.
+ * The function reorders the requests.
+ */
+BOOST_ATOMIC_DECL void unpark_multiple(unpark_request* requests, std::size_t count) BOOST_NOEXCEPT;
+
+//! Returns the number of times to poll the atomic object at \a addr before blocking with the adaptive waiting policy
+BOOST_ATOMIC_DECL unsigned int get_adaptive_spin_count(const volatile void* addr) BOOST_NOEXCEPT;
+//! Updates the adaptive spin count for \a addr with the number of times the atomic object was polled and whether the thread had to block afterwards
+BOOST_ATOMIC_DECL void update_adaptive_spin_count(const volatile void* addr, unsigned int spin_count, bool blocked) BOOST_NOEXCEPT;
+
+BOOST_FORCEINLINE void unpark_one(const volatile void* addr) BOOST_NOEXCEPT
+{
+    parking_lot::unpark(addr, 1u);
+}
+
+BOOST_FORCEINLINE void unpark_all(const volatile void* addr) BOOST_NOEXCEPT
+{
+    parking_lot::unpark(addr, ~static_cast< std::size_t >(0u));
+}
+
+} // namespace parking_lot
+} // namespace detail
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_DETAIL_PARKING_LOT_HPP_INCLUDED_
@@ -17,17 +17,24 @@
 #pragma once
 #endif
 
+// BOOST_ATOMIC_DETAIL_HAS_PAUSE is defined if pause() executes a spin loop hint instruction rather than doing nothing
 #if defined(_MSC_VER)
 #if defined(_M_AMD64) || defined(_M_IX86)
 extern "C" void _mm_pause(void);
 #if defined(BOOST_MSVC)
 #pragma intrinsic(_mm_pause)
 #endif
+#define BOOST_ATOMIC_DETAIL_HAS_PAUSE
 #elif defined(_M_ARM64) || defined(_M_ARM)
 extern "C" void __yield(void);
 #if defined(BOOST_MSVC)
 #pragma intrinsic(__yield)
 #endif
+#define BOOST_ATOMIC_DETAIL_HAS_PAUSE
+#endif
+#elif defined(__GNUC__)
+#if defined(__i386__) || defined(__x86_64__) || (defined(__ARM_ARCH) && __ARM_ARCH >= 8) || defined(__ARM_ARCH_8A__) || defined(__aarch64__)
+#define BOOST_ATOMIC_DETAIL_HAS_PAUSE
 #endif
 #endif
 
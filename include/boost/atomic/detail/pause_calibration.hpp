@@ -0,0 +1,46 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/detail/pause_calibration.hpp
+ *
+ * This header contains declaration of the runtime calibration of the pause instruction duration, which is used to size spin loops.
+ */
+
+#ifndef BOOST_ATOMIC_DETAIL_PAUSE_CALIBRATION_HPP_INCLUDED_
+#define BOOST_ATOMIC_DETAIL_PAUSE_CALIBRATION_HPP_INCLUDED_
+
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/link.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+namespace detail {
+
+//! Maximum duration of spinning on a contended lock pool mutex before blocking, in nanoseconds
+BOOST_CONSTEXPR_OR_CONST unsigned int lock_spin_duration_ns = 200u;
+//! Maximum duration of polling an atomic object in a waiting operation before yielding or blocking, in nanoseconds
+BOOST_CONSTEXPR_OR_CONST unsigned int wait_spin_duration_ns = 300u;
+
+//! Returns the duration of a spin loop iteration, i.e. the pause instruction and a relaxed load, in picoseconds. The duration is measured on the first call,
+//! unless set by the \c BOOST_ATOMIC_PAUSE_NS environment variable, and is not less than 1 nanosecond.
+BOOST_ATOMIC_DECL unsigned int get_pause_duration_ps() BOOST_NOEXCEPT;
+//! Returns the number of spin loop iterations that take approximately \a duration_ns nanoseconds to execute. The returned value is at least 1.
+BOOST_ATOMIC_DECL unsigned int get_pause_count(unsigned int duration_ns) BOOST_NOEXCEPT;
+
+} // namespace detail
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_DETAIL_PAUSE_CALIBRATION_HPP_INCLUDED_
@@ -0,0 +1,185 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/detail/per_byte_memcpy.hpp
+ *
+ * This header contains implementation of the atomic per-byte memory copying.
+ */
+
+#ifndef BOOST_ATOMIC_DETAIL_PER_BYTE_MEMCPY_HPP_INCLUDED_
+#define BOOST_ATOMIC_DETAIL_PER_BYTE_MEMCPY_HPP_INCLUDED_
+
+#include <cstddef>
+#include <boost/memory_order.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/intptr.hpp>
+#include <boost/atomic/detail/string_ops.hpp>
+#include <boost/atomic/detail/core_operations.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+// On x86, every aligned 16-byte vector access is performed as one or more accesses of at least 8 bytes each,
+// which makes it atomic per byte
+#define BOOST_ATOMIC_DETAIL_PER_BYTE_MEMCPY_SSE2
+#endif
+
+namespace boost {
+namespace atomics {
+namespace detail {
+
+typedef atomics::detail::core_operations< 1u, false, false > per_byte_memcpy_byte_operations;
+typedef atomics::detail::core_operations< sizeof(atomics::detail::uintptr_t), false, false > per_byte_memcpy_word_operations;
+
+/*!
+ * Size of the elements copied with a single atomic operation. Wider elements are only used if operations on them and on bytes
+ * are lock-free. Otherwise, different element sizes would use different locks for the same byte.
+ */
+BOOST_CONSTEXPR_OR_CONST std::size_t per_byte_memcpy_word_size =
+    (per_byte_memcpy_word_operations::is_always_lock_free && per_byte_memcpy_byte_operations::is_always_lock_free) ?
+    sizeof(per_byte_memcpy_word_operations::storage_type) : 1u;
+
+BOOST_FORCEINLINE bool is_per_byte_memcpy_aligned(const volatile void* p, std::size_t alignment) BOOST_NOEXCEPT
+{
+    return (reinterpret_cast< atomics::detail::uintptr_t >(p) & (alignment - 1u)) == 0u;
+}
+
+#if defined(BOOST_ATOMIC_DETAIL_PER_BYTE_MEMCPY_SSE2)
+
+//! The size of the block copied by a single asm statement
+BOOST_CONSTEXPR_OR_CONST std::size_t per_byte_memcpy_block_size = 64u;
+
+struct per_byte_memcpy_block
+{
+    unsigned char data[per_byte_memcpy_block_size];
+};
+
+//! Copies a block from the 16-byte aligned shared memory
+BOOST_FORCEINLINE void load_per_byte_memcpy_block(unsigned char* dest, const volatile unsigned char* src) BOOST_NOEXCEPT
+{
+    __asm__ __volatile__
+    (
+        "movdqa (%[src]), %%xmm0\n\t"
+        "movdqa 16(%[src]), %%xmm1\n\t"
+        "movdqa 32(%[src]), %%xmm2\n\t"
+        "movdqa 48(%[src]), %%xmm3\n\t"
+        "movdqu %%xmm0, (%[dest])\n\t"
+        "movdqu %%xmm1, 16(%[dest])\n\t"
+        "movdqu %%xmm2, 32(%[dest])\n\t"
+        "movdqu %%xmm3, 48(%[dest])\n\t"
+        : "=m" (*reinterpret_cast< per_byte_memcpy_block* >(dest))
+        : [src] "r" (src), [dest] "r" (dest), "m" (*reinterpret_cast< const volatile per_byte_memcpy_block* >(src))
+        : "xmm0", "xmm1", "xmm2", "xmm3"
+    );
+}
+
+//! Copies a block to the 16-byte aligned shared memory
+BOOST_FORCEINLINE void store_per_byte_memcpy_block(volatile unsigned char* dest, const unsigned char* src) BOOST_NOEXCEPT
+{
+    __asm__ __volatile__
+    (
+        "movdqu (%[src]), %%xmm0\n\t"
+        "movdqu 16(%[src]), %%xmm1\n\t"
+        "movdqu 32(%[src]), %%xmm2\n\t"
+        "movdqu 48(%[src]), %%xmm3\n\t"
+        "movdqa %%xmm0, (%[dest])\n\t"
+        "movdqa %%xmm1, 16(%[dest])\n\t"
+        "movdqa %%xmm2, 32(%[dest])\n\t"
+        "movdqa %%xmm3, 48(%[dest])\n\t"
+        : "=m" (*reinterpret_cast< volatile per_byte_memcpy_block* >(dest))
+        : [src] "r" (src), [dest] "r" (dest), "m" (*reinterpret_cast< const per_byte_memcpy_block* >(src))
+        : "xmm0", "xmm1", "xmm2", "xmm3"
+    );
+}
+
+#endif // defined(BOOST_ATOMIC_DETAIL_PER_BYTE_MEMCPY_SSE2)
+
+//! Copies \a count bytes from the shared memory at \a src, performing a relaxed atomic load of every byte
+inline void load_per_byte_memcpy(unsigned char* dest, const volatile unsigned char* src, std::size_t count) BOOST_NOEXCEPT
+{
+    typedef per_byte_memcpy_byte_operations::storage_type byte_storage_type;
+    typedef per_byte_memcpy_word_operations::storage_type word_storage_type;
+
+    BOOST_IF_CONSTEXPR (per_byte_memcpy_word_size > 1u)
+    {
+        for (; count > 0u && !atomics::detail::is_per_byte_memcpy_aligned(src, per_byte_memcpy_word_size); ++dest, ++src, --count)
+            *dest = static_cast< unsigned char >(per_byte_memcpy_byte_operations::load(*reinterpret_cast< const volatile byte_storage_type* >(src), memory_order_relaxed));
+
+#if defined(BOOST_ATOMIC_DETAIL_PER_BYTE_MEMCPY_SSE2)
+        if (count >= per_byte_memcpy_block_size + 16u)
+        {
+            for (; !atomics::detail::is_per_byte_memcpy_aligned(src, 16u); dest += per_byte_memcpy_word_size, src += per_byte_memcpy_word_size, count -= per_byte_memcpy_word_size)
+            {
+                const word_storage_type w = per_byte_memcpy_word_operations::load(*reinterpret_cast< const volatile word_storage_type* >(src), memory_order_relaxed);
+                BOOST_ATOMIC_DETAIL_MEMCPY(dest, &w, sizeof(w));
+            }
+
+            for (; count >= per_byte_memcpy_block_size; dest += per_byte_memcpy_block_size, src += per_byte_memcpy_block_size, count -= per_byte_memcpy_block_size)
+                atomics::detail::load_per_byte_memcpy_block(dest, src);
+        }
+#endif // defined(BOOST_ATOMIC_DETAIL_PER_BYTE_MEMCPY_SSE2)
+
+        for (; count >= per_byte_memcpy_word_size; dest += per_byte_memcpy_word_size, src += per_byte_memcpy_word_size, count -= per_byte_memcpy_word_size)
+        {
+            const word_storage_type w = per_byte_memcpy_word_operations::load(*reinterpret_cast< const volatile word_storage_type* >(src), memory_order_relaxed);
+            BOOST_ATOMIC_DETAIL_MEMCPY(dest, &w, sizeof(w));
+        }
+    }
+
+    for (; count > 0u; ++dest, ++src, --count)
+        *dest = static_cast< unsigned char >(per_byte_memcpy_byte_operations::load(*reinterpret_cast< const volatile byte_storage_type* >(src), memory_order_relaxed));
+}
+
+//! Copies \a count bytes to the shared memory at \a dest, performing a relaxed atomic store of every byte
+inline void store_per_byte_memcpy(volatile unsigned char* dest, const unsigned char* src, std::size_t count) BOOST_NOEXCEPT
+{
+    typedef per_byte_memcpy_byte_operations::storage_type byte_storage_type;
+    typedef per_byte_memcpy_word_operations::storage_type word_storage_type;
+
+    BOOST_IF_CONSTEXPR (per_byte_memcpy_word_size > 1u)
+    {
+        for (; count > 0u && !atomics::detail::is_per_byte_memcpy_aligned(dest, per_byte_memcpy_word_size); ++dest, ++src, --count)
+            per_byte_memcpy_byte_operations::store(*reinterpret_cast< volatile byte_storage_type* >(dest), static_cast< byte_storage_type >(*src), memory_order_relaxed);
+
+#if defined(BOOST_ATOMIC_DETAIL_PER_BYTE_MEMCPY_SSE2)
+        if (count >= per_byte_memcpy_block_size + 16u)
+        {
+            for (; !atomics::detail::is_per_byte_memcpy_aligned(dest, 16u); dest += per_byte_memcpy_word_size, src += per_byte_memcpy_word_size, count -= per_byte_memcpy_word_size)
+            {
+                word_storage_type w;
+                BOOST_ATOMIC_DETAIL_MEMCPY(&w, src, sizeof(w));
+                per_byte_memcpy_word_operations::store(*reinterpret_cast< volatile word_storage_type* >(dest), w, memory_order_relaxed);
+            }
+
+            for (; count >= per_byte_memcpy_block_size; dest += per_byte_memcpy_block_size, src += per_byte_memcpy_block_size, count -= per_byte_memcpy_block_size)
+                atomics::detail::store_per_byte_memcpy_block(dest, src);
+        }
+#endif // defined(BOOST_ATOMIC_DETAIL_PER_BYTE_MEMCPY_SSE2)
+
+        for (; count >= per_byte_memcpy_word_size; dest += per_byte_memcpy_word_size, src += per_byte_memcpy_word_size, count -= per_byte_memcpy_word_size)
+        {
+            word_storage_type w;
+            BOOST_ATOMIC_DETAIL_MEMCPY(&w, src, sizeof(w));
+            per_byte_memcpy_word_operations::store(*reinterpret_cast< volatile word_storage_type* >(dest), w, memory_order_relaxed);
+        }
+    }
+
+    for (; count > 0u; ++dest, ++src, --count)
+        per_byte_memcpy_byte_operations::store(*reinterpret_cast< volatile byte_storage_type* >(dest), static_cast< byte_storage_type >(*src), memory_order_relaxed);
+}
+
+} // namespace detail
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_DETAIL_PER_BYTE_MEMCPY_HPP_INCLUDED_
@@ -0,0 +1,92 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/detail/policy_wait.hpp
+ *
+ * This header contains implementation of waiting operations with different waiting policies.
+ */
+
+#ifndef BOOST_ATOMIC_DETAIL_POLICY_WAIT_HPP_INCLUDED_
+#define BOOST_ATOMIC_DETAIL_POLICY_WAIT_HPP_INCLUDED_
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/wait_policy.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/pause.hpp>
+#include <boost/atomic/detail/parking_lot.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+namespace detail {
+
+//! Polls the atomic object until its value changes
+template< typename Operations >
+BOOST_FORCEINLINE typename Operations::storage_type spin_wait(typename Operations::storage_type const volatile& storage, typename Operations::storage_type old_val, memory_order order) BOOST_NOEXCEPT
+{
+    typename Operations::storage_type new_val = Operations::load(storage, order);
+    while (new_val == old_val)
+    {
+        atomics::detail::pause();
+        new_val = Operations::load(storage, order);
+    }
+
+    return new_val;
+}
+
+//! Polls the atomic object for the number of times adapted to the previous waits on the same address, then blocks
+template< typename Operations >
+BOOST_NOINLINE typename Operations::storage_type adaptive_wait(typename Operations::storage_type const volatile& storage, typename Operations::storage_type old_val, memory_order order) BOOST_NOEXCEPT
+{
+    typename Operations::storage_type new_val = Operations::load(storage, order);
+    if (new_val == old_val)
+    {
+        const unsigned int max_spin_count = parking_lot::get_adaptive_spin_count(&storage);
+        unsigned int spin_count = 0u;
+        while (spin_count < max_spin_count)
+        {
+            atomics::detail::pause();
+            ++spin_count;
+            new_val = Operations::load(storage, order);
+            if (new_val != old_val)
+            {
+                parking_lot::update_adaptive_spin_count(&storage, spin_count, false);
+                return new_val;
+            }
+        }
+
+        parking_lot::update_adaptive_spin_count(&storage, spin_count, true);
+        new_val = Operations::wait(storage, old_val, order);
+    }
+
+    return new_val;
+}
+
+//! Waits for the atomic object value to change according to \a policy
+template< typename Operations >
+BOOST_FORCEINLINE typename Operations::storage_type policy_wait(typename Operations::storage_type const volatile& storage, typename Operations::storage_type old_val, memory_order order, wait_policy policy) BOOST_NOEXCEPT
+{
+    if (policy == wait_policy_spin)
+        return atomics::detail::spin_wait< Operations >(storage, old_val, order);
+    if (policy == wait_policy_adaptive)
+        return atomics::detail::adaptive_wait< Operations >(storage, old_val, order);
+
+    return Operations::wait(storage, old_val, order);
+}
+
+} // namespace detail
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_DETAIL_POLICY_WAIT_HPP_INCLUDED_
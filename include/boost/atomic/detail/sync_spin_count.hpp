@@ -0,0 +1,37 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/detail/sync_spin_count.hpp
+ *
+ * This header defines the number of spin iterations synchronization primitives perform before blocking.
+ */
+
+#ifndef BOOST_ATOMIC_DETAIL_SYNC_SPIN_COUNT_HPP_INCLUDED_
+#define BOOST_ATOMIC_DETAIL_SYNC_SPIN_COUNT_HPP_INCLUDED_
+
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+namespace detail {
+
+//! Number of times semaphores, latches and barriers check their state, pausing between the checks, before blocking
+BOOST_CONSTEXPR_OR_CONST unsigned int sync_spin_count = 16u;
+
+} // namespace detail
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_DETAIL_SYNC_SPIN_COUNT_HPP_INCLUDED_
@@ -0,0 +1,126 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/detail/tagged_ptr_operations.hpp
+ *
+ * This header contains implementation of the storage representations of \c atomic_tagged_ptr.
+ */
+
+#ifndef BOOST_ATOMIC_DETAIL_TAGGED_PTR_OPERATIONS_HPP_INCLUDED_
+#define BOOST_ATOMIC_DETAIL_TAGGED_PTR_OPERATIONS_HPP_INCLUDED_
+
+#include <cstddef>
+#include <cstdlib>
+#include <boost/assert.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/capabilities.hpp>
+#include <boost/atomic/detail/intptr.hpp>
+#include <boost/atomic/detail/bitwise_cast.hpp>
+#include <boost/atomic/detail/core_operations.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+namespace detail {
+
+//! Tagged pointer storage operations. \c Packed indicates whether the tag is packed into the unused bits of the pointer.
+template< bool Packed >
+struct tagged_ptr_operations;
+
+//! Tagged pointer storage operations that keep the pointer and the tag in a double-width atomic storage
+template< >
+struct tagged_ptr_operations< false >
+{
+    typedef atomics::detail::uintptr_t uintptr_type;
+    typedef atomics::detail::core_operations< sizeof(uintptr_type) * 2u, false, false > core_operations;
+    typedef core_operations::storage_type storage_type;
+
+    //! Number of tag bits preserved in the storage
+    static BOOST_CONSTEXPR_OR_CONST unsigned int tag_bits = sizeof(uintptr_type) * 8u;
+
+    struct value
+    {
+        uintptr_type m_ptr;
+        uintptr_type m_tag;
+    };
+
+    static BOOST_FORCEINLINE storage_type pack(uintptr_type ptr, uintptr_type tag) BOOST_NOEXCEPT
+    {
+        value v = { ptr, tag };
+        return atomics::detail::bitwise_cast< storage_type >(v);
+    }
+
+    static BOOST_FORCEINLINE uintptr_type get_ptr(storage_type const& s) BOOST_NOEXCEPT
+    {
+        return atomics::detail::bitwise_cast< value >(s).m_ptr;
+    }
+
+    static BOOST_FORCEINLINE uintptr_type get_tag(storage_type const& s) BOOST_NOEXCEPT
+    {
+        return atomics::detail::bitwise_cast< value >(s).m_tag;
+    }
+};
+
+#if defined(BOOST_ATOMIC_TAGGED_PTR_ADDRESS_BITS) && (BOOST_ATOMIC_DETAIL_SIZEOF_POINTER + 0) == 8
+
+//! Tagged pointer storage operations that pack the tag into the unused most significant bits of a 64-bit pointer
+template< >
+struct tagged_ptr_operations< true >
+{
+    typedef atomics::detail::uintptr_t uintptr_type;
+    typedef atomics::detail::core_operations< 8u, false, false > core_operations;
+    typedef core_operations::storage_type storage_type;
+
+    //! Number of tag bits preserved in the storage
+    static BOOST_CONSTEXPR_OR_CONST unsigned int tag_bits = 64u - (BOOST_ATOMIC_TAGGED_PTR_ADDRESS_BITS);
+    //! Mask of the storage bits that are occupied by the pointer
+    static BOOST_CONSTEXPR_OR_CONST storage_type address_mask = (static_cast< storage_type >(1u) << (BOOST_ATOMIC_TAGGED_PTR_ADDRESS_BITS)) - 1u;
+
+    static BOOST_FORCEINLINE storage_type pack(uintptr_type ptr, uintptr_type tag) BOOST_NOEXCEPT
+    {
+        // The check is performed in release builds as well, since storing a truncated pointer would silently corrupt it.
+        // Pointers may not fit, e.g. with 5-level paging on x86-64, if BOOST_ATOMIC_TAGGED_PTR_ADDRESS_BITS is not configured accordingly.
+        if (BOOST_UNLIKELY((static_cast< storage_type >(ptr) & ~address_mask) != 0u))
+        {
+            BOOST_ASSERT_MSG(false, "Boost.Atomic: pointer does not fit in BOOST_ATOMIC_TAGGED_PTR_ADDRESS_BITS bits");
+            std::abort();
+        }
+
+        return static_cast< storage_type >(ptr) | (static_cast< storage_type >(tag) << (BOOST_ATOMIC_TAGGED_PTR_ADDRESS_BITS));
+    }
+
+    static BOOST_FORCEINLINE uintptr_type get_ptr(storage_type s) BOOST_NOEXCEPT
+    {
+        return static_cast< uintptr_type >(s & address_mask);
+    }
+
+    static BOOST_FORCEINLINE uintptr_type get_tag(storage_type s) BOOST_NOEXCEPT
+    {
+        return static_cast< uintptr_type >(s >> (BOOST_ATOMIC_TAGGED_PTR_ADDRESS_BITS));
+    }
+};
+
+#endif // defined(BOOST_ATOMIC_TAGGED_PTR_ADDRESS_BITS) && (BOOST_ATOMIC_DETAIL_SIZEOF_POINTER + 0) == 8
+
+#if defined(BOOST_ATOMIC_DETAIL_TAGGED_PTR_PACKED)
+typedef tagged_ptr_operations< true > default_tagged_ptr_operations;
+#else
+typedef tagged_ptr_operations< false > default_tagged_ptr_operations;
+#endif
+
+} // namespace detail
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_DETAIL_TAGGED_PTR_OPERATIONS_HPP_INCLUDED_
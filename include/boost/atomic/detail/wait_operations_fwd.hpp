@@ -24,6 +24,10 @@
 
 namespace boost {
 namespace atomics {
+
+// notify_batch is granted access to the operations that unblock a given number of waiting threads
+class notify_batch;
+
 namespace detail {
 
 template<
@@ -16,6 +16,7 @@
 #define BOOST_ATOMIC_DETAIL_WAIT_OPS_DRAGONFLY_UMTX_HPP_INCLUDED_
 
 #include <unistd.h>
+#include <cstddef>
 #include <boost/memory_order.hpp>
 #include <boost/atomic/detail/config.hpp>
 #include <boost/atomic/detail/wait_operations_fwd.hpp>
@@ -64,6 +65,14 @@ struct wait_operations< Base, sizeof(int), true, Interprocess > :
     {
         ::umtx_wakeup(reinterpret_cast< int* >(const_cast< storage_type* >(&storage)), 0);
     }
+
+    static BOOST_FORCEINLINE void notify_n(storage_type volatile& storage, std::size_t count) BOOST_NOEXCEPT
+    {
+        // Zero count means all threads for umtx_wakeup
+        BOOST_CONSTEXPR_OR_CONST unsigned int max_count = (~static_cast< unsigned int >(0u)) >> 1;
+        if (count > 0u)
+            ::umtx_wakeup(reinterpret_cast< int* >(const_cast< storage_type* >(&storage)), count < max_count ? static_cast< int >(count) : 0);
+    }
 };
 
 } // namespace detail
@@ -18,7 +18,7 @@
 #include <boost/static_assert.hpp>
 #include <boost/memory_order.hpp>
 #include <boost/atomic/detail/config.hpp>
-#include <boost/atomic/detail/lock_pool.hpp>
+#include <boost/atomic/detail/parking_lot.hpp>
 #include <boost/atomic/detail/wait_operations_fwd.hpp>
 #include <boost/atomic/detail/header.hpp>
 
@@ -37,8 +37,6 @@ struct wait_operations_emulated :
 {
     typedef Base base_type;
     typedef typename base_type::storage_type storage_type;
-    typedef lock_pool::scoped_lock< base_type::storage_alignment, true > scoped_lock;
-    typedef lock_pool::scoped_wait_state< base_type::storage_alignment > scoped_wait_state;
 
     static BOOST_CONSTEXPR_OR_CONST bool always_has_native_wait_notify = false;
 
@@ -52,16 +50,14 @@ struct wait_operations_emulated :
     // In some cases, when this function is inlined, MSVC-8 (VS2005) x64 generates broken code that returns a bogus value from this function.
     BOOST_NOINLINE
 #endif
-    storage_type wait(storage_type const volatile& storage, storage_type old_val, memory_order) BOOST_NOEXCEPT
+    storage_type wait(storage_type const volatile& storage, storage_type old_val, memory_order order) BOOST_NOEXCEPT
     {
         BOOST_STATIC_ASSERT_MSG(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
-        storage_type const& s = const_cast< storage_type const& >(storage);
-        scoped_wait_state wait_state(&storage);
-        storage_type new_val = s;
+        storage_type new_val = base_type::load(storage, order);
         while (new_val == old_val)
         {
-            wait_state.wait();
-            new_val = s;
+            parking_lot::park(&storage, &wait_operations_emulated::is_unchanged, &old_val);
+            new_val = base_type::load(storage, order);
         }
 
         return new_val;
@@ -70,15 +66,26 @@ struct wait_operations_emulated :
     static void notify_one(storage_type volatile& storage) BOOST_NOEXCEPT
     {
         BOOST_STATIC_ASSERT_MSG(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
-        scoped_lock lock(&storage);
-        lock_pool::notify_one(lock.get_lock_state(), &storage);
+        parking_lot::unpark_one(&storage);
     }
 
     static void notify_all(storage_type volatile& storage) BOOST_NOEXCEPT
     {
         BOOST_STATIC_ASSERT_MSG(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
-        scoped_lock lock(&storage);
-        lock_pool::notify_all(lock.get_lock_state(), &storage);
+        parking_lot::unpark_all(&storage);
+    }
+
+    static void notify_n(storage_type volatile& storage, std::size_t count) BOOST_NOEXCEPT
+    {
+        BOOST_STATIC_ASSERT_MSG(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
+        parking_lot::unpark(&storage, count);
+    }
+
+private:
+    //! Park validation function. Returns \c true if the atomic object still has the value the thread is waiting to change.
+    static bool is_unchanged(const volatile void* addr, const void* context) BOOST_NOEXCEPT
+    {
+        return base_type::load(*static_cast< storage_type const volatile* >(addr), boost::memory_order_relaxed) == *static_cast< const storage_type* >(context);
     }
 };
 
@@ -57,6 +57,12 @@ struct wait_operations_freebsd_umtx_common :
     {
         ::_umtx_op(const_cast< storage_type* >(&storage), UMTX_OP_WAKE, (~static_cast< unsigned int >(0u)) >> 1, NULL, NULL);
     }
+
+    static BOOST_FORCEINLINE void notify_n(storage_type volatile& storage, std::size_t count) BOOST_NOEXCEPT
+    {
+        BOOST_CONSTEXPR_OR_CONST unsigned int max_count = (~static_cast< unsigned int >(0u)) >> 1;
+        ::_umtx_op(const_cast< storage_type* >(&storage), UMTX_OP_WAKE, count < max_count ? static_cast< unsigned int >(count) : max_count, NULL, NULL);
+    }
 };
 
 #endif // defined(UMTX_OP_WAIT_UINT) || defined(UMTX_OP_WAIT)
@@ -14,6 +14,7 @@
 #ifndef BOOST_ATOMIC_DETAIL_WAIT_OPS_FUTEX_HPP_INCLUDED_
 #define BOOST_ATOMIC_DETAIL_WAIT_OPS_FUTEX_HPP_INCLUDED_
 
+#include <cstddef>
 #include <boost/memory_order.hpp>
 #include <boost/atomic/detail/config.hpp>
 #include <boost/atomic/detail/futex.hpp>
@@ -63,6 +64,12 @@ struct wait_operations< Base, 4u, true, false > :
     {
         atomics::detail::futex_broadcast_private(const_cast< storage_type* >(&storage));
     }
+
+    static BOOST_FORCEINLINE void notify_n(storage_type volatile& storage, std::size_t count) BOOST_NOEXCEPT
+    {
+        BOOST_CONSTEXPR_OR_CONST unsigned int max_count = (~static_cast< unsigned int >(0u)) >> 1;
+        atomics::detail::futex_signal_private(const_cast< storage_type* >(&storage), count < max_count ? static_cast< unsigned int >(count) : max_count);
+    }
 };
 
 template< typename Base >
@@ -100,6 +107,12 @@ struct wait_operations< Base, 4u, true, true > :
     {
         atomics::detail::futex_broadcast(const_cast< storage_type* >(&storage));
     }
+
+    static BOOST_FORCEINLINE void notify_n(storage_type volatile& storage, std::size_t count) BOOST_NOEXCEPT
+    {
+        BOOST_CONSTEXPR_OR_CONST unsigned int max_count = (~static_cast< unsigned int >(0u)) >> 1;
+        atomics::detail::futex_signal(const_cast< storage_type* >(&storage), count < max_count ? static_cast< unsigned int >(count) : max_count);
+    }
 };
 
 } // namespace detail
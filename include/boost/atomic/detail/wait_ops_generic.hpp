@@ -18,7 +18,9 @@
 #include <boost/memory_order.hpp>
 #include <boost/atomic/detail/config.hpp>
 #include <boost/atomic/detail/pause.hpp>
+#include <boost/atomic/detail/pause_calibration.hpp>
 #include <boost/atomic/detail/lock_pool.hpp>
+#include <boost/atomic/detail/parking_lot.hpp>
 #include <boost/atomic/detail/wait_operations_fwd.hpp>
 #include <boost/atomic/detail/header.hpp>
 
@@ -40,8 +42,6 @@ struct wait_operations_generic< Base, false > :
 {
     typedef Base base_type;
     typedef typename base_type::storage_type storage_type;
-    typedef lock_pool::scoped_lock< base_type::storage_alignment, true > scoped_lock;
-    typedef lock_pool::scoped_wait_state< base_type::storage_alignment > scoped_wait_state;
 
     static BOOST_CONSTEXPR_OR_CONST bool always_has_native_wait_notify = false;
 
@@ -53,15 +53,10 @@ struct wait_operations_generic< Base, false > :
     static BOOST_FORCEINLINE storage_type wait(storage_type const volatile& storage, storage_type old_val, memory_order order) BOOST_NOEXCEPT
     {
         storage_type new_val = base_type::load(storage, order);
-        if (new_val == old_val)
+        while (new_val == old_val)
         {
-            scoped_wait_state wait_state(&storage);
+            parking_lot::park(&storage, &wait_operations_generic::is_unchanged, &old_val);
             new_val = base_type::load(storage, order);
-            while (new_val == old_val)
-            {
-                wait_state.wait();
-                new_val = base_type::load(storage, order);
-            }
         }
 
         return new_val;
@@ -69,14 +64,24 @@ struct wait_operations_generic< Base, false > :
 
     static BOOST_FORCEINLINE void notify_one(storage_type volatile& storage) BOOST_NOEXCEPT
     {
-        scoped_lock lock(&storage);
-        lock_pool::notify_one(lock.get_lock_state(), &storage);
+        parking_lot::unpark_one(&storage);
     }
 
     static BOOST_FORCEINLINE void notify_all(storage_type volatile& storage) BOOST_NOEXCEPT
     {
-        scoped_lock lock(&storage);
-        lock_pool::notify_all(lock.get_lock_state(), &storage);
+        parking_lot::unpark_all(&storage);
+    }
+
+    static BOOST_FORCEINLINE void notify_n(storage_type volatile& storage, std::size_t count) BOOST_NOEXCEPT
+    {
+        parking_lot::unpark(&storage, count);
+    }
+
+private:
+    //! Park validation function. Returns \c true if the atomic object still has the value the thread is waiting to change.
+    static bool is_unchanged(const volatile void* addr, const void* context) BOOST_NOEXCEPT
+    {
+        return base_type::load(*static_cast< storage_type const volatile* >(addr), boost::memory_order_relaxed) == *static_cast< const storage_type* >(context);
     }
 };
 
@@ -99,7 +104,7 @@ struct wait_operations_generic< Base, true > :
         storage_type new_val = base_type::load(storage, order);
         if (new_val == old_val)
         {
-            for (unsigned int i = 0u; i < 16u; ++i)
+            for (unsigned int i = 0u, n = atomics::detail::get_pause_count(atomics::detail::wait_spin_duration_ns); i < n; ++i)
             {
                 atomics::detail::pause();
                 new_val = base_type::load(storage, order);
@@ -126,6 +131,10 @@ struct wait_operations_generic< Base, true > :
     static BOOST_FORCEINLINE void notify_all(storage_type volatile&) BOOST_NOEXCEPT
     {
     }
+
+    static BOOST_FORCEINLINE void notify_n(storage_type volatile&, std::size_t) BOOST_NOEXCEPT
+    {
+    }
 };
 
 template< typename Base, std::size_t Size, bool Interprocess >
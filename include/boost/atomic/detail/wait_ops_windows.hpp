@@ -115,6 +115,22 @@ struct wait_operations_windows :
         else
             base_type::notify_all(storage);
     }
+
+    static BOOST_FORCEINLINE void notify_n(storage_type volatile& storage, std::size_t count) BOOST_NOEXCEPT
+    {
+        ensure_wait_functions_initialized();
+
+        if (BOOST_LIKELY(atomics::detail::wake_by_address_single != NULL))
+        {
+            // There is no API for waking a given number of threads
+            for (; count > 0u; --count)
+                atomics::detail::wake_by_address_single(const_cast< storage_type* >(&storage));
+        }
+        else
+        {
+            base_type::notify_n(storage, count);
+        }
+    }
 };
 
 template< typename Base >
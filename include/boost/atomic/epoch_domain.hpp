@@ -0,0 +1,397 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/epoch_domain.hpp
+ *
+ * This header contains definition of \c basic_epoch_domain, \c epoch_domain and \c ipc_epoch_domain,
+ * which implement epoch-based memory reclamation for lock-free data structures.
+ */
+
+#ifndef BOOST_ATOMIC_EPOCH_DOMAIN_HPP_INCLUDED_
+#define BOOST_ATOMIC_EPOCH_DOMAIN_HPP_INCLUDED_
+
+#include <cstddef>
+#include <vector>
+#include <stdexcept>
+#include <boost/assert.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/memory_order.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/ipc_atomic.hpp>
+#include <boost/atomic/fences.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/lock_pool.hpp>
+#include <boost/atomic/detail/cache_line_size.hpp>
+#include <boost/atomic/detail/type_traits/conditional.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+
+/*!
+ * \brief Epoch-based reclamation domain
+ *
+ * The domain consists of the global epoch counter and a fixed number of participant slots, each on a separate cache line.
+ * Participants announce the global epoch they observe when they enter a critical section (pin) and retire objects
+ * into process-local deferred lists. The global epoch can only be advanced when all pinned participants have observed
+ * the current epoch. Objects retired by a participant pinned in epoch \c E are reclaimed once the global epoch reaches
+ * <tt>E + 3</tt>, at which point no participant can be accessing them, as other participants may have pinned in epoch
+ * <tt>E + 1</tt> before the objects were made unreachable.
+ *
+ * When \c Interprocess is \c true, the domain only uses IPC atomic types and contains no pointers, so it can be placed
+ * in memory shared between processes. Deferred lists are always process-local.
+ */
+template< bool Interprocess, std::size_t MaxParticipants >
+class basic_epoch_domain
+{
+    BOOST_STATIC_ASSERT_MSG(MaxParticipants > 0u, "Boost.Atomic: epoch domain must support at least one participant");
+
+public:
+    //! Epoch counter type
+    typedef unsigned int epoch_type;
+
+    //! Maximum number of participants that can be registered in the domain at the same time
+    static BOOST_CONSTEXPR_OR_CONST std::size_t max_participants = MaxParticipants;
+
+    class participant;
+    class guard;
+
+private:
+    typedef typename atomics::detail::conditional< Interprocess, atomics::ipc_atomic< epoch_type >, atomics::atomic< epoch_type > >::type atomic_epoch_type;
+    typedef typename atomics::detail::conditional< Interprocess, atomics::ipc_atomic< bool >, atomics::atomic< bool > >::type atomic_bool_type;
+
+    //! Participant state value that indicates the participant is not pinned. Otherwise, the state is the announced epoch shifted left by one with the least significant bit set.
+    static BOOST_CONSTEXPR_OR_CONST epoch_type unpinned_state = 0u;
+
+    //! Participant slot
+    struct BOOST_ALIGNMENT(BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE) slot
+    {
+        //! Participant state
+        atomic_epoch_type m_state;
+        //! The flag indicates that the slot is used by a participant
+        atomic_bool_type m_in_use;
+
+        slot() BOOST_NOEXCEPT : m_state(unpinned_state), m_in_use(false)
+        {
+        }
+    };
+
+private:
+    //! Global epoch
+    atomic_epoch_type m_epoch;
+    // The padding prevents false sharing between the global epoch and participant slots
+    char m_padding[BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE];
+    //! Participant slots
+    slot m_slots[MaxParticipants];
+
+public:
+    basic_epoch_domain() BOOST_NOEXCEPT : m_epoch(0u)
+    {
+    }
+
+    //! Returns the current global epoch
+    epoch_type epoch() const BOOST_NOEXCEPT
+    {
+        return m_epoch.load(memory_order_relaxed);
+    }
+
+    //! Attempts to advance the global epoch. Returns the global epoch after the attempt.
+    epoch_type try_advance() BOOST_NOEXCEPT
+    {
+        epoch_type epoch = m_epoch.load(memory_order_relaxed);
+        // Order the load above with the participants' state loads below. Pairs with the fence in participant::pin.
+        atomics::atomic_thread_fence(memory_order_seq_cst);
+
+        const epoch_type pinned_state = make_pinned_state(epoch);
+        for (std::size_t i = 0u; i < MaxParticipants; ++i)
+        {
+            const epoch_type state = m_slots[i].m_state.load(memory_order_relaxed);
+            if (state != unpinned_state && state != pinned_state)
+                return epoch;
+        }
+
+        // Make sure the critical sections of the participants that were pinned in the previous epochs happen before the epoch is advanced
+        atomics::atomic_thread_fence(memory_order_acquire);
+        if (m_epoch.compare_exchange_strong(epoch, epoch + 1u, memory_order_release, memory_order_relaxed))
+            ++epoch;
+
+        return epoch;
+    }
+
+    BOOST_DELETED_FUNCTION(basic_epoch_domain(basic_epoch_domain const&))
+    BOOST_DELETED_FUNCTION(basic_epoch_domain& operator= (basic_epoch_domain const&))
+
+private:
+    static BOOST_FORCEINLINE epoch_type make_pinned_state(epoch_type epoch) BOOST_NOEXCEPT
+    {
+        return static_cast< epoch_type >(epoch << 1u) | 1u;
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+template< bool Interprocess, std::size_t MaxParticipants >
+BOOST_CONSTEXPR_OR_CONST std::size_t basic_epoch_domain< Interprocess, MaxParticipants >::max_participants;
+template< bool Interprocess, std::size_t MaxParticipants >
+BOOST_CONSTEXPR_OR_CONST typename basic_epoch_domain< Interprocess, MaxParticipants >::epoch_type basic_epoch_domain< Interprocess, MaxParticipants >::unpinned_state;
+#endif
+
+/*!
+ * \brief Epoch domain participant
+ *
+ * A participant occupies a slot in the domain for its lifetime. A participant must only be used by one thread at a time.
+ * It keeps the process-local lists of retired objects, which are reclaimed when the global epoch advances.
+ */
+template< bool Interprocess, std::size_t MaxParticipants >
+class basic_epoch_domain< Interprocess, MaxParticipants >::participant
+{
+public:
+    //! Function that reclaims a retired object
+    typedef void reclaim_func_t(void*);
+
+private:
+    //! Retired object
+    struct retired
+    {
+        void* m_ptr;
+        reclaim_func_t* m_reclaim;
+    };
+
+    //! List of objects retired in the same epoch
+    struct retired_list
+    {
+        epoch_type m_epoch;
+        std::vector< retired > m_objects;
+    };
+
+    //! Number of retired objects that triggers an attempt to advance the global epoch and reclaim objects
+    static BOOST_CONSTEXPR_OR_CONST std::size_t collect_threshold = 64u;
+
+private:
+    basic_epoch_domain& m_domain;
+    slot* m_slot;
+    //! Pin nesting counter
+    std::size_t m_pin_count;
+    //! The global epoch observed when the participant was pinned
+    epoch_type m_pinned_epoch;
+    //! Total number of objects in the retired lists
+    std::size_t m_retired_count;
+    //! Retired lists for the last three epochs
+    retired_list m_retired[3];
+
+public:
+    //! Registers the participant in the domain. Throws \c std::length_error if all slots are in use.
+    explicit participant(basic_epoch_domain& domain) : m_domain(domain), m_slot(NULL), m_pin_count(0u), m_pinned_epoch(0u), m_retired_count(0u)
+    {
+        for (std::size_t i = 0u; i < MaxParticipants; ++i)
+        {
+            slot& s = domain.m_slots[i];
+            if (!s.m_in_use.load(memory_order_relaxed) && !s.m_in_use.exchange(true, memory_order_acquire))
+            {
+                m_slot = &s;
+                break;
+            }
+        }
+
+        if (BOOST_UNLIKELY(m_slot == NULL))
+            boost::throw_exception(std::length_error("Boost.Atomic: no free participant slots in the epoch domain"));
+
+        for (unsigned int i = 0u; i < 3u; ++i)
+            m_retired[i].m_epoch = 0u;
+    }
+
+    //! Unregisters the participant. Blocks until all retired objects are reclaimed.
+    ~participant()
+    {
+        BOOST_ASSERT_MSG(m_pin_count == 0u, "Boost.Atomic: epoch domain participant destroyed while pinned");
+        synchronize();
+        m_slot->m_in_use.store(false, memory_order_release);
+    }
+
+    //! Returns \c true if the participant is pinned
+    bool is_pinned() const BOOST_NOEXCEPT
+    {
+        return m_pin_count > 0u;
+    }
+
+    //! Enters a critical section. Pins may be nested.
+    void pin() BOOST_NOEXCEPT
+    {
+        if (m_pin_count++ == 0u)
+        {
+            m_pinned_epoch = m_domain.m_epoch.load(memory_order_relaxed);
+            m_slot->m_state.store(make_pinned_state(m_pinned_epoch), memory_order_relaxed);
+            // Order the store above before any loads in the critical section. Pairs with the fence in basic_epoch_domain::try_advance.
+            atomics::atomic_thread_fence(memory_order_seq_cst);
+        }
+    }
+
+    //! Leaves a critical section
+    void unpin() BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT(m_pin_count > 0u);
+        if (--m_pin_count == 0u)
+            m_slot->m_state.store(unpinned_state, memory_order_release);
+    }
+
+    /*!
+     * \brief Retires an object
+     *
+     * The participant must be pinned and the object must have been made unreachable for other participants prior to the call.
+     * \a reclaim will be called with \a ptr once no participant can be accessing the object.
+     */
+    void retire(void* ptr, reclaim_func_t* reclaim)
+    {
+        BOOST_ASSERT_MSG(m_pin_count > 0u, "Boost.Atomic: objects must be retired while the epoch domain participant is pinned");
+
+        // While this participant is pinned, the global epoch may advance by one past the epoch it announced, and other participants
+        // may pin in that epoch and obtain a pointer to the object before it was made unreachable. Tag the object with that epoch,
+        // so that it is only reclaimed after the global epoch advances twice past it, when all such participants have unpinned.
+        const epoch_type epoch = m_pinned_epoch + 1u;
+        retired_list* list = NULL;
+        for (unsigned int i = 0u; i < 3u; ++i)
+        {
+            if (m_retired[i].m_epoch == epoch && !m_retired[i].m_objects.empty())
+            {
+                list = &m_retired[i];
+                break;
+            }
+        }
+
+        if (!list)
+        {
+            // The global epoch is at least the pinned epoch, so besides the list for the current tag, at most two lists may contain
+            // objects that are not safe to reclaim yet: the ones tagged with the pinned epoch and the epoch before it
+            for (unsigned int i = 0u; i < 3u; ++i)
+            {
+                retired_list& l = m_retired[i];
+                if (l.m_objects.empty() || is_reclaimable(m_pinned_epoch, l.m_epoch))
+                {
+                    reclaim_list(l);
+                    l.m_epoch = epoch;
+                    list = &l;
+                    break;
+                }
+            }
+
+            BOOST_ASSERT(list != NULL);
+        }
+
+        retired r = { ptr, reclaim };
+        list->m_objects.push_back(r);
+        ++m_retired_count;
+
+        if (m_retired_count >= collect_threshold)
+            collect();
+    }
+
+    //! Attempts to advance the global epoch and reclaims the objects that are tagged with an epoch at least two epochs ago
+    void collect()
+    {
+        const epoch_type epoch = m_domain.try_advance();
+        for (unsigned int i = 0u; i < 3u; ++i)
+        {
+            retired_list& list = m_retired[i];
+            if (is_reclaimable(epoch, list.m_epoch))
+                reclaim_list(list);
+        }
+    }
+
+    //! Returns the number of retired objects that are not reclaimed yet
+    std::size_t retired_count() const BOOST_NOEXCEPT
+    {
+        return m_retired_count;
+    }
+
+    //! Blocks until all objects retired by this participant are reclaimed. The participant must not be pinned.
+    void synchronize()
+    {
+        BOOST_ASSERT(m_pin_count == 0u);
+        while (true)
+        {
+            collect();
+            if (m_retired_count == 0u)
+                break;
+
+            atomics::detail::wait_some();
+        }
+    }
+
+    BOOST_DELETED_FUNCTION(participant(participant const&))
+    BOOST_DELETED_FUNCTION(participant& operator= (participant const&))
+
+private:
+    //! Returns \c true if the objects tagged with \a tag can be reclaimed when the global epoch is \a epoch
+    static bool is_reclaimable(epoch_type epoch, epoch_type tag) BOOST_NOEXCEPT
+    {
+        // The tag may be one past the global epoch if the epoch has not advanced since the objects were retired
+        return static_cast< epoch_type >(tag - epoch) != 1u && static_cast< epoch_type >(epoch - tag) >= 2u;
+    }
+
+    void reclaim_list(retired_list& list)
+    {
+        // Swap the list out first as reclaim functions may retire more objects
+        std::vector< retired > objects;
+        objects.swap(list.m_objects);
+        m_retired_count -= objects.size();
+        for (typename std::vector< retired >::const_iterator it = objects.begin(), end = objects.end(); it != end; ++it)
+            it->m_reclaim(it->m_ptr);
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+template< bool Interprocess, std::size_t MaxParticipants >
+BOOST_CONSTEXPR_OR_CONST std::size_t basic_epoch_domain< Interprocess, MaxParticipants >::participant::collect_threshold;
+#endif
+
+//! Scope guard that pins the participant on construction and unpins on destruction
+template< bool Interprocess, std::size_t MaxParticipants >
+class basic_epoch_domain< Interprocess, MaxParticipants >::guard
+{
+private:
+    participant& m_participant;
+
+public:
+    explicit guard(participant& p) BOOST_NOEXCEPT : m_participant(p)
+    {
+        p.pin();
+    }
+
+    ~guard()
+    {
+        m_participant.unpin();
+    }
+
+    BOOST_DELETED_FUNCTION(guard(guard const&))
+    BOOST_DELETED_FUNCTION(guard& operator= (guard const&))
+};
+
+#if !defined(BOOST_ATOMIC_EPOCH_DOMAIN_MAX_PARTICIPANTS)
+#define BOOST_ATOMIC_EPOCH_DOMAIN_MAX_PARTICIPANTS 64
+#endif
+
+//! Epoch-based reclamation domain for inter-thread communication
+typedef basic_epoch_domain< false, BOOST_ATOMIC_EPOCH_DOMAIN_MAX_PARTICIPANTS > epoch_domain;
+//! Epoch-based reclamation domain for inter-process communication
+typedef basic_epoch_domain< true, BOOST_ATOMIC_EPOCH_DOMAIN_MAX_PARTICIPANTS > ipc_epoch_domain;
+
+} // namespace atomics
+
+using atomics::basic_epoch_domain;
+using atomics::epoch_domain;
+using atomics::ipc_epoch_domain;
+
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_EPOCH_DOMAIN_HPP_INCLUDED_
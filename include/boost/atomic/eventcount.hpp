@@ -0,0 +1,156 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/eventcount.hpp
+ *
+ * This header contains definition of \c eventcount, a primitive for adding blocking to lock-free algorithms.
+ */
+
+#ifndef BOOST_ATOMIC_EVENTCOUNT_HPP_INCLUDED_
+#define BOOST_ATOMIC_EVENTCOUNT_HPP_INCLUDED_
+
+#include <boost/assert.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/wait_policy.hpp>
+#include <boost/atomic/fences.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+
+/*!
+ * \brief Eventcount
+ *
+ * The eventcount allows to block threads until a condition on a lock-free data structure becomes \c true, without adding
+ * system calls to the non-blocking paths. A waiting thread announces the intention to wait with \c prepare_wait, checks
+ * the condition and then either calls \c cancel_wait, if the condition is \c true, or \c commit_wait to block. A notifying thread
+ * modifies the data structure and calls \c notify_one or \c notify_all, which only perform an atomic load if there are no waiters.
+ *
+ * The state consists of two 32-bit atomics: the number of waiters and the epoch, which is incremented by notifying operations
+ * when there are waiters. Blocking is implemented with waiting and notifying operations on the epoch, which use futexes or similar
+ * native operations where available and the lock pool otherwise. A thread that prepared to wait may miss notifications only if
+ * the number of notifying operations issued with waiters before it blocks in \c commit_wait is a non-zero multiple of 2^32.
+ */
+class eventcount
+{
+public:
+    //! The key identifies the epoch in which the thread prepared to wait
+    class key
+    {
+        friend class eventcount;
+
+    private:
+        boost::uint32_t m_epoch;
+
+        explicit key(boost::uint32_t epoch) BOOST_NOEXCEPT : m_epoch(epoch)
+        {
+        }
+    };
+
+private:
+    //! Number of threads that prepared to wait and have not cancelled or completed waiting
+    atomics::atomic< boost::uint32_t > m_waiters;
+    //! Epoch of notifications. Threads block on this atomic, so that changes of the waiter count do not interfere with blocking.
+    atomics::atomic< boost::uint32_t > m_epoch;
+
+public:
+    BOOST_ATOMIC_DETAIL_CONSTEXPR_UNION_INIT eventcount() BOOST_NOEXCEPT : m_waiters(0u), m_epoch(0u)
+    {
+    }
+
+    /*!
+     * \brief Prepares the calling thread to wait
+     *
+     * After this call, the thread must check the condition it intends to wait for and call either \c cancel_wait or \c commit_wait
+     * with the returned key. Notifications issued after this call will unblock \c commit_wait.
+     */
+    key prepare_wait() BOOST_NOEXCEPT
+    {
+        // Pairs with the fence in notify. Either the notifying thread observes the waiter, or the caller observes the modification of the condition.
+        const boost::uint32_t prev_waiters = m_waiters.fetch_add(1u, boost::memory_order_seq_cst);
+        BOOST_ASSERT_MSG(prev_waiters != ~static_cast< boost::uint32_t >(0u), "Boost.Atomic: eventcount waiter count overflow");
+        (void)prev_waiters;
+        // If the epoch has already been incremented by a notification that observed the waiter, the load also makes
+        // the modification of the condition visible to the caller
+        return key(m_epoch.load(boost::memory_order_seq_cst));
+    }
+
+    //! Cancels the wait prepared with \c prepare_wait
+    void cancel_wait() BOOST_NOEXCEPT
+    {
+        m_waiters.opaque_sub(1u, boost::memory_order_relaxed);
+    }
+
+    //! Blocks until a notification is issued after the \c prepare_wait call that returned \a k, waiting according to \a policy
+    void commit_wait(key k, wait_policy policy = wait_policy_park) BOOST_NOEXCEPT
+    {
+        boost::uint32_t epoch = m_epoch.load(boost::memory_order_acquire);
+        while (epoch == k.m_epoch)
+            epoch = m_epoch.wait(epoch, boost::memory_order_acquire, policy);
+
+        m_waiters.opaque_sub(1u, boost::memory_order_relaxed);
+    }
+
+    /*!
+     * \brief Unblocks one waiting thread
+     *
+     * Must be called after the condition the waiting threads wait for is made \c true.
+     */
+    void notify_one() BOOST_NOEXCEPT
+    {
+        notify(false);
+    }
+
+    /*!
+     * \brief Unblocks all waiting threads
+     *
+     * Must be called after the condition the waiting threads wait for is made \c true.
+     */
+    void notify_all() BOOST_NOEXCEPT
+    {
+        notify(true);
+    }
+
+    BOOST_DELETED_FUNCTION(eventcount(eventcount const&))
+    BOOST_DELETED_FUNCTION(eventcount& operator= (eventcount const&))
+
+private:
+    BOOST_FORCEINLINE void notify(bool all) BOOST_NOEXCEPT
+    {
+        // Orders the modification of the condition made by the caller before the load of the waiter count, pairs with prepare_wait.
+        // Without it, the load could miss a waiter that missed the modification.
+        atomics::atomic_thread_fence(boost::memory_order_seq_cst);
+        if (BOOST_LIKELY(m_waiters.load(boost::memory_order_relaxed) == 0u))
+            return;
+
+        notify_slow_path(all);
+    }
+
+    void notify_slow_path(bool all) BOOST_NOEXCEPT
+    {
+        m_epoch.opaque_add(1u, boost::memory_order_release);
+        if (all)
+            m_epoch.notify_all();
+        else
+            m_epoch.notify_one();
+    }
+};
+
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_EVENTCOUNT_HPP_INCLUDED_
@@ -0,0 +1,313 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/hazard_pointer.hpp
+ *
+ * This header contains definition of \c hazard_pointer_domain, \c hazard_pointer and \c hazard_pointer_obj_base,
+ * which implement safe memory reclamation for lock-free data structures.
+ */
+
+#ifndef BOOST_ATOMIC_HAZARD_POINTER_HPP_INCLUDED_
+#define BOOST_ATOMIC_HAZARD_POINTER_HPP_INCLUDED_
+
+#include <cstddef>
+#include <new>
+#include <boost/assert.hpp>
+#include <boost/memory_order.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/link.hpp>
+#include <boost/atomic/detail/cache_line_size.hpp>
+#include <boost/atomic/detail/asymmetric_fence.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+
+class hazard_pointer_domain;
+
+namespace detail {
+
+//! Hazard pointer slot. Slots are allocated by the domain on separate cache lines.
+struct hazard_pointer_record
+{
+    //! Pointer to the protected object
+    atomics::atomic< const void* > m_ptr;
+    //! The flag indicates that the slot is owned by a \c hazard_pointer object
+    atomics::atomic< bool > m_active;
+    //! Next slot in the domain. Immutable after the slot is published.
+    hazard_pointer_record* m_next;
+};
+
+//! Retired object list node, which is embedded into every object that supports hazard pointer protection
+struct hazard_pointer_retired
+{
+    typedef void reclaim_func_t(hazard_pointer_retired*);
+
+    //! Next node in the list of retired objects
+    hazard_pointer_retired* m_next;
+    //! Pointer to the retired object, as stored in hazard pointers
+    const void* m_ptr;
+    //! Function that reclaims the retired object
+    reclaim_func_t* m_reclaim;
+};
+
+//! Default deleter for hazard pointer protected objects
+template< typename T >
+struct hazard_pointer_default_deleter
+{
+    void operator() (T* p) const
+    {
+        delete p;
+    }
+};
+
+} // namespace detail
+
+/*!
+ * \brief Hazard pointer domain
+ *
+ * The domain owns hazard pointer slots and the list of retired objects. Retired objects are scanned in batches,
+ * once the number of retired objects exceeds a threshold proportional to the number of hazard pointer slots.
+ * Objects that are not protected by any hazard pointer at the time of the scan are reclaimed.
+ */
+class hazard_pointer_domain
+{
+    friend class hazard_pointer;
+    template< typename, typename >
+    friend class hazard_pointer_obj_base;
+
+private:
+    //! List of hazard pointer slots
+    atomics::atomic< atomics::detail::hazard_pointer_record* > m_records;
+    //! Number of hazard pointer slots
+    atomics::atomic< std::size_t > m_record_count;
+    //! The flag indicates that asymmetric fences are natively supported
+    bool m_native_fences;
+
+    // The padding separates the rarely modified members above, which are read on the hazard pointer protection path,
+    // from the list of retired objects, which is frequently modified
+    char m_padding[BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE];
+    //! List of retired objects
+    atomics::atomic< atomics::detail::hazard_pointer_retired* > m_retired;
+    //! Number of retired objects
+    atomics::atomic< std::size_t > m_retired_count;
+
+public:
+    BOOST_ATOMIC_DECL hazard_pointer_domain() BOOST_NOEXCEPT;
+    //! Reclaims all retired objects. No hazard pointers must be associated with the domain at this point.
+    BOOST_ATOMIC_DECL ~hazard_pointer_domain();
+
+    //! Scans the retired objects and reclaims the ones that are not protected by hazard pointers
+    BOOST_ATOMIC_DECL void cleanup() BOOST_NOEXCEPT;
+
+    BOOST_DELETED_FUNCTION(hazard_pointer_domain(hazard_pointer_domain const&))
+    BOOST_DELETED_FUNCTION(hazard_pointer_domain& operator= (hazard_pointer_domain const&))
+
+private:
+    //! Acquires a hazard pointer slot. Returns \c NULL if memory allocation fails.
+    BOOST_ATOMIC_DECL atomics::detail::hazard_pointer_record* acquire_record() BOOST_NOEXCEPT;
+    //! Releases the hazard pointer slot
+    BOOST_ATOMIC_DECL void release_record(atomics::detail::hazard_pointer_record* rec) BOOST_NOEXCEPT;
+    //! Adds the object to the list of retired objects and scans the list, if needed
+    BOOST_ATOMIC_DECL void retire(atomics::detail::hazard_pointer_retired* obj) BOOST_NOEXCEPT;
+};
+
+//! Returns the default hazard pointer domain
+BOOST_ATOMIC_DECL hazard_pointer_domain& hazard_pointer_default_domain() BOOST_NOEXCEPT;
+
+/*!
+ * \brief Hazard pointer
+ *
+ * A non-empty hazard pointer owns a slot in a hazard pointer domain. The object, which pointer is stored in the slot,
+ * will not be reclaimed by the domain while the pointer is stored.
+ */
+class hazard_pointer
+{
+private:
+    atomics::detail::hazard_pointer_record* m_record;
+    hazard_pointer_domain* m_domain;
+
+public:
+    //! Constructs an empty hazard pointer
+    BOOST_CONSTEXPR hazard_pointer() BOOST_NOEXCEPT : m_record(NULL), m_domain(NULL)
+    {
+    }
+
+    //! Constructs a hazard pointer owning a slot in the given domain. Throws \c std::bad_alloc if the slot cannot be allocated.
+    explicit hazard_pointer(hazard_pointer_domain& domain) : m_record(domain.acquire_record()), m_domain(&domain)
+    {
+        if (BOOST_UNLIKELY(m_record == NULL))
+            boost::throw_exception(std::bad_alloc());
+    }
+
+#if !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    hazard_pointer(hazard_pointer&& that) BOOST_NOEXCEPT : m_record(that.m_record), m_domain(that.m_domain)
+    {
+        that.m_record = NULL;
+        that.m_domain = NULL;
+    }
+
+    hazard_pointer& operator= (hazard_pointer&& that) BOOST_NOEXCEPT
+    {
+        hazard_pointer tmp(static_cast< hazard_pointer&& >(that));
+        swap(tmp);
+        return *this;
+    }
+#endif // !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+
+    ~hazard_pointer()
+    {
+        if (m_record)
+            m_domain->release_record(m_record);
+    }
+
+    //! Returns \c true if the hazard pointer does not own a slot
+    bool empty() const BOOST_NOEXCEPT
+    {
+        return m_record == NULL;
+    }
+
+    //! Loads a pointer from \a src and protects it from reclamation. Returns the protected pointer.
+    template< typename T >
+    T* protect(atomics::atomic< T* > const volatile& src) BOOST_NOEXCEPT
+    {
+        T* ptr = src.load(memory_order_relaxed);
+        while (!try_protect(ptr, src)) {}
+        return ptr;
+    }
+
+    /*!
+     * \brief Attempts to protect \a ptr from reclamation
+     *
+     * Stores \a ptr in the hazard pointer and checks that \a src still contains the same pointer. On success, returns \c true.
+     * On failure, clears the hazard pointer, loads the new value of \a src into \a ptr and returns \c false.
+     */
+    template< typename T >
+    bool try_protect(T*& ptr, atomics::atomic< T* > const volatile& src) BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT(m_record != NULL);
+
+        T* const old_ptr = ptr;
+        m_record->m_ptr.store(old_ptr, memory_order_relaxed);
+        // Order the store above before the load below. Pairs with the heavy fence in the domain scan.
+        atomics::detail::asymmetric_thread_fence_light(m_domain->m_native_fences);
+        ptr = src.load(memory_order_acquire);
+        if (BOOST_UNLIKELY(ptr != old_ptr))
+        {
+            m_record->m_ptr.store(NULL, memory_order_release);
+            return false;
+        }
+
+        return true;
+    }
+
+    //! Stores \a ptr in the hazard pointer. The caller must ensure the object is not retired before the pointer is stored.
+    template< typename T >
+    void reset_protection(const T* ptr) BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT(m_record != NULL);
+        m_record->m_ptr.store(ptr, memory_order_release);
+    }
+
+    //! Clears the hazard pointer
+    void reset_protection() BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT(m_record != NULL);
+        m_record->m_ptr.store(NULL, memory_order_release);
+    }
+
+    void swap(hazard_pointer& that) BOOST_NOEXCEPT
+    {
+        atomics::detail::hazard_pointer_record* rec = m_record;
+        m_record = that.m_record;
+        that.m_record = rec;
+        hazard_pointer_domain* domain = m_domain;
+        m_domain = that.m_domain;
+        that.m_domain = domain;
+    }
+
+    friend void swap(hazard_pointer& left, hazard_pointer& right) BOOST_NOEXCEPT
+    {
+        left.swap(right);
+    }
+
+    BOOST_DELETED_FUNCTION(hazard_pointer(hazard_pointer const&))
+    BOOST_DELETED_FUNCTION(hazard_pointer& operator= (hazard_pointer const&))
+};
+
+#if !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+//! Creates a hazard pointer owning a slot in the given domain
+inline hazard_pointer make_hazard_pointer(hazard_pointer_domain& domain = hazard_pointer_default_domain())
+{
+    return hazard_pointer(domain);
+}
+#endif // !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+
+/*!
+ * \brief Base class for objects protected by hazard pointers
+ *
+ * \c T must be the class derived from \c hazard_pointer_obj_base. \c Deleter must be a default-constructible function object
+ * that reclaims a retired object, given a pointer to \c T.
+ */
+template< typename T, typename Deleter = atomics::detail::hazard_pointer_default_deleter< T > >
+class hazard_pointer_obj_base
+{
+private:
+    atomics::detail::hazard_pointer_retired m_hazard_pointer_retired;
+
+protected:
+    hazard_pointer_obj_base() BOOST_NOEXCEPT
+    {
+    }
+
+    hazard_pointer_obj_base(hazard_pointer_obj_base const&) BOOST_NOEXCEPT
+    {
+    }
+
+    hazard_pointer_obj_base& operator= (hazard_pointer_obj_base const&) BOOST_NOEXCEPT
+    {
+        return *this;
+    }
+
+public:
+    //! Retires the object. The object must have been made unreachable for new hazard pointer protections prior to the call.
+    void retire(hazard_pointer_domain& domain = hazard_pointer_default_domain()) BOOST_NOEXCEPT
+    {
+        m_hazard_pointer_retired.m_ptr = static_cast< const T* >(this);
+        m_hazard_pointer_retired.m_reclaim = &hazard_pointer_obj_base::reclaim;
+        domain.retire(&m_hazard_pointer_retired);
+    }
+
+private:
+    static void reclaim(atomics::detail::hazard_pointer_retired* obj)
+    {
+        Deleter()(const_cast< T* >(static_cast< const T* >(obj->m_ptr)));
+    }
+};
+
+} // namespace atomics
+
+using atomics::hazard_pointer_domain;
+using atomics::hazard_pointer_default_domain;
+using atomics::hazard_pointer;
+#if !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+using atomics::make_hazard_pointer;
+#endif
+using atomics::hazard_pointer_obj_base;
+
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_HAZARD_POINTER_HPP_INCLUDED_
@@ -0,0 +1,66 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/interference_size.hpp
+ *
+ * This header contains definition of hardware interference size constants and the runtime cache line size query.
+ */
+
+#ifndef BOOST_ATOMIC_INTERFERENCE_SIZE_HPP_INCLUDED_
+#define BOOST_ATOMIC_INTERFERENCE_SIZE_HPP_INCLUDED_
+
+#include <cstddef>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/link.hpp>
+#include <boost/atomic/detail/cache_line_size.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+// The constants are made as macros so that they can be used in alignment attributes, see the note in cache_line_size.hpp.
+// Users may define the macros to override the defaults for their target CPUs.
+#if !defined(BOOST_ATOMIC_DESTRUCTIVE_INTERFERENCE_SIZE)
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+// Intel CPUs since Sandy Bridge prefetch cache lines in pairs, which makes the adjacent line subject to false sharing
+#define BOOST_ATOMIC_DESTRUCTIVE_INTERFERENCE_SIZE 128
+#elif defined(__aarch64__) || defined(_M_ARM64)
+// Some ARMv8 implementations have 128 or 256-byte cache lines
+#define BOOST_ATOMIC_DESTRUCTIVE_INTERFERENCE_SIZE 256
+#else
+#define BOOST_ATOMIC_DESTRUCTIVE_INTERFERENCE_SIZE BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE
+#endif
+#endif // !defined(BOOST_ATOMIC_DESTRUCTIVE_INTERFERENCE_SIZE)
+
+#if !defined(BOOST_ATOMIC_CONSTRUCTIVE_INTERFERENCE_SIZE)
+#define BOOST_ATOMIC_CONSTRUCTIVE_INTERFERENCE_SIZE BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE
+#endif
+
+namespace boost {
+namespace atomics {
+
+//! Minimum offset between two objects to avoid false sharing
+BOOST_CONSTEXPR_OR_CONST std::size_t destructive_interference_size = BOOST_ATOMIC_DESTRUCTIVE_INTERFERENCE_SIZE;
+//! Maximum size of contiguous memory to promote true sharing
+BOOST_CONSTEXPR_OR_CONST std::size_t constructive_interference_size = BOOST_ATOMIC_CONSTRUCTIVE_INTERFERENCE_SIZE;
+
+/*!
+ * \brief Returns the cache line size of the CPU the program is running on
+ *
+ * The size is obtained from the operating system or the CPU, if possible, and is \c BOOST_ATOMIC_CONSTRUCTIVE_INTERFERENCE_SIZE
+ * otherwise. The result is determined on the first call and is cached.
+ */
+BOOST_ATOMIC_DECL std::size_t cache_line_size() BOOST_NOEXCEPT;
+
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_INTERFERENCE_SIZE_HPP_INCLUDED_
@@ -22,6 +22,7 @@
 #include <boost/atomic/detail/intptr.hpp>
 #include <boost/atomic/detail/classify.hpp>
 #include <boost/atomic/detail/atomic_ref_impl.hpp>
+#include <boost/atomic/detail/fetch_update.hpp>
 #include <boost/atomic/detail/type_traits/is_trivially_copyable.hpp>
 #include <boost/atomic/detail/header.hpp>
 
@@ -71,6 +72,12 @@ public:
         return this->load();
     }
 
+    template< typename F >
+    BOOST_FORCEINLINE bool fetch_update(F f, value_type& old_val, memory_order order = memory_order_seq_cst) const
+    {
+        return atomics::detail::fetch_update< value_type >(*this, &base_type::storage(), f, old_val, order);
+    }
+
     BOOST_DELETED_FUNCTION(ipc_atomic_ref& operator= (ipc_atomic_ref const&))
 };
 
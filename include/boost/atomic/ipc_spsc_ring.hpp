@@ -0,0 +1,297 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/ipc_spsc_ring.hpp
+ *
+ * This header contains definition of \c ipc_spsc_ring, a single-producer/single-consumer ring buffer
+ * that can be placed in memory shared between processes.
+ */
+
+#ifndef BOOST_ATOMIC_IPC_SPSC_RING_HPP_INCLUDED_
+#define BOOST_ATOMIC_IPC_SPSC_RING_HPP_INCLUDED_
+
+#include <cstddef>
+#include <boost/cstdint.hpp>
+#include <boost/assert.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/memory_order.hpp>
+#include <boost/atomic/ipc_atomic.hpp>
+#include <boost/atomic/fences.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/cache_line_size.hpp>
+#include <boost/atomic/detail/type_traits/is_trivially_copyable.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+
+/*!
+ * \brief Single-producer/single-consumer ring buffer for inter-process communication
+ *
+ * The ring contains no pointers and only uses IPC atomic types, so it can be placed in memory shared between processes.
+ * The producer and the consumer each keep a copy of the other side's index on their own cache line and only
+ * read the other side's index when the copy indicates the ring is full or empty. Blocking operations wait
+ * on the other side's index and are only notified when the other side is blocked.
+ *
+ * \c T must be a trivially copyable type. \c Capacity must be a power of two.
+ */
+template< typename T, std::size_t Capacity >
+class ipc_spsc_ring
+{
+#if !defined(BOOST_ATOMIC_DETAIL_NO_CXX11_IS_TRIVIALLY_COPYABLE)
+    BOOST_STATIC_ASSERT_MSG(atomics::detail::is_trivially_copyable< T >::value, "boost::ipc_spsc_ring<T> requires T to be a trivially copyable type");
+#endif
+    BOOST_STATIC_ASSERT_MSG(Capacity >= 2u && Capacity <= 0x80000000u && (Capacity & (Capacity - 1u)) == 0u, "boost::ipc_spsc_ring capacity must be a power of two");
+
+public:
+    typedef T value_type;
+    typedef std::size_t size_type;
+
+    //! Maximum number of elements the ring can hold
+    static BOOST_CONSTEXPR_OR_CONST size_type capacity = Capacity;
+
+private:
+    typedef boost::uint32_t index_type;
+
+    static BOOST_CONSTEXPR_OR_CONST index_type index_mask = static_cast< index_type >(Capacity - 1u);
+
+private:
+    // Producer cache line
+    //! Position of the next element to push. Only modified by the producer.
+    atomics::ipc_atomic< index_type > m_tail;
+    //! Producer's copy of the consumer position
+    index_type m_cached_head;
+    char m_padding1[BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE];
+
+    // Consumer cache line
+    //! Position of the next element to pop. Only modified by the consumer.
+    atomics::ipc_atomic< index_type > m_head;
+    //! Consumer's copy of the producer position
+    index_type m_cached_tail;
+    char m_padding2[BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE];
+
+    // The flags are rarely modified, so they are kept separate from the positions
+    //! Non-zero if the producer is blocked waiting for free slots
+    atomics::ipc_atomic< index_type > m_producer_waiting;
+    //! Non-zero if the consumer is blocked waiting for elements
+    atomics::ipc_atomic< index_type > m_consumer_waiting;
+    char m_padding3[BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE];
+
+    //! Element slots
+    T m_slots[Capacity];
+
+public:
+    //! Constructs an empty ring
+    ipc_spsc_ring() BOOST_NOEXCEPT :
+        m_tail(0u), m_cached_head(0u), m_head(0u), m_cached_tail(0u), m_producer_waiting(0u), m_consumer_waiting(0u)
+    {
+    }
+
+    /*!
+     * \brief Reserves free slots for pushing elements
+     *
+     * On input, \a count is the maximum number of slots to reserve. On output, \a count is the number of contiguous free slots,
+     * which may be less than requested, e.g. at the end of the ring. Returns a pointer to the first reserved slot, or \c NULL
+     * if the ring is full. The reserved slots are made available to the consumer by \c commit_push. Must only be called by the producer.
+     */
+    T* reserve_push(size_type& count) BOOST_NOEXCEPT
+    {
+        const index_type tail = m_tail.load(memory_order_relaxed);
+        index_type free_count = static_cast< index_type >(Capacity - static_cast< index_type >(tail - m_cached_head));
+        if (free_count < count)
+        {
+            m_cached_head = m_head.load(memory_order_acquire);
+            free_count = static_cast< index_type >(Capacity - static_cast< index_type >(tail - m_cached_head));
+        }
+
+        return reserve_slots(tail, free_count, count);
+    }
+
+    //! Reserves free slots for pushing elements, like \c reserve_push. Blocks while the ring is full.
+    T* reserve_push_wait(size_type& count) BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT(count > 0u);
+        const size_type requested = count;
+        T* p = reserve_push(count);
+        while (!p)
+        {
+            wait_not_full();
+            count = requested;
+            p = reserve_push(count);
+        }
+
+        return p;
+    }
+
+    //! Makes \a count elements written to the reserved slots available to the consumer. Must only be called by the producer.
+    void commit_push(size_type count) BOOST_NOEXCEPT
+    {
+        m_tail.store(static_cast< index_type >(m_tail.load(memory_order_relaxed) + count), memory_order_release);
+        // Order the store above before the load below. Pairs with the fence in wait_not_empty.
+        atomics::atomic_thread_fence(memory_order_seq_cst);
+        if (BOOST_UNLIKELY(m_consumer_waiting.load(memory_order_relaxed) != 0u))
+            m_tail.notify_one();
+    }
+
+    /*!
+     * \brief Reserves filled slots for popping elements
+     *
+     * On input, \a count is the maximum number of slots to reserve. On output, \a count is the number of contiguous filled slots,
+     * which may be less than requested, e.g. at the end of the ring. Returns a pointer to the first reserved slot, or \c NULL
+     * if the ring is empty. The reserved slots are released to the producer by \c commit_pop. Must only be called by the consumer.
+     */
+    const T* reserve_pop(size_type& count) BOOST_NOEXCEPT
+    {
+        const index_type head = m_head.load(memory_order_relaxed);
+        index_type filled_count = static_cast< index_type >(m_cached_tail - head);
+        if (filled_count < count)
+        {
+            m_cached_tail = m_tail.load(memory_order_acquire);
+            filled_count = static_cast< index_type >(m_cached_tail - head);
+        }
+
+        return reserve_slots(head, filled_count, count);
+    }
+
+    //! Reserves filled slots for popping elements, like \c reserve_pop. Blocks while the ring is empty.
+    const T* reserve_pop_wait(size_type& count) BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT(count > 0u);
+        const size_type requested = count;
+        const T* p = reserve_pop(count);
+        while (!p)
+        {
+            wait_not_empty();
+            count = requested;
+            p = reserve_pop(count);
+        }
+
+        return p;
+    }
+
+    //! Releases \a count slots read by the consumer to the producer. Must only be called by the consumer.
+    void commit_pop(size_type count) BOOST_NOEXCEPT
+    {
+        m_head.store(static_cast< index_type >(m_head.load(memory_order_relaxed) + count), memory_order_release);
+        // Order the store above before the load below. Pairs with the fence in wait_not_full.
+        atomics::atomic_thread_fence(memory_order_seq_cst);
+        if (BOOST_UNLIKELY(m_producer_waiting.load(memory_order_relaxed) != 0u))
+            m_head.notify_one();
+    }
+
+    //! Pushes an element to the ring. Returns \c false if the ring is full.
+    bool try_push(T const& value) BOOST_NOEXCEPT
+    {
+        size_type count = 1u;
+        T* p = reserve_push(count);
+        if (!p)
+            return false;
+
+        *p = value;
+        commit_push(1u);
+        return true;
+    }
+
+    //! Pushes an element to the ring. Blocks while the ring is full.
+    void push_wait(T const& value) BOOST_NOEXCEPT
+    {
+        size_type count = 1u;
+        *reserve_push_wait(count) = value;
+        commit_push(1u);
+    }
+
+    //! Pops an element from the ring. Returns \c false if the ring is empty.
+    bool try_pop(T& value) BOOST_NOEXCEPT
+    {
+        size_type count = 1u;
+        const T* p = reserve_pop(count);
+        if (!p)
+            return false;
+
+        value = *p;
+        commit_pop(1u);
+        return true;
+    }
+
+    //! Pops an element from the ring. Blocks while the ring is empty.
+    void pop_wait(T& value) BOOST_NOEXCEPT
+    {
+        size_type count = 1u;
+        value = *reserve_pop_wait(count);
+        commit_pop(1u);
+    }
+
+    BOOST_DELETED_FUNCTION(ipc_spsc_ring(ipc_spsc_ring const&))
+    BOOST_DELETED_FUNCTION(ipc_spsc_ring& operator= (ipc_spsc_ring const&))
+
+private:
+    //! Limits \a count to the number of \a available contiguous slots starting at position \a pos and returns the pointer to the first slot
+    T* reserve_slots(index_type pos, index_type available, size_type& count) BOOST_NOEXCEPT
+    {
+        if (available == 0u)
+        {
+            count = 0u;
+            return NULL;
+        }
+
+        const index_type index = static_cast< index_type >(pos & index_mask);
+        const index_type contiguous = static_cast< index_type >(Capacity - index);
+        if (available > contiguous)
+            available = contiguous;
+        if (count > available)
+            count = available;
+
+        return m_slots + index;
+    }
+
+    //! Blocks until the consumer releases slots
+    void wait_not_full() BOOST_NOEXCEPT
+    {
+        const index_type tail = m_tail.load(memory_order_relaxed);
+        const index_type full_head = static_cast< index_type >(tail - Capacity);
+
+        m_producer_waiting.store(1u, memory_order_relaxed);
+        // Order the store above before the load in wait. Pairs with the fence in commit_pop.
+        atomics::atomic_thread_fence(memory_order_seq_cst);
+        m_head.wait(full_head, memory_order_relaxed);
+        m_producer_waiting.store(0u, memory_order_relaxed);
+    }
+
+    //! Blocks until the producer commits elements
+    void wait_not_empty() BOOST_NOEXCEPT
+    {
+        const index_type head = m_head.load(memory_order_relaxed);
+
+        m_consumer_waiting.store(1u, memory_order_relaxed);
+        // Order the store above before the load in wait. Pairs with the fence in commit_push.
+        atomics::atomic_thread_fence(memory_order_seq_cst);
+        m_tail.wait(head, memory_order_relaxed);
+        m_consumer_waiting.store(0u, memory_order_relaxed);
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+template< typename T, std::size_t Capacity >
+BOOST_CONSTEXPR_OR_CONST typename ipc_spsc_ring< T, Capacity >::size_type ipc_spsc_ring< T, Capacity >::capacity;
+template< typename T, std::size_t Capacity >
+BOOST_CONSTEXPR_OR_CONST typename ipc_spsc_ring< T, Capacity >::index_type ipc_spsc_ring< T, Capacity >::index_mask;
+#endif
+
+} // namespace atomics
+
+using atomics::ipc_spsc_ring;
+
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_IPC_SPSC_RING_HPP_INCLUDED_
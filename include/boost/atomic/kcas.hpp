@@ -0,0 +1,596 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/kcas.hpp
+ *
+ * This header contains definition of \c kcas_domain and \c locked_kcas_domain, which implement
+ * multi-word compare-and-swap operations.
+ */
+
+#ifndef BOOST_ATOMIC_KCAS_HPP_INCLUDED_
+#define BOOST_ATOMIC_KCAS_HPP_INCLUDED_
+
+#include <cstddef>
+#include <boost/assert.hpp>
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/fences.hpp>
+#include <boost/atomic/epoch_domain.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/intptr.hpp>
+#include <boost/atomic/detail/lock_pool.hpp>
+#include <boost/atomic/detail/type_traits/alignment_of.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+#if !defined(BOOST_ATOMIC_KCAS_MAX_WORDS)
+#define BOOST_ATOMIC_KCAS_MAX_WORDS 4
+#endif
+
+namespace boost {
+namespace atomics {
+
+//! Atomic word that can be modified by multi-word compare-and-swap operations
+typedef atomics::atomic< atomics::detail::uintptr_t > kcas_word;
+
+//! Element of a multi-word compare-and-swap operation
+struct kcas_entry
+{
+    //! Pointer to the atomic word
+    kcas_word* word;
+    //! Expected value of the word
+    atomics::detail::uintptr_t expected;
+    //! The value to store in the word if all words have the expected values
+    atomics::detail::uintptr_t desired;
+};
+
+namespace detail {
+
+//! Copies the entries to \a sorted in the ascending order of the word addresses
+inline void kcas_sort_entries(kcas_entry const* entries, std::size_t count, kcas_entry* sorted) BOOST_NOEXCEPT
+{
+    for (std::size_t i = 0u; i < count; ++i)
+    {
+        std::size_t j = i;
+        for (; j > 0u && sorted[j - 1u].word > entries[i].word; --j)
+            sorted[j] = sorted[j - 1u];
+        sorted[j] = entries[i];
+    }
+
+#if !defined(NDEBUG)
+    for (std::size_t i = 1u; i < count; ++i)
+        BOOST_ASSERT_MSG(sorted[i - 1u].word != sorted[i].word, "Boost.Atomic: multi-word compare-and-swap entries must refer to distinct words");
+#endif
+}
+
+} // namespace detail
+
+/*!
+ * \brief Lock-free multi-word compare-and-swap domain
+ *
+ * The operations are implemented with the algorithm by Harris, Fraser and Pratt. The operation descriptor is installed
+ * in every word with a restricted double-compare single-swap (RDCSS) operation, which only succeeds while the operation
+ * is undecided. Once all words are acquired, or one of them does not match the expected value, the operation is decided
+ * and the descriptor is replaced with the desired or the expected values. Threads that encounter a descriptor help
+ * to complete the operation, which makes the algorithm lock-free.
+ *
+ * The two least significant bits of the words are used to mark descriptors, so the values stored in the words must have
+ * these bits clear. While there may be multi-word operations in progress, the words must only be accessed through
+ * the domain participants. All operations are sequentially consistent. Descriptors are reclaimed with an epoch domain.
+ */
+class kcas_domain
+{
+public:
+    typedef atomics::detail::uintptr_t value_type;
+    typedef atomics::kcas_word word_type;
+    typedef atomics::kcas_entry entry;
+
+    //! Maximum number of words in a single operation
+    static BOOST_CONSTEXPR_OR_CONST std::size_t max_words = BOOST_ATOMIC_KCAS_MAX_WORDS;
+    //! Number of least significant bits of the words that are reserved by the implementation
+    static BOOST_CONSTEXPR_OR_CONST unsigned int reserved_bits = 2u;
+
+    class participant;
+
+private:
+    //! Marker of a pointer to an RDCSS descriptor in a word
+    static BOOST_CONSTEXPR_OR_CONST value_type rdcss_tag = 1u;
+    //! Marker of a pointer to a multi-word operation descriptor in a word
+    static BOOST_CONSTEXPR_OR_CONST value_type kcas_tag = 2u;
+    static BOOST_CONSTEXPR_OR_CONST value_type tag_mask = rdcss_tag | kcas_tag;
+
+    //! Operation status values
+    enum status
+    {
+        status_undecided = 0u,
+        status_succeeded,
+        status_failed
+    };
+
+    //! Base class for descriptors, which are kept in the participant's lists
+    struct descriptor_base
+    {
+        descriptor_base* m_next;
+        //! Global epoch observed by the participant that retired the descriptor
+        epoch_domain::epoch_type m_retire_epoch;
+    };
+
+    //! Multi-word operation descriptor
+    struct kcas_descriptor :
+        public descriptor_base
+    {
+        atomics::atomic< unsigned int > m_status;
+        std::size_t m_count;
+        //! The operation entries, sorted by the word addresses
+        entry m_entries[max_words];
+    };
+
+    //! RDCSS descriptor. Every descriptor is only installed once, by the thread that created it.
+    struct rdcss_descriptor :
+        public descriptor_base
+    {
+        kcas_descriptor* m_kcas;
+        word_type* m_word;
+        value_type m_expected;
+    };
+
+private:
+    epoch_domain m_epoch_domain;
+
+public:
+    BOOST_DEFAULTED_FUNCTION(kcas_domain(), {})
+
+    BOOST_DELETED_FUNCTION(kcas_domain(kcas_domain const&))
+    BOOST_DELETED_FUNCTION(kcas_domain& operator= (kcas_domain const&))
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+BOOST_CONSTEXPR_OR_CONST std::size_t kcas_domain::max_words;
+BOOST_CONSTEXPR_OR_CONST unsigned int kcas_domain::reserved_bits;
+BOOST_CONSTEXPR_OR_CONST kcas_domain::value_type kcas_domain::rdcss_tag;
+BOOST_CONSTEXPR_OR_CONST kcas_domain::value_type kcas_domain::kcas_tag;
+BOOST_CONSTEXPR_OR_CONST kcas_domain::value_type kcas_domain::tag_mask;
+#endif
+
+/*!
+ * \brief Participant of the lock-free multi-word compare-and-swap domain
+ *
+ * A participant must only be used by one thread at a time. It caches descriptors for reuse and keeps the retired
+ * descriptors until they can be reused.
+ */
+class kcas_domain::participant
+{
+private:
+    //! Singly linked list of descriptors
+    struct descriptor_list
+    {
+        descriptor_base* m_head;
+        descriptor_base* m_tail;
+
+        descriptor_list() BOOST_NOEXCEPT : m_head(NULL), m_tail(NULL)
+        {
+        }
+
+        void push_back(descriptor_base* d) BOOST_NOEXCEPT
+        {
+            d->m_next = NULL;
+            if (m_tail)
+                m_tail->m_next = d;
+            else
+                m_head = d;
+            m_tail = d;
+        }
+
+        descriptor_base* pop_front() BOOST_NOEXCEPT
+        {
+            descriptor_base* d = m_head;
+            m_head = d->m_next;
+            if (!m_head)
+                m_tail = NULL;
+            return d;
+        }
+    };
+
+    //! Number of retired descriptors that triggers an attempt to advance the global epoch
+    static BOOST_CONSTEXPR_OR_CONST std::size_t collect_threshold = 64u;
+
+private:
+    kcas_domain& m_domain;
+    epoch_domain::participant m_epoch_participant;
+    //! Global epoch observed after pinning the participant
+    epoch_domain::epoch_type m_pinned_epoch;
+    std::size_t m_retired_count;
+    descriptor_list m_retired_kcas;
+    descriptor_list m_retired_rdcss;
+    descriptor_list m_free_kcas;
+    descriptor_list m_free_rdcss;
+
+public:
+    //! Registers the participant in the domain. Throws \c std::length_error if all slots are in use.
+    explicit participant(kcas_domain& domain) :
+        m_domain(domain),
+        m_epoch_participant(domain.m_epoch_domain),
+        m_pinned_epoch(0u),
+        m_retired_count(0u)
+    {
+    }
+
+    //! Unregisters the participant. Blocks until all retired descriptors can be reclaimed.
+    ~participant()
+    {
+        while (m_retired_count > 0u)
+        {
+            collect();
+            if (m_retired_count == 0u)
+                break;
+
+            atomics::detail::wait_some();
+        }
+
+        free_list< kcas_descriptor >(m_free_kcas);
+        free_list< rdcss_descriptor >(m_free_rdcss);
+    }
+
+    //! Returns the current value of the word
+    value_type load(word_type const& w) BOOST_NOEXCEPT
+    {
+        // Descriptors are only accessed while pinned, values can be returned immediately
+        value_type v = w.load(memory_order_seq_cst);
+        if ((v & tag_mask) == 0u)
+            return v;
+
+        epoch_domain::guard g(m_epoch_participant);
+        word_type& word = const_cast< word_type& >(w);
+        while (true)
+        {
+            v = word.load(memory_order_seq_cst);
+            if ((v & rdcss_tag) != 0u)
+            {
+                complete_rdcss(to_rdcss(v));
+                continue;
+            }
+
+            if ((v & kcas_tag) != 0u)
+            {
+                // The word is acquired by a multi-word operation. Its logical value is determined by the operation status,
+                // there is no need to help completing the operation.
+                kcas_descriptor* d = to_kcas(v);
+                const bool succeeded = d->m_status.load(memory_order_seq_cst) == status_succeeded;
+                for (std::size_t i = 0u, n = d->m_count; i < n; ++i)
+                {
+                    if (d->m_entries[i].word == &word)
+                        return succeeded ? d->m_entries[i].desired : d->m_entries[i].expected;
+                }
+
+                BOOST_ASSERT_MSG(false, "Boost.Atomic: multi-word compare-and-swap descriptor does not reference the word");
+            }
+
+            return v;
+        }
+    }
+
+    /*!
+     * \brief Performs multi-word compare-and-swap
+     *
+     * If every word referenced by \a entries has the expected value, stores the desired values to all words and returns \c true.
+     * Otherwise, returns \c false without modifying the words. Throws \c std::bad_alloc if the descriptor cannot be allocated.
+     */
+    bool compare_exchange(entry const* entries, std::size_t count)
+    {
+        BOOST_ASSERT_MSG(count <= max_words, "Boost.Atomic: too many words in multi-word compare-and-swap");
+
+        epoch_domain::guard g(m_epoch_participant);
+        m_pinned_epoch = m_domain.m_epoch_domain.epoch();
+
+        kcas_descriptor* d = allocate< kcas_descriptor >(m_free_kcas);
+        d->m_status.store(status_undecided, memory_order_relaxed);
+        d->m_count = count;
+        atomics::detail::kcas_sort_entries(entries, count, d->m_entries);
+#if !defined(NDEBUG)
+        for (std::size_t i = 0u; i < count; ++i)
+            BOOST_ASSERT_MSG(((entries[i].expected | entries[i].desired) & tag_mask) == 0u, "Boost.Atomic: multi-word compare-and-swap values must not use the reserved bits");
+#endif
+
+        const bool succeeded = help(d);
+        retire(m_retired_kcas, d);
+
+        return succeeded;
+    }
+
+    //! Reclaims the retired descriptors that are no longer accessible by other threads
+    void collect() BOOST_NOEXCEPT
+    {
+        const epoch_domain::epoch_type epoch = m_domain.m_epoch_domain.try_advance();
+        // Make sure the accesses to the descriptors by other participants happen before they are reused
+        atomics::atomic_thread_fence(memory_order_acquire);
+        reclaim(m_retired_kcas, m_free_kcas, epoch);
+        reclaim(m_retired_rdcss, m_free_rdcss, epoch);
+    }
+
+    BOOST_DELETED_FUNCTION(participant(participant const&))
+    BOOST_DELETED_FUNCTION(participant& operator= (participant const&))
+
+private:
+    static BOOST_FORCEINLINE kcas_descriptor* to_kcas(value_type v) BOOST_NOEXCEPT
+    {
+        return reinterpret_cast< kcas_descriptor* >(v & ~tag_mask);
+    }
+
+    static BOOST_FORCEINLINE rdcss_descriptor* to_rdcss(value_type v) BOOST_NOEXCEPT
+    {
+        return reinterpret_cast< rdcss_descriptor* >(v & ~tag_mask);
+    }
+
+    //! Replaces the RDCSS descriptor in the word with the operation descriptor, if the operation is undecided, or with the expected value otherwise
+    static void complete_rdcss(rdcss_descriptor* d) BOOST_NOEXCEPT
+    {
+        value_type marker = reinterpret_cast< value_type >(d) | rdcss_tag;
+        const bool undecided = d->m_kcas->m_status.load(memory_order_seq_cst) == status_undecided;
+        d->m_word->compare_exchange_strong(marker, undecided ? (reinterpret_cast< value_type >(d->m_kcas) | kcas_tag) : d->m_expected, memory_order_seq_cst, memory_order_relaxed);
+    }
+
+    //! Installs the operation descriptor into the word of the entry, if the word has the expected value and the operation is undecided. Returns the observed value of the word.
+    value_type rdcss(kcas_descriptor* kd, entry const& e)
+    {
+        rdcss_descriptor* d = allocate< rdcss_descriptor >(m_free_rdcss);
+        d->m_kcas = kd;
+        d->m_word = e.word;
+        d->m_expected = e.expected;
+
+        const value_type marker = reinterpret_cast< value_type >(d) | rdcss_tag;
+        value_type v = e.expected;
+        while (!e.word->compare_exchange_strong(v, marker, memory_order_seq_cst, memory_order_seq_cst))
+        {
+            if ((v & rdcss_tag) == 0u)
+            {
+                // The descriptor was not published, so it can be reused immediately
+                m_free_rdcss.push_back(d);
+                return v;
+            }
+
+            complete_rdcss(to_rdcss(v));
+            v = e.expected;
+        }
+
+        complete_rdcss(d);
+        retire(m_retired_rdcss, d);
+
+        return v;
+    }
+
+    //! Completes the multi-word operation. Returns \c true if the operation succeeded.
+    bool help(kcas_descriptor* d)
+    {
+        const value_type kcas_marker = reinterpret_cast< value_type >(d) | kcas_tag;
+        const std::size_t count = d->m_count;
+
+        if (d->m_status.load(memory_order_seq_cst) == status_undecided)
+        {
+            // Phase 1: acquire all words in the order of their addresses. The ordering guarantees that helping terminates.
+            unsigned int new_status = status_succeeded;
+            for (std::size_t i = 0u; i < count && new_status == status_succeeded; ++i)
+            {
+                while (true)
+                {
+                    const value_type v = rdcss(d, d->m_entries[i]);
+                    if ((v & kcas_tag) != 0u)
+                    {
+                        if (v != kcas_marker)
+                        {
+                            help(to_kcas(v));
+                            continue;
+                        }
+                    }
+                    else if (v != d->m_entries[i].expected)
+                    {
+                        new_status = status_failed;
+                    }
+
+                    break;
+                }
+
+                if (d->m_status.load(memory_order_seq_cst) != status_undecided)
+                    break;
+            }
+
+            unsigned int expected = status_undecided;
+            d->m_status.compare_exchange_strong(expected, new_status, memory_order_seq_cst, memory_order_seq_cst);
+        }
+
+        // Phase 2: release the words. Pending RDCSS descriptors of this operation are resolved as well, so that the operation
+        // descriptor cannot be installed into the words after this function returns.
+        const bool succeeded = d->m_status.load(memory_order_seq_cst) == status_succeeded;
+        for (std::size_t i = 0u; i < count; ++i)
+        {
+            entry const& e = d->m_entries[i];
+            value_type v = e.word->load(memory_order_seq_cst);
+            while (true)
+            {
+                if ((v & rdcss_tag) != 0u)
+                {
+                    rdcss_descriptor* rd = to_rdcss(v);
+                    if (rd->m_kcas != d)
+                        break;
+
+                    complete_rdcss(rd);
+                    v = e.word->load(memory_order_seq_cst);
+                }
+                else if (v == kcas_marker)
+                {
+                    if (e.word->compare_exchange_strong(v, succeeded ? e.desired : e.expected, memory_order_seq_cst, memory_order_seq_cst))
+                        break;
+                }
+                else
+                {
+                    break;
+                }
+            }
+        }
+
+        return succeeded;
+    }
+
+    template< typename Descriptor >
+    static Descriptor* allocate(descriptor_list& free_list)
+    {
+        if (free_list.m_head)
+            return static_cast< Descriptor* >(free_list.pop_front());
+
+        return new Descriptor();
+    }
+
+    template< typename Descriptor >
+    static void free_list(descriptor_list& list) BOOST_NOEXCEPT
+    {
+        while (list.m_head)
+            delete static_cast< Descriptor* >(list.pop_front());
+    }
+
+    void retire(descriptor_list& list, descriptor_base* d) BOOST_NOEXCEPT
+    {
+        d->m_retire_epoch = m_pinned_epoch;
+        list.push_back(d);
+        if (++m_retired_count >= collect_threshold)
+            collect();
+    }
+
+    void reclaim(descriptor_list& retired, descriptor_list& free, epoch_domain::epoch_type epoch) BOOST_NOEXCEPT
+    {
+        // The global epoch may be one past the epoch observed after pinning. A thread that obtained a pointer to a retired
+        // operation descriptor may still publish an RDCSS descriptor referencing it, and other threads may access
+        // the operation descriptor through the RDCSS descriptor while pinned in the next epoch. Hence the descriptors
+        // are reused one epoch later than normally required by epoch-based reclamation.
+        while (retired.m_head && static_cast< epoch_domain::epoch_type >(epoch - retired.m_head->m_retire_epoch) >= 4u)
+        {
+            free.push_back(retired.pop_front());
+            --m_retired_count;
+        }
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+BOOST_CONSTEXPR_OR_CONST std::size_t kcas_domain::participant::collect_threshold;
+#endif
+
+/*!
+ * \brief Lock-based multi-word compare-and-swap domain
+ *
+ * The operations lock the lock pool entries corresponding to the words in a globally consistent order. The domain has
+ * the same interface as \c kcas_domain and can be used for comparison or on targets where the lock-free implementation
+ * is not desirable. While there may be multi-word operations in progress, the words must only be accessed through
+ * the domain participants.
+ */
+class locked_kcas_domain
+{
+public:
+    typedef atomics::detail::uintptr_t value_type;
+    typedef atomics::kcas_word word_type;
+    typedef atomics::kcas_entry entry;
+
+    //! Maximum number of words in a single operation
+    static BOOST_CONSTEXPR_OR_CONST std::size_t max_words = BOOST_ATOMIC_KCAS_MAX_WORDS;
+    //! Number of least significant bits of the words that are reserved by the implementation
+    static BOOST_CONSTEXPR_OR_CONST unsigned int reserved_bits = 0u;
+
+    class participant;
+
+public:
+    BOOST_DEFAULTED_FUNCTION(locked_kcas_domain(), {})
+
+    BOOST_DELETED_FUNCTION(locked_kcas_domain(locked_kcas_domain const&))
+    BOOST_DELETED_FUNCTION(locked_kcas_domain& operator= (locked_kcas_domain const&))
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+BOOST_CONSTEXPR_OR_CONST std::size_t locked_kcas_domain::max_words;
+BOOST_CONSTEXPR_OR_CONST unsigned int locked_kcas_domain::reserved_bits;
+#endif
+
+//! Participant of the lock-based multi-word compare-and-swap domain
+class locked_kcas_domain::participant
+{
+private:
+    typedef atomics::detail::lock_pool::scoped_lock< atomics::detail::alignment_of< value_type >::value > scoped_lock;
+
+public:
+    explicit participant(locked_kcas_domain&) BOOST_NOEXCEPT
+    {
+    }
+
+    //! Returns the current value of the word
+    value_type load(word_type const& w) BOOST_NOEXCEPT
+    {
+        scoped_lock lock(&w);
+        return w.value();
+    }
+
+    /*!
+     * \brief Performs multi-word compare-and-swap
+     *
+     * If every word referenced by \a entries has the expected value, stores the desired values to all words and returns \c true.
+     * Otherwise, returns \c false without modifying the words.
+     */
+    bool compare_exchange(entry const* entries, std::size_t count) BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT_MSG(count <= max_words, "Boost.Atomic: too many words in multi-word compare-and-swap");
+
+        atomics::detail::uintptr_t hashes[max_words];
+        for (std::size_t i = 0u; i < count; ++i)
+            hashes[i] = atomics::detail::lock_pool::hash_ptr< atomics::detail::alignment_of< value_type >::value >(entries[i].word);
+
+        void* locks[max_words];
+        const std::size_t lock_count = atomics::detail::lock_pool::short_lock_multiple(hashes, count, locks);
+
+        // The words are accessed directly while the locks are held. If the atomic operations on the words are not lock-free,
+        // they are implemented with the same lock pool and would attempt to acquire the locks again.
+        bool succeeded = true;
+        for (std::size_t i = 0u; i < count; ++i)
+        {
+            if (entries[i].word->value() != entries[i].expected)
+            {
+                succeeded = false;
+                break;
+            }
+        }
+
+        if (succeeded)
+        {
+            for (std::size_t i = 0u; i < count; ++i)
+                entries[i].word->value() = entries[i].desired;
+        }
+
+        for (std::size_t i = lock_count; i > 0u; --i)
+            atomics::detail::lock_pool::fast_unlock(locks[i - 1u]);
+
+        return succeeded;
+    }
+
+    //! Does nothing. Provided for compatibility with \c kcas_domain::participant.
+    void collect() BOOST_NOEXCEPT
+    {
+    }
+
+    BOOST_DELETED_FUNCTION(participant(participant const&))
+    BOOST_DELETED_FUNCTION(participant& operator= (participant const&))
+};
+
+} // namespace atomics
+
+using atomics::kcas_word;
+using atomics::kcas_entry;
+using atomics::kcas_domain;
+using atomics::locked_kcas_domain;
+
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_KCAS_HPP_INCLUDED_
@@ -0,0 +1,135 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/latch.hpp
+ *
+ * This header contains definition of \c latch, a single-use thread barrier.
+ */
+
+#ifndef BOOST_ATOMIC_LATCH_HPP_INCLUDED_
+#define BOOST_ATOMIC_LATCH_HPP_INCLUDED_
+
+#include <cstddef>
+#include <boost/assert.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/wait_policy.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/pause.hpp>
+#include <boost/atomic/detail/sync_spin_count.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+
+/*!
+ * \brief Single-use thread barrier
+ *
+ * The latch is a downward counter. Threads may block until the counter reaches zero. The counter is implemented with
+ * a 32-bit atomic, waiting and notifying operations of which are used to block and unblock threads.
+ */
+class latch
+{
+private:
+    atomics::atomic< boost::int32_t > m_count;
+    atomics::atomic< boost::int32_t > m_waiter_count;
+
+public:
+    //! Returns the maximum value of the counter
+    static BOOST_CONSTEXPR std::ptrdiff_t (max)() BOOST_NOEXCEPT
+    {
+        return 0x7FFFFFFF;
+    }
+
+    //! Initializes the counter with \a expected, which must be in range [0, max()]
+    explicit latch(std::ptrdiff_t expected) BOOST_NOEXCEPT :
+        m_count(static_cast< boost::int32_t >(expected)),
+        m_waiter_count(0)
+    {
+        BOOST_ASSERT(expected >= 0 && expected <= (max)());
+    }
+
+    //! Decrements the counter by \a update. If the counter reaches zero, unblocks all waiting threads.
+    void count_down(std::ptrdiff_t update = 1) BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT(update >= 0);
+        // Pairs with the increment of the waiter count in wait_slow_path
+        const boost::int32_t prev_count = m_count.fetch_sub(static_cast< boost::int32_t >(update), boost::memory_order_seq_cst);
+        BOOST_ASSERT(prev_count >= update);
+        if (prev_count == update && m_waiter_count.load(boost::memory_order_seq_cst) != 0)
+            m_count.notify_all();
+    }
+
+    //! Returns \c true if the counter has reached zero
+    bool try_wait() const BOOST_NOEXCEPT
+    {
+        return m_count.load(boost::memory_order_acquire) == 0;
+    }
+
+    //! Blocks until the counter reaches zero
+    void wait() BOOST_NOEXCEPT
+    {
+        for (unsigned int i = 0u; i < atomics::detail::sync_spin_count; ++i)
+        {
+            if (try_wait())
+                return;
+
+            atomics::detail::pause();
+        }
+
+        wait_slow_path(wait_policy_park);
+    }
+
+    //! Blocks until the counter reaches zero, waiting according to \a policy
+    void wait(wait_policy policy) BOOST_NOEXCEPT
+    {
+        if (!try_wait())
+            wait_slow_path(policy);
+    }
+
+    //! Decrements the counter by \a update and blocks until the counter reaches zero
+    void arrive_and_wait(std::ptrdiff_t update = 1) BOOST_NOEXCEPT
+    {
+        count_down(update);
+        wait();
+    }
+
+    //! Decrements the counter by \a update and blocks until the counter reaches zero, waiting according to \a policy
+    void arrive_and_wait(std::ptrdiff_t update, wait_policy policy) BOOST_NOEXCEPT
+    {
+        count_down(update);
+        wait(policy);
+    }
+
+    BOOST_DELETED_FUNCTION(latch(latch const&))
+    BOOST_DELETED_FUNCTION(latch& operator= (latch const&))
+
+private:
+    void wait_slow_path(wait_policy policy) BOOST_NOEXCEPT
+    {
+        m_waiter_count.opaque_add(1, boost::memory_order_seq_cst);
+
+        boost::int32_t count = m_count.load(boost::memory_order_seq_cst);
+        while (count != 0)
+            count = m_count.wait(count, boost::memory_order_acquire, policy);
+
+        m_waiter_count.opaque_sub(1, boost::memory_order_relaxed);
+    }
+};
+
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_LATCH_HPP_INCLUDED_
@@ -0,0 +1,97 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/mutex.hpp
+ *
+ * This header contains definition of \c mutex and \c ipc_mutex, compact mutexes based on futexes.
+ */
+
+#ifndef BOOST_ATOMIC_MUTEX_HPP_INCLUDED_
+#define BOOST_ATOMIC_MUTEX_HPP_INCLUDED_
+
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/aligned_variable.hpp>
+#include <boost/atomic/detail/mutex_operations.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+
+template< bool Interprocess >
+class basic_condition_variable;
+
+/*!
+ * \brief A compact mutex
+ *
+ * The mutex occupies 32 bits and does not require initialization or destruction beyond construction. The mutex spins for
+ * a short time before blocking, unless there are other threads blocked on the mutex already. If \a Interprocess is \c true,
+ * the mutex can be placed in memory shared between processes.
+ */
+template< bool Interprocess >
+class basic_mutex
+{
+    template< bool >
+    friend class basic_condition_variable;
+
+private:
+    typedef atomics::detail::mutex_operations< Interprocess > operations;
+    typedef typename operations::storage_type storage_type;
+
+public:
+    static BOOST_CONSTEXPR_OR_CONST bool is_always_lock_free = operations::is_always_lock_free;
+
+private:
+    BOOST_ATOMIC_DETAIL_ALIGNED_VAR_TPL(operations::core_operations::storage_alignment, storage_type, m_state);
+
+public:
+    BOOST_FORCEINLINE BOOST_ATOMIC_DETAIL_CONSTEXPR_UNION_INIT basic_mutex() BOOST_NOEXCEPT : m_state(0u)
+    {
+    }
+
+    //! Locks the mutex, blocking if it is locked by another thread
+    BOOST_FORCEINLINE void lock() BOOST_NOEXCEPT
+    {
+        operations::lock(m_state);
+    }
+
+    //! Attempts to lock the mutex without blocking. Returns \c true if the mutex was locked.
+    BOOST_FORCEINLINE bool try_lock() BOOST_NOEXCEPT
+    {
+        return operations::try_lock(m_state);
+    }
+
+    //! Unlocks the mutex
+    BOOST_FORCEINLINE void unlock() BOOST_NOEXCEPT
+    {
+        operations::unlock(m_state);
+    }
+
+    BOOST_DELETED_FUNCTION(basic_mutex(basic_mutex const&))
+    BOOST_DELETED_FUNCTION(basic_mutex& operator= (basic_mutex const&))
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+template< bool Interprocess >
+BOOST_CONSTEXPR_OR_CONST bool basic_mutex< Interprocess >::is_always_lock_free;
+#endif
+
+//! Mutex for synchronizing threads within a process
+typedef basic_mutex< false > mutex;
+//! Mutex for synchronizing threads in different processes
+typedef basic_mutex< true > ipc_mutex;
+
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_MUTEX_HPP_INCLUDED_
@@ -0,0 +1,269 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/notify_batch.hpp
+ *
+ * This header contains definition of \c notify_batch, which coalesces notifying operations on multiple atomic objects.
+ */
+
+#ifndef BOOST_ATOMIC_NOTIFY_BATCH_HPP_INCLUDED_
+#define BOOST_ATOMIC_NOTIFY_BATCH_HPP_INCLUDED_
+
+#include <cstddef>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/atomic_ref.hpp>
+#include <boost/atomic/atomic_flag.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/addressof.hpp>
+#include <boost/atomic/detail/parking_lot.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+#if !defined(BOOST_ATOMIC_NOTIFY_BATCH_CAPACITY)
+#define BOOST_ATOMIC_NOTIFY_BATCH_CAPACITY 16
+#endif
+
+namespace boost {
+namespace atomics {
+namespace detail {
+
+typedef void (*unpark_multiple_func)(atomics::detail::parking_lot::unpark_request* requests, std::size_t count);
+
+//! Returns the parking lot function for unblocking threads waiting on the atomic objects without native waiting and notifying operations
+template< bool AlwaysHasNativeWaitNotify >
+struct notify_batch_unpark
+{
+    static BOOST_FORCEINLINE unpark_multiple_func get() BOOST_NOEXCEPT
+    {
+        return &atomics::detail::parking_lot::unpark_multiple;
+    }
+};
+
+// Don't reference the parking lot for the types that never use it, so that using them with notify_batch does not require linking with the library
+template< >
+struct notify_batch_unpark< true >
+{
+    static BOOST_FORCEINLINE unpark_multiple_func get() BOOST_NOEXCEPT
+    {
+        return NULL;
+    }
+};
+
+//! The base class holds the constants of \c notify_batch, so that they can be defined in the header
+template< typename Dummy >
+struct notify_batch_constants
+{
+    //! Maximum number of distinct atomic objects with pending notifications. Adding more objects flushes the batch.
+    static BOOST_CONSTEXPR_OR_CONST std::size_t capacity = BOOST_ATOMIC_NOTIFY_BATCH_CAPACITY;
+    //! The number of threads to unblock that means all blocked threads
+    static BOOST_CONSTEXPR_OR_CONST std::size_t notify_all_count = ~static_cast< std::size_t >(0u);
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+template< typename Dummy >
+BOOST_CONSTEXPR_OR_CONST std::size_t notify_batch_constants< Dummy >::capacity;
+template< typename Dummy >
+BOOST_CONSTEXPR_OR_CONST std::size_t notify_batch_constants< Dummy >::notify_all_count;
+#endif
+
+} // namespace detail
+
+/*!
+ * \brief Batch of notifying operations
+ *
+ * The batch records the notifying operations on atomic objects and performs them when the batch is flushed or destroyed.
+ * Multiple notifications of the same atomic object are coalesced, and the threads blocked on the atomic objects that
+ * do not support waiting and notifying operations natively are unblocked with a single lock acquisition per queue
+ * of blocked threads.
+ */
+class notify_batch :
+    public atomics::detail::notify_batch_constants< void >
+{
+private:
+    typedef void (*notify_func)(void* object, std::size_t count);
+
+    //! Pending notification
+    struct request
+    {
+        //! Pointer to the atomic object or, for \c atomic_ref, the referenced object
+        void* object;
+        //! Address of the atomic object storage
+        const volatile void* storage;
+        //! Notifying function, or \c NULL if the object uses the parking lot
+        notify_func notify;
+        //! Number of threads to unblock
+        std::size_t count;
+    };
+
+private:
+    request m_requests[capacity];
+    std::size_t m_size;
+    //! Function for unblocking threads in the parking lot, or \c NULL if no objects using the parking lot have been added
+    atomics::detail::unpark_multiple_func m_unpark_multiple;
+
+public:
+    BOOST_FORCEINLINE notify_batch() BOOST_NOEXCEPT : m_size(0u), m_unpark_multiple(NULL)
+    {
+    }
+
+    BOOST_FORCEINLINE ~notify_batch() BOOST_NOEXCEPT
+    {
+        flush();
+    }
+
+    //! Records a request to unblock one thread waiting on \a object
+    template< typename T >
+    BOOST_FORCEINLINE void notify_one(atomics::atomic< T >& object) BOOST_NOEXCEPT
+    {
+        add(object, atomics::detail::addressof(object), atomics::detail::addressof(object.value()), &notify_batch::notify_atomic< T >, 1u);
+    }
+
+    //! Records a request to unblock all threads waiting on \a object
+    template< typename T >
+    BOOST_FORCEINLINE void notify_all(atomics::atomic< T >& object) BOOST_NOEXCEPT
+    {
+        add(object, atomics::detail::addressof(object), atomics::detail::addressof(object.value()), &notify_batch::notify_atomic< T >, notify_all_count);
+    }
+
+    //! Records a request to unblock one thread waiting on the object referenced by \a ref
+    template< typename T >
+    BOOST_FORCEINLINE void notify_one(atomics::atomic_ref< T > const& ref) BOOST_NOEXCEPT
+    {
+        T* p = atomics::detail::addressof(ref.value());
+        add(ref, p, p, &notify_batch::notify_atomic_ref< T >, 1u);
+    }
+
+    //! Records a request to unblock all threads waiting on the object referenced by \a ref
+    template< typename T >
+    BOOST_FORCEINLINE void notify_all(atomics::atomic_ref< T > const& ref) BOOST_NOEXCEPT
+    {
+        T* p = atomics::detail::addressof(ref.value());
+        add(ref, p, p, &notify_batch::notify_atomic_ref< T >, notify_all_count);
+    }
+
+    //! Records a request to unblock one thread waiting on \a flag
+    BOOST_FORCEINLINE void notify_one(atomics::atomic_flag& flag) BOOST_NOEXCEPT
+    {
+        add(flag, &flag, &flag.m_storage, &notify_batch::notify_atomic_flag, 1u);
+    }
+
+    //! Records a request to unblock all threads waiting on \a flag
+    BOOST_FORCEINLINE void notify_all(atomics::atomic_flag& flag) BOOST_NOEXCEPT
+    {
+        add(flag, &flag, &flag.m_storage, &notify_batch::notify_atomic_flag, notify_all_count);
+    }
+
+    //! Performs the pending notifying operations
+    void flush() BOOST_NOEXCEPT
+    {
+        atomics::detail::parking_lot::unpark_request unpark_requests[capacity];
+        std::size_t unpark_count = 0u;
+        for (std::size_t i = 0u; i < m_size; ++i)
+        {
+            const request& req = m_requests[i];
+            if (req.notify != NULL)
+            {
+                req.notify(req.object, req.count);
+            }
+            else
+            {
+                unpark_requests[unpark_count].addr = req.storage;
+                unpark_requests[unpark_count].count = req.count;
+                ++unpark_count;
+            }
+        }
+
+        m_size = 0u;
+        if (unpark_count > 0u)
+            m_unpark_multiple(unpark_requests, unpark_count);
+    }
+
+    BOOST_DELETED_FUNCTION(notify_batch(notify_batch const&))
+    BOOST_DELETED_FUNCTION(notify_batch& operator= (notify_batch const&))
+
+private:
+    template< typename Object >
+    BOOST_FORCEINLINE void add(Object const& object, void* ptr, const volatile void* storage, notify_func notify, std::size_t count) BOOST_NOEXCEPT
+    {
+        if (!object.has_native_wait_notify())
+        {
+            m_unpark_multiple = atomics::detail::notify_batch_unpark< Object::always_has_native_wait_notify >::get();
+            notify = NULL;
+        }
+
+        add_request(ptr, storage, notify, count);
+    }
+
+    void add_request(void* ptr, const volatile void* storage, notify_func notify, std::size_t count) BOOST_NOEXCEPT
+    {
+        for (std::size_t i = 0u; i < m_size; ++i)
+        {
+            request& req = m_requests[i];
+            if (req.storage == storage)
+            {
+                if (count == notify_all_count || req.count == notify_all_count)
+                    req.count = notify_all_count;
+                else
+                    req.count += count;
+                return;
+            }
+        }
+
+        if (BOOST_UNLIKELY(m_size == capacity))
+            flush();
+
+        request& req = m_requests[m_size++];
+        req.object = ptr;
+        req.storage = storage;
+        req.notify = notify;
+        req.count = count;
+    }
+
+    //! Unblocks \a count threads waiting on \a object. Multiple threads are unblocked with a single operation where the system supports it.
+    template< typename Object >
+    static void notify_object(Object& object, std::size_t count) BOOST_NOEXCEPT
+    {
+        if (count == notify_all_count)
+            object.notify_all();
+        else if (count == 1u)
+            object.notify_one();
+        else
+            object.notify_n(count);
+    }
+
+    template< typename T >
+    static void notify_atomic(void* object, std::size_t count) BOOST_NOEXCEPT
+    {
+        notify_batch::notify_object(*static_cast< atomics::atomic< T >* >(object), count);
+    }
+
+    template< typename T >
+    static void notify_atomic_ref(void* object, std::size_t count) BOOST_NOEXCEPT
+    {
+        atomics::atomic_ref< T > ref(*static_cast< T* >(object));
+        notify_batch::notify_object(ref, count);
+    }
+
+    static void notify_atomic_flag(void* object, std::size_t count) BOOST_NOEXCEPT
+    {
+        notify_batch::notify_object(*static_cast< atomics::atomic_flag* >(object), count);
+    }
+};
+
+} // namespace atomics
+
+using atomics::notify_batch;
+
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_NOTIFY_BATCH_HPP_INCLUDED_
@@ -0,0 +1,83 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/per_byte_memcpy.hpp
+ *
+ * This header contains definition of \c atomic_load_per_byte_memcpy and \c atomic_store_per_byte_memcpy functions.
+ */
+
+#ifndef BOOST_ATOMIC_PER_BYTE_MEMCPY_HPP_INCLUDED_
+#define BOOST_ATOMIC_PER_BYTE_MEMCPY_HPP_INCLUDED_
+
+#include <cstddef>
+#include <boost/assert.hpp>
+#include <boost/memory_order.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/fence_operations.hpp>
+#include <boost/atomic/detail/per_byte_memcpy.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+/*
+ * IMPLEMENTATION NOTE: All interface functions MUST be declared with BOOST_FORCEINLINE,
+ *                      see comment for convert_memory_order_to_gcc in gcc_atomic_memory_order_utils.hpp.
+ */
+
+namespace boost {
+
+namespace atomics {
+
+/*!
+ * \brief Copies bytes from memory that may be concurrently modified
+ *
+ * Every byte of \a source is read with an atomic load, so the copy does not constitute a data race with concurrent
+ * \c atomic_store_per_byte_memcpy on the same memory. The bytes may be read in any order and with wider accesses.
+ * \a order must be \c memory_order_relaxed, \c memory_order_consume or \c memory_order_acquire. Returns \a dest.
+ */
+BOOST_FORCEINLINE void* atomic_load_per_byte_memcpy(void* dest, const void* source, std::size_t count, memory_order order) BOOST_NOEXCEPT
+{
+    BOOST_ASSERT(order == memory_order_relaxed || order == memory_order_consume || order == memory_order_acquire);
+
+    atomics::detail::load_per_byte_memcpy(static_cast< unsigned char* >(dest), static_cast< const volatile unsigned char* >(source), count);
+    if (order != memory_order_relaxed)
+        atomics::detail::fence_operations::thread_fence(order);
+
+    return dest;
+}
+
+/*!
+ * \brief Copies bytes to memory that may be concurrently read
+ *
+ * Every byte of \a dest is written with an atomic store, so the copy does not constitute a data race with concurrent
+ * \c atomic_load_per_byte_memcpy on the same memory. The bytes may be written in any order and with wider accesses.
+ * \a order must be \c memory_order_relaxed or \c memory_order_release. Returns \a dest.
+ */
+BOOST_FORCEINLINE void* atomic_store_per_byte_memcpy(void* dest, const void* source, std::size_t count, memory_order order) BOOST_NOEXCEPT
+{
+    BOOST_ASSERT(order == memory_order_relaxed || order == memory_order_release);
+
+    if (order != memory_order_relaxed)
+        atomics::detail::fence_operations::thread_fence(order);
+    atomics::detail::store_per_byte_memcpy(static_cast< volatile unsigned char* >(dest), static_cast< const unsigned char* >(source), count);
+
+    return dest;
+}
+
+} // namespace atomics
+
+using atomics::atomic_load_per_byte_memcpy;
+using atomics::atomic_store_per_byte_memcpy;
+
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_PER_BYTE_MEMCPY_HPP_INCLUDED_
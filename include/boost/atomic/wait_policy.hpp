@@ -0,0 +1,49 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   atomic/wait_policy.hpp
+ *
+ * This header contains definition of \c wait_policy enum.
+ */
+
+#ifndef BOOST_ATOMIC_WAIT_POLICY_HPP_INCLUDED_
+#define BOOST_ATOMIC_WAIT_POLICY_HPP_INCLUDED_
+
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+
+//! Policy of waiting for the atomic object value to change
+enum wait_policy
+{
+    //! Block the thread until it is unblocked by a notifying operation
+    wait_policy_park,
+    //! Poll the atomic object without blocking the thread
+    wait_policy_spin,
+    //! Poll the atomic object for a number of times adapted to the recently observed waiting durations, then block the thread
+    wait_policy_adaptive
+};
+
+} // namespace atomics
+
+using atomics::wait_policy;
+using atomics::wait_policy_park;
+using atomics::wait_policy_spin;
+using atomics::wait_policy_adaptive;
+
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_WAIT_POLICY_HPP_INCLUDED_
@@ -0,0 +1,140 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   asymmetric_fence.cpp
+ *
+ * This file contains implementation of the heavy asymmetric fence.
+ *
+ * https://man7.org/linux/man-pages/man2/membarrier.2.html
+ * https://docs.microsoft.com/en-us/windows/win32/api/processthreadsapi/nf-processthreadsapi-flushprocesswritebuffers
+ */
+
+#include <boost/predef/os/windows.h>
+#if BOOST_OS_WINDOWS
+// Include boost/winapi/config.hpp first to make sure target Windows version is selected by Boost.WinAPI
+#include <boost/winapi/config.hpp>
+#endif
+
+#include <boost/config.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/memory_order.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/link.hpp>
+#include <boost/atomic/detail/once_flag.hpp>
+#include <boost/atomic/detail/fence_operations.hpp>
+#include <boost/atomic/detail/asymmetric_fence.hpp>
+
+#if BOOST_OS_WINDOWS
+#if BOOST_USE_WINAPI_VERSION >= BOOST_WINAPI_VERSION_WIN6
+#include <boost/winapi/basic_types.hpp>
+#if !defined(BOOST_USE_WINDOWS_H)
+extern "C" {
+BOOST_WINAPI_IMPORT boost::winapi::VOID_ BOOST_WINAPI_WINAPI_CC FlushProcessWriteBuffers(BOOST_WINAPI_DETAIL_VOID);
+} // extern "C"
+#endif
+#define BOOST_ATOMIC_USE_FLUSH_PROCESS_WRITE_BUFFERS
+#endif // BOOST_USE_WINAPI_VERSION >= BOOST_WINAPI_VERSION_WIN6
+#elif defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#if defined(SYS_membarrier)
+#define BOOST_ATOMIC_SYS_MEMBARRIER SYS_membarrier
+#elif defined(__NR_membarrier)
+#define BOOST_ATOMIC_SYS_MEMBARRIER __NR_membarrier
+#endif
+#if defined(BOOST_ATOMIC_SYS_MEMBARRIER)
+#define BOOST_ATOMIC_USE_MEMBARRIER
+#endif
+#endif
+
+#include <boost/atomic/detail/header.hpp>
+
+namespace boost {
+namespace atomics {
+namespace detail {
+
+BOOST_STATIC_ASSERT_MSG(once_flag_operations::is_always_lock_free, "Boost.Atomic unsupported target platform: native atomic operations not implemented for bytes");
+BOOST_ATOMIC_DECL once_flag g_asymmetric_fence_state = {};
+
+namespace {
+
+#if defined(BOOST_ATOMIC_USE_MEMBARRIER)
+
+// The constants are defined here as linux/membarrier.h may not be available or may be outdated
+enum membarrier_cmd
+{
+    membarrier_cmd_query = 0,
+    membarrier_cmd_private_expedited = 1 << 3,
+    membarrier_cmd_register_private_expedited = 1 << 4
+};
+
+BOOST_FORCEINLINE long membarrier(int cmd) BOOST_NOEXCEPT
+{
+    return ::syscall(BOOST_ATOMIC_SYS_MEMBARRIER, cmd, 0);
+}
+
+#endif // defined(BOOST_ATOMIC_USE_MEMBARRIER)
+
+//! Detects whether native heavy fences are supported. Concurrent callers may repeat the detection, which is harmless.
+once_flag_operations::storage_type init_asymmetric_fence_state() BOOST_NOEXCEPT
+{
+    once_flag_operations::storage_type state = asymmetric_fence_emulated;
+
+#if defined(BOOST_ATOMIC_USE_FLUSH_PROCESS_WRITE_BUFFERS)
+    state = asymmetric_fence_native;
+#elif defined(BOOST_ATOMIC_USE_MEMBARRIER)
+    const long cmds = membarrier(membarrier_cmd_query);
+    if (cmds > 0 && (cmds & membarrier_cmd_private_expedited) != 0 && (cmds & membarrier_cmd_register_private_expedited) != 0)
+    {
+        // The process must register its intent to use private expedited membarrier before issuing one
+        if (membarrier(membarrier_cmd_register_private_expedited) == 0)
+            state = asymmetric_fence_native;
+    }
+#endif
+
+    once_flag_operations::store(g_asymmetric_fence_state.m_flag, state, boost::memory_order_release);
+    return state;
+}
+
+BOOST_FORCEINLINE once_flag_operations::storage_type get_asymmetric_fence_state() BOOST_NOEXCEPT
+{
+    once_flag_operations::storage_type state = once_flag_operations::load(g_asymmetric_fence_state.m_flag, boost::memory_order_acquire);
+    if (BOOST_UNLIKELY(state == asymmetric_fence_uninitialized))
+        state = init_asymmetric_fence_state();
+
+    return state;
+}
+
+} // namespace
+
+BOOST_ATOMIC_DECL bool asymmetric_fence_init() BOOST_NOEXCEPT
+{
+    return get_asymmetric_fence_state() == asymmetric_fence_native;
+}
+
+BOOST_ATOMIC_DECL void asymmetric_thread_fence_heavy() BOOST_NOEXCEPT
+{
+    if (BOOST_LIKELY(get_asymmetric_fence_state() == asymmetric_fence_native))
+    {
+#if defined(BOOST_ATOMIC_USE_FLUSH_PROCESS_WRITE_BUFFERS)
+        ::FlushProcessWriteBuffers();
+        return;
+#elif defined(BOOST_ATOMIC_USE_MEMBARRIER)
+        if (BOOST_LIKELY(membarrier(membarrier_cmd_private_expedited) == 0))
+            return;
+#endif
+    }
+
+    atomics::detail::fence_operations::thread_fence(boost::memory_order_seq_cst);
+}
+
+} // namespace detail
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
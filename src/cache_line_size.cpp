@@ -0,0 +1,151 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   cache_line_size.cpp
+ *
+ * This file contains implementation of the runtime cache line size query.
+ */
+
+#include <cstddef>
+#include <cstdio>
+#include <boost/config.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/memory_order.hpp>
+#include <boost/atomic/interference_size.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/link.hpp>
+#include <boost/atomic/detail/core_operations.hpp>
+
+#if defined(__linux__)
+#include <unistd.h>
+#elif defined(__APPLE__)
+#include <sys/types.h>
+#include <sys/sysctl.h>
+#endif
+
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define BOOST_ATOMIC_USE_CPUID
+#elif defined(__GNUC__)
+#include <cpuid.h>
+#define BOOST_ATOMIC_USE_CPUID
+#endif
+#endif
+
+#include <boost/atomic/detail/header.hpp>
+
+namespace boost {
+namespace atomics {
+
+namespace {
+
+typedef atomics::detail::core_operations< sizeof(std::size_t), false, false > size_operations;
+
+struct cached_size
+{
+    BOOST_ATOMIC_DETAIL_ALIGNED_VAR(size_operations::storage_alignment, size_operations::storage_type, m_size);
+};
+
+BOOST_STATIC_ASSERT_MSG(size_operations::is_always_lock_free, "Boost.Atomic unsupported target platform: native atomic operations not implemented for size_t");
+//! The detected cache line size, or 0 if not detected yet
+static cached_size g_cache_line_size = {};
+
+#if defined(__linux__)
+
+//! Reads the coherency line size of the L1 data cache from sysfs
+std::size_t read_sysfs_cache_line_size() BOOST_NOEXCEPT
+{
+    std::size_t size = 0u;
+    std::FILE* file = std::fopen("/sys/devices/system/cpu/cpu0/cache/index0/coherency_line_size", "r");
+    if (file != NULL)
+    {
+        unsigned long value = 0u;
+        if (std::fscanf(file, "%lu", &value) == 1)
+            size = static_cast< std::size_t >(value);
+        std::fclose(file);
+    }
+
+    return size;
+}
+
+#endif // defined(__linux__)
+
+#if defined(BOOST_ATOMIC_USE_CPUID)
+
+//! Reads the CLFLUSH line size reported by CPUID
+std::size_t read_cpuid_cache_line_size() BOOST_NOEXCEPT
+{
+    unsigned int ebx = 0u;
+#if defined(_MSC_VER)
+    int regs[4] = {};
+    __cpuid(regs, 1);
+    ebx = static_cast< unsigned int >(regs[1]);
+#else
+    unsigned int eax = 0u, ecx = 0u, edx = 0u;
+    if (!__get_cpuid(1u, &eax, &ebx, &ecx, &edx))
+        return 0u;
+#endif
+    // Bits 8-15 of EBX contain the line size in 8-byte units
+    return static_cast< std::size_t >((ebx >> 8) & 0xFFu) * 8u;
+}
+
+#endif // defined(BOOST_ATOMIC_USE_CPUID)
+
+//! Detects the cache line size. Concurrent callers may repeat the detection, which is harmless.
+std::size_t detect_cache_line_size() BOOST_NOEXCEPT
+{
+    std::size_t size = 0u;
+
+#if defined(__linux__)
+    size = read_sysfs_cache_line_size();
+#if defined(_SC_LEVEL1_DCACHE_LINESIZE)
+    if (size == 0u)
+    {
+        const long value = ::sysconf(_SC_LEVEL1_DCACHE_LINESIZE);
+        if (value > 0)
+            size = static_cast< std::size_t >(value);
+    }
+#endif
+#elif defined(__APPLE__)
+    {
+        std::size_t value = 0u;
+        std::size_t value_size = sizeof(value);
+        if (::sysctlbyname("hw.cachelinesize", &value, &value_size, NULL, 0) == 0)
+            size = value;
+    }
+#endif
+
+#if defined(BOOST_ATOMIC_USE_CPUID)
+    if (size == 0u)
+        size = read_cpuid_cache_line_size();
+#endif
+
+    // Only accept sane values
+    if (size < sizeof(void*) || (size & (size - 1u)) != 0u)
+        size = BOOST_ATOMIC_CONSTRUCTIVE_INTERFERENCE_SIZE;
+
+    size_operations::store(g_cache_line_size.m_size, static_cast< size_operations::storage_type >(size), boost::memory_order_relaxed);
+    return size;
+}
+
+} // namespace
+
+BOOST_ATOMIC_DECL std::size_t cache_line_size() BOOST_NOEXCEPT
+{
+    std::size_t size = static_cast< std::size_t >(size_operations::load(g_cache_line_size.m_size, boost::memory_order_relaxed));
+    if (BOOST_UNLIKELY(size == 0u))
+        size = detect_cache_line_size();
+
+    return size;
+}
+
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
@@ -0,0 +1,249 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   hazard_pointer.cpp
+ *
+ * This file contains implementation of the hazard pointer domain.
+ *
+ * https://www.cs.otago.ac.nz/cosc440/readings/hazard-pointers.pdf
+ */
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <algorithm>
+#include <functional>
+#include <boost/config.hpp>
+#include <boost/assert.hpp>
+#include <boost/memory_order.hpp>
+#include <boost/atomic/hazard_pointer.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/link.hpp>
+#include <boost/atomic/detail/intptr.hpp>
+#include <boost/atomic/detail/cache_line_size.hpp>
+#include <boost/atomic/detail/asymmetric_fence.hpp>
+
+#include <boost/atomic/detail/header.hpp>
+
+namespace boost {
+namespace atomics {
+
+namespace {
+
+//! Minimum number of retired objects that triggers a scan
+BOOST_CONSTEXPR_OR_CONST std::size_t min_scan_threshold = 64u;
+
+//! Hazard pointer slot that occupies a whole number of cache lines
+struct BOOST_ALIGNMENT(BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE) padded_hazard_pointer_record
+{
+    atomics::detail::hazard_pointer_record record;
+    //! Pointer to the allocated memory block
+    void* m_block;
+};
+
+//! Allocates a hazard pointer slot aligned to the cache line size
+atomics::detail::hazard_pointer_record* allocate_record() BOOST_NOEXCEPT
+{
+    void* block = std::malloc(sizeof(padded_hazard_pointer_record) + BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE - 1u);
+    if (BOOST_UNLIKELY(block == NULL))
+        return NULL;
+
+    const atomics::detail::uintptr_t addr = (reinterpret_cast< atomics::detail::uintptr_t >(block) + (BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE - 1u)) &
+        ~static_cast< atomics::detail::uintptr_t >(BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE - 1u);
+    padded_hazard_pointer_record* p = new (reinterpret_cast< void* >(addr)) padded_hazard_pointer_record;
+    p->m_block = block;
+    p->record.m_ptr.store(NULL, boost::memory_order_relaxed);
+    p->record.m_next = NULL;
+
+    return &p->record;
+}
+
+//! Frees the hazard pointer slot
+void free_record(atomics::detail::hazard_pointer_record* rec) BOOST_NOEXCEPT
+{
+    padded_hazard_pointer_record* p = reinterpret_cast< padded_hazard_pointer_record* >(rec);
+    void* block = p->m_block;
+    p->~padded_hazard_pointer_record();
+    std::free(block);
+}
+
+//! Reclaims all objects in the list
+void reclaim_all(atomics::detail::hazard_pointer_retired* list) BOOST_NOEXCEPT
+{
+    while (list)
+    {
+        atomics::detail::hazard_pointer_retired* next = list->m_next;
+        list->m_reclaim(list);
+        list = next;
+    }
+}
+
+} // namespace
+
+BOOST_ATOMIC_DECL hazard_pointer_domain::hazard_pointer_domain() BOOST_NOEXCEPT :
+    m_records(static_cast< atomics::detail::hazard_pointer_record* >(NULL)),
+    m_record_count(0u),
+    m_native_fences(atomics::detail::asymmetric_fence_init()),
+    m_retired(static_cast< atomics::detail::hazard_pointer_retired* >(NULL)),
+    m_retired_count(0u)
+{
+}
+
+BOOST_ATOMIC_DECL hazard_pointer_domain::~hazard_pointer_domain()
+{
+    reclaim_all(m_retired.exchange(NULL, boost::memory_order_acquire));
+
+    atomics::detail::hazard_pointer_record* rec = m_records.load(boost::memory_order_acquire);
+    while (rec)
+    {
+        BOOST_ASSERT_MSG(!rec->m_active.load(boost::memory_order_relaxed), "Boost.Atomic: hazard pointer domain destroyed while hazard pointers are still in use");
+        atomics::detail::hazard_pointer_record* next = rec->m_next;
+        free_record(rec);
+        rec = next;
+    }
+}
+
+BOOST_ATOMIC_DECL atomics::detail::hazard_pointer_record* hazard_pointer_domain::acquire_record() BOOST_NOEXCEPT
+{
+    // Try to reuse a released slot first
+    atomics::detail::hazard_pointer_record* head = m_records.load(boost::memory_order_acquire);
+    for (atomics::detail::hazard_pointer_record* rec = head; rec != NULL; rec = rec->m_next)
+    {
+        if (!rec->m_active.load(boost::memory_order_relaxed) && !rec->m_active.exchange(true, boost::memory_order_acquire))
+            return rec;
+    }
+
+    atomics::detail::hazard_pointer_record* rec = allocate_record();
+    if (BOOST_UNLIKELY(rec == NULL))
+        return NULL;
+
+    rec->m_active.store(true, boost::memory_order_relaxed);
+    rec->m_next = head;
+    while (!m_records.compare_exchange_weak(rec->m_next, rec, boost::memory_order_release, boost::memory_order_relaxed)) {}
+    m_record_count.fetch_add(1u, boost::memory_order_relaxed);
+
+    return rec;
+}
+
+BOOST_ATOMIC_DECL void hazard_pointer_domain::release_record(atomics::detail::hazard_pointer_record* rec) BOOST_NOEXCEPT
+{
+    rec->m_ptr.store(NULL, boost::memory_order_release);
+    rec->m_active.store(false, boost::memory_order_release);
+}
+
+BOOST_ATOMIC_DECL void hazard_pointer_domain::retire(atomics::detail::hazard_pointer_retired* obj) BOOST_NOEXCEPT
+{
+    obj->m_next = m_retired.load(boost::memory_order_relaxed);
+    while (!m_retired.compare_exchange_weak(obj->m_next, obj, boost::memory_order_release, boost::memory_order_relaxed)) {}
+
+    const std::size_t retired_count = m_retired_count.fetch_add(1u, boost::memory_order_relaxed) + 1u;
+    std::size_t threshold = m_record_count.load(boost::memory_order_relaxed) * 2u;
+    if (threshold < min_scan_threshold)
+        threshold = min_scan_threshold;
+
+    if (retired_count >= threshold)
+        cleanup();
+}
+
+BOOST_ATOMIC_DECL void hazard_pointer_domain::cleanup() BOOST_NOEXCEPT
+{
+    atomics::detail::hazard_pointer_retired* retired = m_retired.exchange(NULL, boost::memory_order_acquire);
+    if (!retired)
+        return;
+
+    // Make sure the hazard pointers stored in other threads prior to unlinking the retired objects are visible to us.
+    // Pairs with the light fence in hazard_pointer::try_protect.
+    atomics::detail::asymmetric_thread_fence_heavy();
+
+    // Collect the hazard pointers into a sorted array to speed up lookup. If memory allocation fails, fall back to a linear search.
+    atomics::detail::hazard_pointer_record* const records = m_records.load(boost::memory_order_acquire);
+    std::size_t hazard_count = 0u;
+    for (atomics::detail::hazard_pointer_record* rec = records; rec != NULL; rec = rec->m_next)
+        ++hazard_count;
+
+    const void** hazards = NULL;
+    if (hazard_count > 0u)
+    {
+        hazards = static_cast< const void** >(std::malloc(hazard_count * sizeof(const void*)));
+        if (BOOST_LIKELY(hazards != NULL))
+        {
+            hazard_count = 0u;
+            for (atomics::detail::hazard_pointer_record* rec = records; rec != NULL; rec = rec->m_next)
+            {
+                const void* p = rec->m_ptr.load(boost::memory_order_acquire);
+                if (p)
+                    hazards[hazard_count++] = p;
+            }
+
+            std::sort(hazards, hazards + hazard_count, std::less< const void* >());
+        }
+    }
+
+    atomics::detail::hazard_pointer_retired* kept_head = NULL;
+    atomics::detail::hazard_pointer_retired* kept_tail = NULL;
+    std::size_t reclaimed_count = 0u;
+    while (retired)
+    {
+        atomics::detail::hazard_pointer_retired* next = retired->m_next;
+
+        bool is_protected;
+        if (BOOST_LIKELY(hazards != NULL))
+        {
+            is_protected = std::binary_search(hazards, hazards + hazard_count, retired->m_ptr, std::less< const void* >());
+        }
+        else
+        {
+            is_protected = false;
+            for (atomics::detail::hazard_pointer_record* rec = records; rec != NULL; rec = rec->m_next)
+            {
+                if (rec->m_ptr.load(boost::memory_order_acquire) == retired->m_ptr)
+                {
+                    is_protected = true;
+                    break;
+                }
+            }
+        }
+
+        if (is_protected)
+        {
+            retired->m_next = kept_head;
+            kept_head = retired;
+            if (!kept_tail)
+                kept_tail = retired;
+        }
+        else
+        {
+            retired->m_reclaim(retired);
+            ++reclaimed_count;
+        }
+
+        retired = next;
+    }
+
+    std::free(static_cast< void* >(hazards));
+
+    m_retired_count.fetch_sub(reclaimed_count, boost::memory_order_relaxed);
+
+    if (kept_head)
+    {
+        // Return the still protected objects to the list, they will be scanned again later
+        kept_tail->m_next = m_retired.load(boost::memory_order_relaxed);
+        while (!m_retired.compare_exchange_weak(kept_tail->m_next, kept_head, boost::memory_order_release, boost::memory_order_relaxed)) {}
+    }
+}
+
+BOOST_ATOMIC_DECL hazard_pointer_domain& hazard_pointer_default_domain() BOOST_NOEXCEPT
+{
+    static hazard_pointer_domain domain;
+    return domain;
+}
+
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
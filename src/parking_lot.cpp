@@ -0,0 +1,854 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   parking_lot.cpp
+ *
+ * This file contains implementation of the parking lot used to implement waiting and notifying operations without native support.
+ *
+ * The design follows WebKit ParkingLot: https://webkit.org/blog/6161/locking-in-webkit/
+ */
+
+#include <boost/predef/os/windows.h>
+#if BOOST_OS_WINDOWS
+// Include boost/winapi/config.hpp first to make sure target Windows version is selected by Boost.WinAPI
+#include <boost/winapi/config.hpp>
+#include <boost/predef/platform.h>
+#endif
+
+#include <cstddef>
+#include <cstdlib>
+#include <boost/config.hpp>
+#include <boost/assert.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/memory_order.hpp>
+#include <boost/atomic/capabilities.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/intptr.hpp>
+#include <boost/atomic/detail/aligned_variable.hpp>
+#include <boost/atomic/detail/cache_line_size.hpp>
+#include <boost/atomic/detail/core_operations.hpp>
+#include <boost/atomic/detail/fence_operations.hpp>
+#include <boost/atomic/detail/lock_pool.hpp>
+#include <boost/atomic/detail/parking_lot.hpp>
+#include <boost/atomic/detail/pause_calibration.hpp>
+
+#if BOOST_OS_WINDOWS
+#include <boost/winapi/basic_types.hpp>
+#include <boost/winapi/wait_constants.hpp>
+#if BOOST_USE_WINAPI_VERSION >= BOOST_WINAPI_VERSION_WIN6
+#include <boost/winapi/srw_lock.hpp>
+#include <boost/winapi/condition_variable.hpp>
+#else // BOOST_USE_WINAPI_VERSION >= BOOST_WINAPI_VERSION_WIN6
+#include <boost/winapi/critical_section.hpp>
+#include <boost/winapi/semaphore.hpp>
+#include <boost/winapi/handles.hpp>
+#include <boost/winapi/wait.hpp>
+#endif // BOOST_USE_WINAPI_VERSION >= BOOST_WINAPI_VERSION_WIN6
+#define BOOST_ATOMIC_USE_WINAPI
+#else // BOOST_OS_WINDOWS
+#include <boost/atomic/detail/futex.hpp>
+#if defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX) && BOOST_ATOMIC_INT32_LOCK_FREE == 2
+#include <boost/atomic/detail/mutex_operations.hpp>
+#define BOOST_ATOMIC_USE_FUTEX
+#else // BOOST_OS_LINUX
+#include <pthread.h>
+#define BOOST_ATOMIC_USE_PTHREAD
+#endif // BOOST_OS_LINUX
+#endif // BOOST_OS_WINDOWS
+
+#include <boost/atomic/detail/header.hpp>
+
+namespace boost {
+namespace atomics {
+namespace detail {
+namespace parking_lot {
+
+namespace {
+
+struct parker;
+
+//! Base class for a parker
+struct parker_base
+{
+    //! Next parker in the bucket queue
+    parker* m_next;
+    //! Address the thread is parked on
+    const volatile void* m_addr;
+
+    parker_base() BOOST_NOEXCEPT :
+        m_next(NULL),
+        m_addr(NULL)
+    {
+    }
+
+    BOOST_DELETED_FUNCTION(parker_base(parker_base const&))
+    BOOST_DELETED_FUNCTION(parker_base& operator= (parker_base const&))
+};
+
+// In the platform-specific definitions below, bucket_lock must be a POD structure and parker must derive from parker_base.
+// A parker is allocated on the stack of the parked thread. If parker::unpark_under_lock is true, the parker may not be accessed
+// after the parked thread returns from park(), so it is unparked while the bucket is locked and the parked thread locks
+// the bucket before returning. Otherwise, the parker is unparked after the bucket is unlocked.
+
+#if defined(BOOST_ATOMIC_USE_PTHREAD)
+
+//! Bucket lock
+struct bucket_lock
+{
+    //! Mutex
+    pthread_mutex_t m_mutex;
+
+    void init() BOOST_NOEXCEPT
+    {
+        BOOST_VERIFY(pthread_mutex_init(&m_mutex, NULL) == 0);
+    }
+
+    void destroy() BOOST_NOEXCEPT
+    {
+        pthread_mutex_destroy(&m_mutex);
+    }
+
+    void lock() BOOST_NOEXCEPT
+    {
+        BOOST_VERIFY(pthread_mutex_lock(&m_mutex) == 0);
+    }
+
+    void unlock() BOOST_NOEXCEPT
+    {
+        BOOST_VERIFY(pthread_mutex_unlock(&m_mutex) == 0);
+    }
+};
+
+//! Parking primitive of a parked thread
+struct parker :
+    public parker_base
+{
+    // POSIX allows to destroy the mutex and the condition variable as soon as the parked thread returns
+    static BOOST_CONSTEXPR_OR_CONST bool unpark_under_lock = false;
+
+    pthread_mutex_t m_mutex;
+    pthread_cond_t m_cond;
+    bool m_unparked;
+    bool m_valid;
+
+    parker() BOOST_NOEXCEPT :
+        m_unparked(false),
+        m_valid(false)
+    {
+        if (BOOST_LIKELY(pthread_mutex_init(&m_mutex, NULL) == 0))
+        {
+            if (BOOST_LIKELY(pthread_cond_init(&m_cond, NULL) == 0))
+                m_valid = true;
+            else
+                pthread_mutex_destroy(&m_mutex);
+        }
+    }
+
+    ~parker() BOOST_NOEXCEPT
+    {
+        if (BOOST_LIKELY(m_valid))
+        {
+            pthread_cond_destroy(&m_cond);
+            pthread_mutex_destroy(&m_mutex);
+        }
+    }
+
+    bool is_valid() const BOOST_NOEXCEPT
+    {
+        return m_valid;
+    }
+
+    //! Blocks until unparked
+    void park() BOOST_NOEXCEPT
+    {
+        BOOST_VERIFY(pthread_mutex_lock(&m_mutex) == 0);
+        while (!m_unparked)
+            BOOST_VERIFY(pthread_cond_wait(&m_cond, &m_mutex) == 0);
+        BOOST_VERIFY(pthread_mutex_unlock(&m_mutex) == 0);
+    }
+
+    //! Unblocks the parked thread
+    void unpark() BOOST_NOEXCEPT
+    {
+        BOOST_VERIFY(pthread_mutex_lock(&m_mutex) == 0);
+        m_unparked = true;
+        BOOST_VERIFY(pthread_cond_signal(&m_cond) == 0);
+        BOOST_VERIFY(pthread_mutex_unlock(&m_mutex) == 0);
+    }
+};
+
+#elif defined(BOOST_ATOMIC_USE_FUTEX)
+
+typedef atomics::detail::mutex_operations< false > mutex_operations;
+typedef mutex_operations::core_operations futex_operations;
+// The storage type must be a 32-bit object, as required by futex API
+BOOST_STATIC_ASSERT_MSG(futex_operations::is_always_lock_free && sizeof(futex_operations::storage_type) == 4u, "Boost.Atomic unsupported target platform: native atomic operations not implemented for 32-bit integers");
+
+//! Bucket lock
+struct bucket_lock
+{
+    //! Mutex futex
+    BOOST_ATOMIC_DETAIL_ALIGNED_VAR(futex_operations::storage_alignment, futex_operations::storage_type, m_mutex);
+
+    void init() BOOST_NOEXCEPT
+    {
+        m_mutex = 0u;
+    }
+
+    void destroy() BOOST_NOEXCEPT
+    {
+    }
+
+    void lock() BOOST_NOEXCEPT
+    {
+        if (BOOST_LIKELY(mutex_operations::try_lock(m_mutex)))
+            return;
+
+        mutex_operations::lock(m_mutex, atomics::detail::get_pause_count(atomics::detail::lock_spin_duration_ns));
+    }
+
+    void unlock() BOOST_NOEXCEPT
+    {
+        mutex_operations::unlock(m_mutex);
+    }
+};
+
+//! Parking primitive of a parked thread
+struct parker :
+    public parker_base
+{
+    // The parked thread may return as soon as the state is set, before the unparking thread wakes it up. The futex may be woken
+    // after the parker is destroyed, which can only cause a spurious wakeup of an unrelated futex wait at the same address.
+    // All futex waits in the library tolerate spurious wakeups.
+    static BOOST_CONSTEXPR_OR_CONST bool unpark_under_lock = false;
+
+    //! Parker state futex. Non-zero value indicates that the thread is unparked.
+    BOOST_ATOMIC_DETAIL_ALIGNED_VAR(futex_operations::storage_alignment, futex_operations::storage_type, m_state);
+
+    parker() BOOST_NOEXCEPT :
+        m_state(0u)
+    {
+    }
+
+    bool is_valid() const BOOST_NOEXCEPT
+    {
+        return true;
+    }
+
+    //! Blocks until unparked
+    void park() BOOST_NOEXCEPT
+    {
+        while (futex_operations::load(m_state, boost::memory_order_acquire) == 0u)
+            atomics::detail::futex_wait_private(&m_state, 0u);
+    }
+
+    //! Unblocks the parked thread
+    void unpark() BOOST_NOEXCEPT
+    {
+        futex_operations::store(m_state, 1u, boost::memory_order_release);
+        atomics::detail::futex_signal_private(&m_state);
+    }
+};
+
+#else
+
+#if BOOST_USE_WINAPI_VERSION >= BOOST_WINAPI_VERSION_WIN6
+
+//! Bucket lock
+struct bucket_lock
+{
+    //! Mutex
+    boost::winapi::SRWLOCK_ m_mutex;
+
+    void init() BOOST_NOEXCEPT
+    {
+        boost::winapi::InitializeSRWLock(&m_mutex);
+    }
+
+    void destroy() BOOST_NOEXCEPT
+    {
+    }
+
+    void lock() BOOST_NOEXCEPT
+    {
+        boost::winapi::AcquireSRWLockExclusive(&m_mutex);
+    }
+
+    void unlock() BOOST_NOEXCEPT
+    {
+        boost::winapi::ReleaseSRWLockExclusive(&m_mutex);
+    }
+};
+
+//! Parking primitive of a parked thread
+struct parker :
+    public parker_base
+{
+    // SRW locks are not documented to allow freeing the lock memory while the unlocking thread may still access it
+    static BOOST_CONSTEXPR_OR_CONST bool unpark_under_lock = true;
+
+    boost::winapi::SRWLOCK_ m_mutex;
+    boost::winapi::CONDITION_VARIABLE_ m_cond;
+    bool m_unparked;
+
+    parker() BOOST_NOEXCEPT :
+        m_unparked(false)
+    {
+        boost::winapi::InitializeSRWLock(&m_mutex);
+        boost::winapi::InitializeConditionVariable(&m_cond);
+    }
+
+    bool is_valid() const BOOST_NOEXCEPT
+    {
+        return true;
+    }
+
+    //! Blocks until unparked
+    void park() BOOST_NOEXCEPT
+    {
+        boost::winapi::AcquireSRWLockExclusive(&m_mutex);
+        while (!m_unparked)
+            boost::winapi::SleepConditionVariableSRW(&m_cond, &m_mutex, boost::winapi::infinite, 0u);
+        boost::winapi::ReleaseSRWLockExclusive(&m_mutex);
+    }
+
+    //! Unblocks the parked thread
+    void unpark() BOOST_NOEXCEPT
+    {
+        boost::winapi::AcquireSRWLockExclusive(&m_mutex);
+        m_unparked = true;
+        boost::winapi::WakeConditionVariable(&m_cond);
+        boost::winapi::ReleaseSRWLockExclusive(&m_mutex);
+    }
+};
+
+#else // BOOST_USE_WINAPI_VERSION >= BOOST_WINAPI_VERSION_WIN6
+
+//! Bucket lock
+struct bucket_lock
+{
+    //! Mutex
+    boost::winapi::CRITICAL_SECTION_ m_mutex;
+
+    void init() BOOST_NOEXCEPT
+    {
+        boost::winapi::InitializeCriticalSection(&m_mutex);
+    }
+
+    void destroy() BOOST_NOEXCEPT
+    {
+        boost::winapi::DeleteCriticalSection(&m_mutex);
+    }
+
+    void lock() BOOST_NOEXCEPT
+    {
+        boost::winapi::EnterCriticalSection(&m_mutex);
+    }
+
+    void unlock() BOOST_NOEXCEPT
+    {
+        boost::winapi::LeaveCriticalSection(&m_mutex);
+    }
+};
+
+//! Parking primitive of a parked thread
+struct parker :
+    public parker_base
+{
+    // The semaphore is a reference counted kernel object, so the handle can be closed while another thread is releasing the semaphore
+    static BOOST_CONSTEXPR_OR_CONST bool unpark_under_lock = false;
+
+    boost::winapi::HANDLE_ m_semaphore;
+
+    parker() BOOST_NOEXCEPT :
+        m_semaphore(boost::winapi::create_anonymous_semaphore(NULL, 0, 1))
+    {
+    }
+
+    ~parker() BOOST_NOEXCEPT
+    {
+        if (BOOST_LIKELY(m_semaphore != NULL))
+            boost::winapi::CloseHandle(m_semaphore);
+    }
+
+    bool is_valid() const BOOST_NOEXCEPT
+    {
+        return m_semaphore != NULL;
+    }
+
+    //! Blocks until unparked
+    void park() BOOST_NOEXCEPT
+    {
+        boost::winapi::WaitForSingleObject(m_semaphore, boost::winapi::infinite);
+    }
+
+    //! Unblocks the parked thread
+    void unpark() BOOST_NOEXCEPT
+    {
+        boost::winapi::ReleaseSemaphore(m_semaphore, 1, NULL);
+    }
+};
+
+#endif // BOOST_USE_WINAPI_VERSION >= BOOST_WINAPI_VERSION_WIN6
+
+#endif
+
+//! Queue of the threads parked on the addresses that map to the bucket. Must be a POD structure.
+struct bucket
+{
+    bucket_lock m_lock;
+    //! The first parker in the queue
+    parker* m_head;
+    //! The last parker in the queue
+    parker* m_tail;
+
+    void push_back(parker* p) BOOST_NOEXCEPT
+    {
+        p->m_next = NULL;
+        if (m_tail)
+            m_tail->m_next = p;
+        else
+            m_head = p;
+        m_tail = p;
+    }
+};
+
+/*!
+ * \brief Hash table of buckets
+ *
+ * The table is replaced with a larger one as the number of parked threads grows. Threads may still attempt to lock buckets
+ * of the previous tables after they have been replaced, so the tables are never freed.
+ */
+struct hash_table
+{
+    //! Binary logarithm of the number of buckets
+    unsigned int m_size_log2;
+    //! Previous hash table
+    hash_table* m_previous;
+    //! Buckets. The actual number of elements is determined by m_size_log2.
+    bucket m_buckets[1];
+
+    std::size_t size() const BOOST_NOEXCEPT
+    {
+        return static_cast< std::size_t >(1u) << m_size_log2;
+    }
+};
+
+typedef atomics::detail::core_operations< sizeof(atomics::detail::uintptr_t), false, false > pointer_operations;
+typedef atomics::detail::core_operations< sizeof(std::size_t), false, false > count_operations;
+BOOST_STATIC_ASSERT_MSG(pointer_operations::is_always_lock_free && count_operations::is_always_lock_free, "Boost.Atomic unsupported target platform: native atomic operations not implemented for pointers");
+
+//! Binary logarithm of the initial number of buckets
+BOOST_CONSTEXPR_OR_CONST unsigned int initial_size_log2 = 6u;
+//! The hash table is replaced when there are less buckets than this number multiplied by the number of parked threads
+BOOST_CONSTEXPR_OR_CONST std::size_t min_buckets_per_thread = 3u;
+//! The new hash table has at least this many times more buckets per parked thread than the minimum
+BOOST_CONSTEXPR_OR_CONST std::size_t growth_factor = 2u;
+
+//! Binary logarithm of the number of entries with the per-address counters
+BOOST_CONSTEXPR_OR_CONST unsigned int address_counters_size_log2 = 8u;
+
+//! Pointer to the current hash table
+static pointer_operations::storage_type g_hash_table = 0u;
+//! Number of threads that are currently parking or parked
+static count_operations::storage_type g_parked_count = 0u;
+
+//! The maximum duration of polling the atomic object by the adaptive waiting before blocking, in nanoseconds
+BOOST_CONSTEXPR_OR_CONST unsigned int adaptive_max_spin_duration_ns = 80000u;
+//! Binary logarithm of the weight of the previous estimate in the moving average of the spin count estimates
+BOOST_CONSTEXPR_OR_CONST unsigned int adaptive_spin_count_decay_log2 = 3u;
+
+//! Counters for the addresses that map to the same entry. Every entry occupies a separate cache line to avoid false sharing.
+struct BOOST_ALIGNMENT(BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE) address_counters
+{
+    /*!
+     * Number of threads that are currently parking or parked on the addresses. The counter allows to unpark without locking
+     * a bucket if there are no parked threads. Unlike buckets, the counters are not moved when the hash table is replaced,
+     * so that they can be read without locking.
+     */
+    count_operations::storage_type waiter_count;
+    /*!
+     * Estimate of the number of times the atomic objects at the addresses are polled before their values change. The estimate
+     * is a moving average of the observed numbers of iterations. When the thread has to block, the estimate is decreased,
+     * as polling was ineffective.
+     */
+    count_operations::storage_type adaptive_spin_count;
+    // The additional padding is needed to avoid false sharing between the entries
+    char padding[BOOST_ATOMIC_DETAIL_CACHE_LINE_SIZE - 2u * sizeof(count_operations::storage_type)];
+};
+
+static address_counters g_address_counters[static_cast< std::size_t >(1u) << address_counters_size_log2] = {};
+
+//! Returns the index of the bucket for the address
+BOOST_FORCEINLINE std::size_t get_bucket_index(const volatile void* addr, unsigned int size_log2) BOOST_NOEXCEPT
+{
+    // Fibonacci hashing
+    atomics::detail::uintptr_t h = reinterpret_cast< atomics::detail::uintptr_t >(addr);
+    BOOST_IF_CONSTEXPR (sizeof(atomics::detail::uintptr_t) >= 8u)
+        h *= static_cast< atomics::detail::uintptr_t >(0x9E3779B97F4A7C15ull);
+    else
+        h *= static_cast< atomics::detail::uintptr_t >(0x9E3779B9u);
+
+    return static_cast< std::size_t >(h >> (sizeof(atomics::detail::uintptr_t) * 8u - size_log2));
+}
+
+//! Allocates and initializes a new hash table. Returns NULL in case of failure.
+hash_table* create_hash_table(unsigned int size_log2, hash_table* previous) BOOST_NOEXCEPT
+{
+    const std::size_t size = static_cast< std::size_t >(1u) << size_log2;
+    hash_table* table = static_cast< hash_table* >(std::malloc(sizeof(hash_table) + (size - 1u) * sizeof(bucket)));
+    if (BOOST_UNLIKELY(table == NULL))
+        return NULL;
+
+    table->m_size_log2 = size_log2;
+    table->m_previous = previous;
+    for (std::size_t i = 0u; i < size; ++i)
+    {
+        bucket& b = table->m_buckets[i];
+        b.m_lock.init();
+        b.m_head = NULL;
+        b.m_tail = NULL;
+    }
+
+    return table;
+}
+
+//! Destroys a hash table that was never published
+void destroy_hash_table(hash_table* table) BOOST_NOEXCEPT
+{
+    for (std::size_t i = 0u, n = table->size(); i < n; ++i)
+        table->m_buckets[i].m_lock.destroy();
+    std::free(table);
+}
+
+//! Returns the current hash table, creating it if needed. Returns NULL in case of failure.
+hash_table* get_hash_table() BOOST_NOEXCEPT
+{
+    hash_table* table = reinterpret_cast< hash_table* >(pointer_operations::load(g_hash_table, boost::memory_order_acquire));
+    if (BOOST_UNLIKELY(table == NULL))
+    {
+        hash_table* new_table = create_hash_table(initial_size_log2, NULL);
+        if (BOOST_UNLIKELY(new_table == NULL))
+            return NULL;
+
+        pointer_operations::storage_type expected = 0u;
+        if (pointer_operations::compare_exchange_strong(g_hash_table, expected, reinterpret_cast< pointer_operations::storage_type >(new_table), boost::memory_order_acq_rel, boost::memory_order_acquire))
+        {
+            table = new_table;
+        }
+        else
+        {
+            destroy_hash_table(new_table);
+            table = reinterpret_cast< hash_table* >(expected);
+        }
+    }
+
+    return table;
+}
+
+//! Locks the bucket for the address in the current hash table. Returns NULL in case of failure.
+bucket* lock_bucket(const volatile void* addr) BOOST_NOEXCEPT
+{
+    while (true)
+    {
+        hash_table* table = get_hash_table();
+        if (BOOST_UNLIKELY(table == NULL))
+            return NULL;
+
+        bucket& b = table->m_buckets[get_bucket_index(addr, table->m_size_log2)];
+        b.m_lock.lock();
+
+        // The table may have been replaced while we were waiting for the lock. The replacing thread publishes the new table
+        // before unlocking the buckets of the old one, so the new pointer is visible here.
+        if (BOOST_LIKELY(pointer_operations::load(g_hash_table, boost::memory_order_relaxed) == reinterpret_cast< pointer_operations::storage_type >(table)))
+            return &b;
+
+        b.m_lock.unlock();
+    }
+}
+
+//! Replaces the hash table with a larger one if it has too few buckets for the number of parked threads
+void ensure_hash_table_size(std::size_t parked_count) BOOST_NOEXCEPT
+{
+    const std::size_t min_size = parked_count * min_buckets_per_thread;
+    while (true)
+    {
+        hash_table* table = get_hash_table();
+        if (BOOST_LIKELY(table == NULL || table->size() >= min_size))
+            return;
+
+        // Lock all buckets, in the order of their indices to avoid deadlocks with other threads replacing the table
+        const std::size_t size = table->size();
+        for (std::size_t i = 0u; i < size; ++i)
+            table->m_buckets[i].m_lock.lock();
+
+        bool done = false;
+        if (pointer_operations::load(g_hash_table, boost::memory_order_relaxed) == reinterpret_cast< pointer_operations::storage_type >(table))
+        {
+            unsigned int new_size_log2 = table->m_size_log2 + 1u;
+            while ((static_cast< std::size_t >(1u) << new_size_log2) < min_size * growth_factor)
+                ++new_size_log2;
+
+            // If we fail to allocate a new table, keep using the current one
+            done = true;
+            hash_table* new_table = create_hash_table(new_size_log2, table);
+            if (BOOST_LIKELY(new_table != NULL))
+            {
+                // Move the parked threads to the new table. Threads parked on the same address are in the same bucket, so their order is preserved.
+                for (std::size_t i = 0u; i < size; ++i)
+                {
+                    bucket& b = table->m_buckets[i];
+                    for (parker* p = b.m_head; p != NULL;)
+                    {
+                        parker* next = p->m_next;
+                        new_table->m_buckets[get_bucket_index(p->m_addr, new_size_log2)].push_back(p);
+                        p = next;
+                    }
+
+                    b.m_head = NULL;
+                    b.m_tail = NULL;
+                }
+
+                pointer_operations::store(g_hash_table, reinterpret_cast< pointer_operations::storage_type >(new_table), boost::memory_order_release);
+            }
+        }
+
+        for (std::size_t i = size; i > 0u; --i)
+            table->m_buckets[i - 1u].m_lock.unlock();
+
+        if (done)
+            return;
+    }
+}
+
+//! List of parkers removed from a bucket
+struct unparked_list
+{
+    parker* m_head;
+    parker** m_tail;
+
+    unparked_list() BOOST_NOEXCEPT : m_head(NULL), m_tail(&m_head)
+    {
+    }
+};
+
+//! Removes up to \a count parkers parked on \a addr from the locked bucket and appends them to \a unparked. Returns the number of removed parkers.
+std::size_t dequeue_parkers(bucket& b, const volatile void* addr, std::size_t count, unparked_list& unparked) BOOST_NOEXCEPT
+{
+    std::size_t unparked_count = 0u;
+    parker* prev = NULL;
+    for (parker* p = b.m_head; p != NULL && unparked_count < count;)
+    {
+        parker* next = p->m_next;
+        if (p->m_addr == addr)
+        {
+            if (prev)
+                prev->m_next = next;
+            else
+                b.m_head = next;
+            if (b.m_tail == p)
+                b.m_tail = prev;
+
+            p->m_next = NULL;
+            *unparked.m_tail = p;
+            unparked.m_tail = &p->m_next;
+            ++unparked_count;
+        }
+        else
+        {
+            prev = p;
+        }
+
+        p = next;
+    }
+
+    return unparked_count;
+}
+
+//! Unparks the parkers removed from the locked bucket and unlocks the bucket
+void unpark_and_unlock(bucket& b, parker* unparked) BOOST_NOEXCEPT
+{
+    BOOST_IF_CONSTEXPR (!parker::unpark_under_lock)
+        b.m_lock.unlock();
+
+    for (parker* p = unparked; p != NULL;)
+    {
+        // The parker may be destroyed as soon as it is unparked
+        parker* next = p->m_next;
+        p->unpark();
+        p = next;
+    }
+
+    BOOST_IF_CONSTEXPR (parker::unpark_under_lock)
+        b.m_lock.unlock();
+}
+
+} // namespace
+
+BOOST_ATOMIC_DECL void park(const volatile void* addr, validate_func validate, const void* context) BOOST_NOEXCEPT
+{
+    parker p;
+    if (BOOST_LIKELY(p.is_valid()))
+    {
+        p.m_addr = addr;
+
+        count_operations::storage_type& waiter_count = g_address_counters[get_bucket_index(addr, address_counters_size_log2)].waiter_count;
+        count_operations::fetch_add(waiter_count, 1u, boost::memory_order_relaxed);
+        // Pairs with the fence in unpark. Either the validation observes the change of the value that precedes unpark,
+        // or unpark observes the incremented waiter count.
+        atomics::detail::fence_operations::thread_fence(boost::memory_order_seq_cst);
+
+        const std::size_t parked_count = count_operations::fetch_add(g_parked_count, 1u, boost::memory_order_relaxed) + 1u;
+        ensure_hash_table_size(parked_count);
+
+        bucket* b = lock_bucket(addr);
+        if (BOOST_LIKELY(b != NULL))
+        {
+            if (validate(addr, context))
+            {
+                b->push_back(&p);
+                b->m_lock.unlock();
+
+                p.park();
+
+                BOOST_IF_CONSTEXPR (parker::unpark_under_lock)
+                {
+                    // Wait until the unparking thread unlocks the bucket, after which it no longer accesses the parker
+                    lock_bucket(addr)->m_lock.unlock();
+                }
+            }
+            else
+            {
+                b->m_lock.unlock();
+            }
+
+            count_operations::fetch_sub(g_parked_count, 1u, boost::memory_order_relaxed);
+            count_operations::fetch_sub(waiter_count, 1u, boost::memory_order_relaxed);
+            return;
+        }
+
+        count_operations::fetch_sub(g_parked_count, 1u, boost::memory_order_relaxed);
+        count_operations::fetch_sub(waiter_count, 1u, boost::memory_order_relaxed);
+    }
+
+    // We are out of resources and cannot block. Let other threads run to avoid busy waiting in the caller.
+    atomics::detail::wait_some();
+}
+
+BOOST_ATOMIC_DECL std::size_t unpark(const volatile void* addr, std::size_t count) BOOST_NOEXCEPT
+{
+    // Fast path: don't lock the bucket if there are no threads parked on addresses that map to the same waiter counter
+    atomics::detail::fence_operations::thread_fence(boost::memory_order_seq_cst);
+    if (count_operations::load(g_address_counters[get_bucket_index(addr, address_counters_size_log2)].waiter_count, boost::memory_order_relaxed) == 0u)
+        return 0u;
+
+    bucket* b = lock_bucket(addr);
+    if (BOOST_UNLIKELY(b == NULL))
+    {
+        // No hash table means that no threads could have been parked
+        return 0u;
+    }
+
+    unparked_list unparked;
+    const std::size_t unparked_count = dequeue_parkers(*b, addr, count, unparked);
+    unpark_and_unlock(*b, unparked.m_head);
+
+    return unparked_count;
+}
+
+BOOST_ATOMIC_DECL void unpark_multiple(unpark_request* requests, std::size_t count) BOOST_NOEXCEPT
+{
+    // Pairs with the fence in park, same as in unpark
+    atomics::detail::fence_operations::thread_fence(boost::memory_order_seq_cst);
+
+    // Drop the requests for addresses with no parked threads
+    std::size_t size = 0u;
+    for (std::size_t i = 0u; i < count; ++i)
+    {
+        if (count_operations::load(g_address_counters[get_bucket_index(requests[i].addr, address_counters_size_log2)].waiter_count, boost::memory_order_relaxed) != 0u)
+            requests[size++] = requests[i];
+    }
+
+    if (size == 0u)
+        return;
+
+    hash_table* table = get_hash_table();
+    if (BOOST_UNLIKELY(table == NULL))
+        return;
+
+    // Group the requests by buckets. The number of requests is expected to be small, so use insertion sort.
+    const unsigned int size_log2 = table->m_size_log2;
+    for (std::size_t i = 1u; i < size; ++i)
+    {
+        const unpark_request request = requests[i];
+        const std::size_t index = get_bucket_index(request.addr, size_log2);
+        std::size_t j = i;
+        for (; j > 0u && get_bucket_index(requests[j - 1u].addr, size_log2) > index; --j)
+            requests[j] = requests[j - 1u];
+        requests[j] = request;
+    }
+
+    for (std::size_t i = 0u; i < size;)
+    {
+        const std::size_t index = get_bucket_index(requests[i].addr, size_log2);
+        bucket& b = table->m_buckets[index];
+        b.m_lock.lock();
+
+        if (BOOST_UNLIKELY(pointer_operations::load(g_hash_table, boost::memory_order_relaxed) != reinterpret_cast< pointer_operations::storage_type >(table)))
+        {
+            // The table has been replaced, which is rare. Unpark the remaining addresses one by one.
+            b.m_lock.unlock();
+            for (; i < size; ++i)
+                parking_lot::unpark(requests[i].addr, requests[i].count);
+            return;
+        }
+
+        unparked_list unparked;
+        do
+        {
+            dequeue_parkers(b, requests[i].addr, requests[i].count, unparked);
+            ++i;
+        }
+        while (i < size && get_bucket_index(requests[i].addr, size_log2) == index);
+
+        unpark_and_unlock(b, unparked.m_head);
+    }
+}
+
+BOOST_ATOMIC_DECL unsigned int get_adaptive_spin_count(const volatile void* addr) BOOST_NOEXCEPT
+{
+    const std::size_t estimate = count_operations::load(g_address_counters[get_bucket_index(addr, address_counters_size_log2)].adaptive_spin_count, boost::memory_order_relaxed);
+    // Poll for up to twice the estimate to be able to observe that the waiting durations are increasing
+    const std::size_t spin_count = estimate * 2u + atomics::detail::get_pause_count(atomics::detail::wait_spin_duration_ns);
+    const unsigned int max_spin_count = atomics::detail::get_pause_count(adaptive_max_spin_duration_ns);
+    return spin_count < max_spin_count ? static_cast< unsigned int >(spin_count) : max_spin_count;
+}
+
+BOOST_ATOMIC_DECL void update_adaptive_spin_count(const volatile void* addr, unsigned int spin_count, bool blocked) BOOST_NOEXCEPT
+{
+    count_operations::storage_type& storage = g_address_counters[get_bucket_index(addr, address_counters_size_log2)].adaptive_spin_count;
+    std::size_t estimate = count_operations::load(storage, boost::memory_order_relaxed);
+    if (blocked)
+    {
+        estimate -= estimate >> adaptive_spin_count_decay_log2;
+    }
+    else
+    {
+        // Compute the moving average. Concurrent updates may be lost, which is acceptable as the estimate is only a heuristic.
+        estimate = (estimate * ((1u << adaptive_spin_count_decay_log2) - 1u) + spin_count) >> adaptive_spin_count_decay_log2;
+    }
+
+    count_operations::store(storage, estimate, boost::memory_order_relaxed);
+}
+
+} // namespace parking_lot
+} // namespace detail
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
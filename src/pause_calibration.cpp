@@ -0,0 +1,193 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2026 agent
+ */
+/*!
+ * \file   pause_calibration.cpp
+ *
+ * This file contains implementation of the runtime calibration of the pause instruction duration.
+ */
+
+#include <boost/predef/os/windows.h>
+#if BOOST_OS_WINDOWS
+// Include boost/winapi/config.hpp first to make sure target Windows version is selected by Boost.WinAPI
+#include <boost/winapi/config.hpp>
+#endif
+
+#include <cstdlib>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/memory_order.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/link.hpp>
+#include <boost/atomic/detail/aligned_variable.hpp>
+#include <boost/atomic/detail/core_operations.hpp>
+#include <boost/atomic/detail/pause.hpp>
+#include <boost/atomic/detail/pause_calibration.hpp>
+
+#if BOOST_OS_WINDOWS
+#include <boost/winapi/basic_types.hpp>
+#include <boost/winapi/timers.hpp>
+#define BOOST_ATOMIC_USE_WINAPI
+#else
+#include <time.h>
+#if defined(CLOCK_MONOTONIC)
+#define BOOST_ATOMIC_USE_CLOCK_GETTIME
+#endif
+#endif
+
+#include <boost/atomic/detail/header.hpp>
+
+namespace boost {
+namespace atomics {
+namespace detail {
+
+namespace {
+
+typedef atomics::detail::core_operations< 4u, false, false > duration_operations;
+BOOST_STATIC_ASSERT_MSG(duration_operations::is_always_lock_free, "Boost.Atomic unsupported target platform: native atomic operations not implemented for 32-bit integers");
+
+struct cached_duration
+{
+    BOOST_ATOMIC_DETAIL_ALIGNED_VAR(duration_operations::storage_alignment, duration_operations::storage_type, m_duration);
+};
+
+//! The spin loop iteration duration in picoseconds, or 0 if not calibrated yet
+static cached_duration g_pause_duration = {};
+
+//! The spin loop iteration duration that is used if it cannot be measured, in picoseconds
+BOOST_CONSTEXPR_OR_CONST unsigned int default_pause_duration_ps = 20000u;
+//! The minimum spin loop iteration duration, in picoseconds. Shorter durations are rounded up to limit the number of iterations in spin loops.
+BOOST_CONSTEXPR_OR_CONST unsigned int min_pause_duration_ps = 1000u;
+//! The maximum accepted spin loop iteration duration, in picoseconds
+BOOST_CONSTEXPR_OR_CONST unsigned int max_pause_duration_ps = 10000000u;
+//! Number of spin loop iterations executed in one calibration round
+BOOST_CONSTEXPR_OR_CONST unsigned int calibration_pause_count = 1000u;
+//! Number of calibration rounds. The shortest round is used to reduce the effect of preemption and interrupts.
+BOOST_CONSTEXPR_OR_CONST unsigned int calibration_round_count = 5u;
+
+#if defined(BOOST_ATOMIC_USE_WINAPI)
+
+//! Returns the current steady clock time, in nanoseconds, or 0 if the clock is not available
+boost::uint64_t get_time_ns() BOOST_NOEXCEPT
+{
+    boost::winapi::LARGE_INTEGER_ freq, counter;
+    if (!boost::winapi::QueryPerformanceFrequency(&freq) || freq.QuadPart <= 0 || !boost::winapi::QueryPerformanceCounter(&counter))
+        return 0u;
+
+    const boost::uint64_t ticks = static_cast< boost::uint64_t >(counter.QuadPart), frequency = static_cast< boost::uint64_t >(freq.QuadPart);
+    return (ticks / frequency) * 1000000000u + (ticks % frequency) * 1000000000u / frequency;
+}
+
+#elif defined(BOOST_ATOMIC_USE_CLOCK_GETTIME)
+
+//! Returns the current steady clock time, in nanoseconds, or 0 if the clock is not available
+boost::uint64_t get_time_ns() BOOST_NOEXCEPT
+{
+    struct ::timespec ts = {};
+    if (::clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+        return 0u;
+
+    return static_cast< boost::uint64_t >(ts.tv_sec) * 1000000000u + static_cast< boost::uint64_t >(ts.tv_nsec);
+}
+
+#endif
+
+//! Parses the pause duration from the environment variable. Returns 0 if the variable is not set or invalid.
+unsigned int read_env_pause_duration() BOOST_NOEXCEPT
+{
+    const char* str = std::getenv("BOOST_ATOMIC_PAUSE_NS");
+    if (str == NULL)
+        return 0u;
+
+    char* end = NULL;
+    const double value = std::strtod(str, &end) * 1000.0;
+    if (end == str || !(value > 0.0 && value <= static_cast< double >(max_pause_duration_ps)))
+        return 0u;
+
+    const unsigned int duration = static_cast< unsigned int >(value + 0.5);
+    return duration > min_pause_duration_ps ? duration : min_pause_duration_ps;
+}
+
+/*!
+ * Measures the duration of a spin loop iteration, which consists of a pause instruction and a relaxed load. Returns 0 if it cannot be measured.
+ * On targets without a pause instruction the duration is not measured, as the iteration consists of the load only and its duration
+ * is not representative of the time it takes for another thread to make progress.
+ */
+unsigned int measure_pause_duration() BOOST_NOEXCEPT
+{
+#if defined(BOOST_ATOMIC_DETAIL_HAS_PAUSE) && (defined(BOOST_ATOMIC_USE_WINAPI) || defined(BOOST_ATOMIC_USE_CLOCK_GETTIME))
+    boost::uint64_t min_elapsed = ~static_cast< boost::uint64_t >(0u);
+    for (unsigned int round = 0u; round < calibration_round_count; ++round)
+    {
+        const boost::uint64_t start = get_time_ns();
+        for (unsigned int i = 0u; i < calibration_pause_count; ++i)
+        {
+            atomics::detail::pause();
+            duration_operations::load(g_pause_duration.m_duration, boost::memory_order_relaxed);
+        }
+        const boost::uint64_t end = get_time_ns();
+
+        if (start == 0u || end < start)
+            return 0u;
+
+        const boost::uint64_t elapsed = end - start;
+        if (elapsed < min_elapsed)
+            min_elapsed = elapsed;
+    }
+
+    const boost::uint64_t duration = min_elapsed * 1000u / calibration_pause_count;
+    if (duration > max_pause_duration_ps)
+        return 0u;
+
+    // If the iteration is faster than the clock resolution allows to measure, assume the minimum duration
+    return duration > min_pause_duration_ps ? static_cast< unsigned int >(duration) : min_pause_duration_ps;
+#else
+    return 0u;
+#endif
+}
+
+//! Calibrates the spin loop iteration duration. Concurrent callers may repeat the calibration, which is harmless.
+unsigned int calibrate_pause_duration() BOOST_NOEXCEPT
+{
+    unsigned int duration = read_env_pause_duration();
+    if (duration == 0u)
+    {
+        duration = measure_pause_duration();
+        if (duration == 0u)
+            duration = default_pause_duration_ps;
+    }
+
+    duration_operations::store(g_pause_duration.m_duration, static_cast< duration_operations::storage_type >(duration), boost::memory_order_relaxed);
+    return duration;
+}
+
+} // namespace
+
+BOOST_ATOMIC_DECL unsigned int get_pause_duration_ps() BOOST_NOEXCEPT
+{
+    unsigned int duration = static_cast< unsigned int >(duration_operations::load(g_pause_duration.m_duration, boost::memory_order_relaxed));
+    if (BOOST_UNLIKELY(duration == 0u))
+        duration = calibrate_pause_duration();
+
+    return duration;
+}
+
+BOOST_ATOMIC_DECL unsigned int get_pause_count(unsigned int duration_ns) BOOST_NOEXCEPT
+{
+    const boost::uint64_t count = static_cast< boost::uint64_t >(duration_ns) * 1000u / get_pause_duration_ps();
+    if (BOOST_UNLIKELY(count == 0u))
+        return 1u;
+
+    return count <= ~0u ? static_cast< unsigned int >(count) : ~0u;
+}
+
+} // namespace detail
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
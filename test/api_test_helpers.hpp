@@ -585,6 +585,98 @@ void test_negation()
     }
 }
 
+template< template< typename > class Wrapper, typename T >
+void test_min_max(T lower, T higher)
+{
+    {
+        Wrapper<T> wrapper(lower);
+        typename Wrapper<T>::atomic_reference_type a = wrapper.a;
+        T n = a.fetch_max(higher);
+        BOOST_TEST_EQ( a.load(), higher );
+        BOOST_TEST_EQ( n, lower );
+
+        n = a.fetch_max(lower);
+        BOOST_TEST_EQ( a.load(), higher );
+        BOOST_TEST_EQ( n, higher );
+    }
+    {
+        Wrapper<T> wrapper(higher);
+        typename Wrapper<T>::atomic_reference_type a = wrapper.a;
+        T n = a.fetch_min(lower);
+        BOOST_TEST_EQ( a.load(), lower );
+        BOOST_TEST_EQ( n, higher );
+
+        n = a.fetch_min(higher);
+        BOOST_TEST_EQ( a.load(), lower );
+        BOOST_TEST_EQ( n, lower );
+    }
+    {
+        Wrapper<T> wrapper(lower);
+        typename Wrapper<T>::atomic_reference_type a = wrapper.a;
+        a.opaque_max(higher);
+        BOOST_TEST_EQ( a.load(), higher );
+
+        a.opaque_min(lower);
+        BOOST_TEST_EQ( a.load(), lower );
+
+        a.opaque_min(higher);
+        BOOST_TEST_EQ( a.load(), lower );
+    }
+}
+
+//! Increments the value, unless it has reached the limit
+template< typename T >
+struct bounded_increment
+{
+    T limit;
+    unsigned int* call_count;
+
+    bounded_increment(T lim, unsigned int* count) : limit(lim), call_count(count) {}
+
+    bool operator() (T old_val, T& new_val) const
+    {
+        ++*call_count;
+        if (old_val >= limit)
+            return false;
+        new_val = old_val + (T)1;
+        return true;
+    }
+};
+
+template< template< typename > class Wrapper, typename T >
+void test_fetch_update(T value)
+{
+    {
+        Wrapper<T> wrapper(value);
+        typename Wrapper<T>::atomic_reference_type a = wrapper.a;
+        unsigned int call_count = 0u;
+        bounded_increment< T > f((T)(value + (T)1), &call_count);
+        T n = (T)0;
+        bool updated = a.fetch_update(f, n);
+        BOOST_TEST( updated );
+        BOOST_TEST_EQ( a.load(), (T)(value + (T)1) );
+        BOOST_TEST_EQ( n, value );
+
+        // The limit is reached, so the second update is aborted
+        updated = a.fetch_update(f, n, boost::memory_order_acq_rel);
+        BOOST_TEST( !updated );
+        BOOST_TEST_EQ( a.load(), (T)(value + (T)1) );
+        BOOST_TEST_EQ( n, (T)(value + (T)1) );
+    }
+    {
+        Wrapper<T> wrapper(value);
+        typename Wrapper<T>::atomic_reference_type a = wrapper.a;
+        unsigned int call_count = 0u;
+        T n = (T)0;
+        const bool updated = a.fetch_update(bounded_increment< T >(value, &call_count), n, boost::memory_order_relaxed);
+        BOOST_TEST( !updated );
+        BOOST_TEST_EQ( a.load(), value );
+        BOOST_TEST_EQ( n, value );
+        // The updater is not called again after it has aborted the operation
+        BOOST_TEST_EQ( call_count, 1u );
+    }
+}
+
 template< template< typename > class Wrapper, typename T >
 void test_additive_wrap(T value)
 {
@@ -860,6 +952,9 @@ void do_test_integral_api(boost::false_type)
     /* test for signed overflow/underflow */
     test_additive_operators< Wrapper, T, T >(((T)-1) >> (sizeof(T) * 8 - 1), 1);
     test_additive_operators< Wrapper, T, T >(1 + (((T)-1) >> (sizeof(T) * 8 - 1)), 1);
+
+    test_min_max< Wrapper, T >(42, 43);
+    test_fetch_update< Wrapper, T >(42);
 }
 
 template< template< typename > class Wrapper, typename T >
@@ -873,6 +968,10 @@ void do_test_integral_api(boost::true_type)
     BOOST_CONSTEXPR_OR_CONST T max_signed_twos_compl = all_ones >> 1;
     test_additive_wrap< Wrapper, T >(all_ones ^ max_signed_twos_compl);
     test_additive_wrap< Wrapper, T >(max_signed_twos_compl);
+
+    /* test that the comparison is unsigned */
+    test_min_max< Wrapper, T >(0u, all_ones);
+    test_min_max< Wrapper, T >(max_signed_twos_compl, all_ones ^ max_signed_twos_compl);
 }
 
 template< template< typename > class Wrapper, typename T >
@@ -881,7 +980,12 @@ inline void test_integral_api(void)
     do_test_integral_api< Wrapper, T >(boost::is_unsigned<T>());
 
     if (boost::is_signed<T>::value)
+    {
         test_negation< Wrapper, T >();
+        /* test that the comparison is signed */
+        test_min_max< Wrapper, T >((T)-1, (T)1);
+        test_min_max< Wrapper, T >((T)-100, (T)-1);
+    }
 }
 
 template< template< typename > class Wrapper, typename T >
@@ -1009,6 +1113,42 @@ void test_fp_negation()
     }
 }
 
+template< template< typename > class Wrapper, typename T >
+void test_fp_min_max(T lower, T higher)
+{
+    {
+        Wrapper<T> wrapper(lower);
+        typename Wrapper<T>::atomic_reference_type a = wrapper.a;
+        T n = a.fetch_max(higher);
+        BOOST_TEST_EQ( a.load(), approx(higher) );
+        BOOST_TEST_EQ( n, approx(lower) );
+
+        n = a.fetch_max(lower);
+        BOOST_TEST_EQ( a.load(), approx(higher) );
+        BOOST_TEST_EQ( n, approx(higher) );
+    }
+    {
+        Wrapper<T> wrapper(higher);
+        typename Wrapper<T>::atomic_reference_type a = wrapper.a;
+        T n = a.fetch_min(lower);
+        BOOST_TEST_EQ( a.load(), approx(lower) );
+        BOOST_TEST_EQ( n, approx(higher) );
+
+        n = a.fetch_min(higher);
+        BOOST_TEST_EQ( a.load(), approx(lower) );
+        BOOST_TEST_EQ( n, approx(lower) );
+    }
+    {
+        Wrapper<T> wrapper(lower);
+        typename Wrapper<T>::atomic_reference_type a = wrapper.a;
+        a.opaque_max(higher);
+        BOOST_TEST_EQ( a.load(), approx(higher) );
+
+        a.opaque_min(lower);
+        BOOST_TEST_EQ( a.load(), approx(lower) );
+    }
+}
+
 #endif // !defined(BOOST_ATOMIC_NO_FLOATING_POINT)
 
 template< template< typename > class Wrapper, typename T >
@@ -1023,6 +1163,9 @@ void test_floating_point_api(void)
     test_fp_additive_operators< Wrapper, T, T >(static_cast<T>(-42.5), static_cast<T>(-17.7));
 
     test_fp_negation< Wrapper, T >();
+
+    test_fp_min_max< Wrapper, T >(static_cast<T>(-42.5), static_cast<T>(17.7));
+    test_fp_min_max< Wrapper, T >(static_cast<T>(1.5), static_cast<T>(2.5));
 #endif
 }
 
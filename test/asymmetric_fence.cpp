@@ -0,0 +1,104 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies asymmetric fences. Two threads race in the store buffering pattern, one of them using the light fence
+// and the other one the heavy fence. As with sequentially consistent fences, at least one of the threads must observe
+// the store made by the other thread.
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/asymmetric_fence.hpp>
+
+#include <boost/config.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/barrier.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+const unsigned int round_count = 10000u;
+
+struct test_state
+{
+    boost::atomic< unsigned int > a;
+    boost::atomic< unsigned int > b;
+    unsigned int light_result;
+    unsigned int heavy_result;
+    boost::barrier start_barrier;
+    boost::barrier end_barrier;
+
+    test_state() : a(0u), b(0u), light_result(0u), heavy_result(0u), start_barrier(3u), end_barrier(3u)
+    {
+    }
+};
+
+void light_thread(test_state* state)
+{
+    for (unsigned int i = 0u; i < round_count; ++i)
+    {
+        state->start_barrier.wait();
+        state->a.store(1u, boost::memory_order_relaxed);
+        boost::atomics::asymmetric_thread_fence_light();
+        state->light_result = state->b.load(boost::memory_order_relaxed);
+        state->end_barrier.wait();
+    }
+}
+
+void heavy_thread(test_state* state)
+{
+    for (unsigned int i = 0u; i < round_count; ++i)
+    {
+        state->start_barrier.wait();
+        state->b.store(1u, boost::memory_order_relaxed);
+        boost::atomics::asymmetric_thread_fence_heavy();
+        state->heavy_result = state->a.load(boost::memory_order_relaxed);
+        state->end_barrier.wait();
+    }
+}
+
+void test_api()
+{
+    // Fences can be issued before initialization
+    boost::atomics::asymmetric_thread_fence_light();
+    boost::asymmetric_thread_fence_light();
+
+    const bool native = boost::atomics::asymmetric_fence_init();
+    BOOST_TEST_EQ(boost::asymmetric_fence_init(), native);
+
+    boost::atomics::asymmetric_thread_fence_light();
+    boost::atomics::asymmetric_thread_fence_heavy();
+    boost::asymmetric_thread_fence_heavy();
+}
+
+void test_store_buffering()
+{
+    test_state state;
+    boost::thread light(boost::bind(&light_thread, &state));
+    boost::thread heavy(boost::bind(&heavy_thread, &state));
+
+    unsigned int failures = 0u;
+    for (unsigned int i = 0u; i < round_count; ++i)
+    {
+        state.a.store(0u, boost::memory_order_relaxed);
+        state.b.store(0u, boost::memory_order_relaxed);
+        state.start_barrier.wait();
+        state.end_barrier.wait();
+        if (state.light_result == 0u && state.heavy_result == 0u)
+            ++failures;
+    }
+
+    light.join();
+    heavy.join();
+
+    BOOST_TEST_EQ(failures, 0u);
+}
+
+int main()
+{
+    test_api();
+    test_store_buffering();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,141 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies the bitmap allocator. The stress part of the test runs a number of threads that allocate
+// and free indices concurrently and checks that no index is owned by more than one thread at a time.
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/atomic_bitmap.hpp>
+
+#include <cstddef>
+#include <vector>
+#include <boost/config.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/barrier.hpp>
+#include <boost/smart_ptr/scoped_array.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+void test_api()
+{
+    {
+        boost::atomic_bitmap bitmap(0u);
+        BOOST_TEST_EQ(bitmap.size(), 0u);
+        BOOST_TEST_EQ(bitmap.allocate(), boost::atomic_bitmap::npos);
+    }
+
+    {
+        // The size is not a multiple of the word size
+        const std::size_t size = 200u;
+        boost::atomic_bitmap bitmap(size);
+        BOOST_TEST_EQ(bitmap.size(), size);
+        BOOST_TEST_EQ(bitmap.count(), 0u);
+
+        std::vector< bool > allocated(size, false);
+        for (std::size_t i = 0u; i < size; ++i)
+        {
+            const std::size_t index = bitmap.allocate();
+            BOOST_TEST(index < size);
+            if (index < size)
+            {
+                BOOST_TEST(!allocated[index]);
+                allocated[index] = true;
+                BOOST_TEST(bitmap.test(index));
+            }
+        }
+        BOOST_TEST_EQ(bitmap.count(), size);
+        BOOST_TEST_EQ(bitmap.allocate(), boost::atomic_bitmap::npos);
+
+        bitmap.free(5u);
+        BOOST_TEST(!bitmap.test(5u));
+        std::size_t hint = 150u;
+        BOOST_TEST_EQ(bitmap.allocate(hint), 5u);
+        BOOST_TEST_EQ(hint, 6u);
+
+        // Bulk free
+        const std::size_t indices[] = { 1u, 2u, 3u, 70u, 71u, 199u, 0u };
+        bitmap.free(indices, sizeof(indices) / sizeof(*indices));
+        BOOST_TEST_EQ(bitmap.count(), size - sizeof(indices) / sizeof(*indices));
+        for (std::size_t i = 0u; i < sizeof(indices) / sizeof(*indices); ++i)
+            BOOST_TEST(!bitmap.test(indices[i]));
+
+        BOOST_TEST(bitmap.try_set(70u));
+        BOOST_TEST(!bitmap.try_set(70u));
+
+        hint = 0u;
+        BOOST_TEST_EQ(bitmap.allocate(hint), 0u);
+        BOOST_TEST_EQ(bitmap.allocate(hint), 1u);
+    }
+}
+
+BOOST_CONSTEXPR_OR_CONST std::size_t bitmap_size = 1000u;
+BOOST_CONSTEXPR_OR_CONST unsigned int iteration_count = 100000u;
+BOOST_CONSTEXPR_OR_CONST unsigned int indices_per_thread = 100u;
+
+boost::atomic< unsigned int > g_errors(0u);
+
+void allocator_thread(boost::atomic_bitmap* bitmap, boost::atomic< unsigned int >* owners, boost::barrier* barrier, unsigned int id)
+{
+    std::size_t indices[indices_per_thread];
+    barrier->wait();
+
+    for (unsigned int i = 0u; i < iteration_count / indices_per_thread; ++i)
+    {
+        for (unsigned int j = 0u; j < indices_per_thread; ++j)
+        {
+            const std::size_t index = bitmap->allocate();
+            if (index >= bitmap_size || owners[index].exchange(id, boost::memory_order_relaxed) != 0u)
+                g_errors.fetch_add(1u, boost::memory_order_relaxed);
+            indices[j] = index;
+        }
+
+        for (unsigned int j = 0u; j < indices_per_thread; ++j)
+        {
+            if (indices[j] < bitmap_size && owners[indices[j]].exchange(0u, boost::memory_order_relaxed) != id)
+                g_errors.fetch_add(1u, boost::memory_order_relaxed);
+        }
+
+        // Alternate between single and bulk free
+        if ((i & 1u) == 0u)
+        {
+            for (unsigned int j = 0u; j < indices_per_thread; ++j)
+                bitmap->free(indices[j]);
+        }
+        else
+        {
+            bitmap->free(indices, indices_per_thread);
+        }
+    }
+}
+
+void test_stress()
+{
+    boost::atomic_bitmap bitmap(bitmap_size);
+    boost::scoped_array< boost::atomic< unsigned int > > owners(new boost::atomic< unsigned int >[bitmap_size]);
+    for (std::size_t i = 0u; i < bitmap_size; ++i)
+        owners[i].store(0u, boost::memory_order_relaxed);
+
+    const unsigned int thread_count = 4u;
+    boost::barrier barrier(thread_count);
+    boost::scoped_array< boost::thread > threads(new boost::thread[thread_count]);
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        boost::thread(boost::bind(&allocator_thread, &bitmap, owners.get(), &barrier, i + 1u)).swap(threads[i]);
+
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        threads[i].join();
+
+    BOOST_TEST_EQ(g_errors.load(), 0u);
+    BOOST_TEST_EQ(bitmap.count(), 0u);
+}
+
+int main()
+{
+    test_api();
+    test_stress();
+
+    return boost::report_errors();
+}
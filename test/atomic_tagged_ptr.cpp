@@ -0,0 +1,165 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies atomic_tagged_ptr operations. The stress part of the test runs a number of threads
+// that concurrently pop and push nodes of a lock-free free list, which is prone to the ABA problem
+// if the tag is not maintained correctly.
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/atomic_tagged_ptr.hpp>
+
+#include <cstddef>
+#include <boost/config.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/barrier.hpp>
+#include <boost/smart_ptr/scoped_array.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+struct node
+{
+    boost::atomic_tagged_ptr< node > next;
+    boost::atomic< unsigned int > owned;
+
+    node() : owned(0u) {}
+};
+
+void test_api()
+{
+    typedef boost::atomic_tagged_ptr< node >::value_type value_type;
+
+    node n1, n2;
+    boost::atomic_tagged_ptr< node > a;
+
+    BOOST_TEST(a.is_lock_free() == boost::atomic_tagged_ptr< node >::is_always_lock_free);
+    BOOST_TEST(boost::atomic_tagged_ptr< node >::tag_bits >= 16u);
+
+    value_type v = a.load();
+    BOOST_TEST(v.get_ptr() == static_cast< node* >(NULL));
+    BOOST_TEST_EQ(v.get_tag(), 0u);
+
+    a.store(value_type(&n1, 10u));
+    v = a.load(boost::memory_order_acquire);
+    BOOST_TEST(v.get_ptr() == &n1);
+    BOOST_TEST_EQ(v.get_tag(), 10u);
+
+    v = a.exchange(value_type(&n2, 20u));
+    BOOST_TEST(v == value_type(&n1, 10u));
+    BOOST_TEST(a.load() == value_type(&n2, 20u));
+
+    // Failed CAS due to tag mismatch
+    value_type expected(&n2, 19u);
+    BOOST_TEST(!a.compare_exchange_strong(expected, value_type(&n1, 30u)));
+    BOOST_TEST(expected == value_type(&n2, 20u));
+
+    BOOST_TEST(a.compare_exchange_strong(expected, value_type(&n1, 30u)));
+    BOOST_TEST(a.load() == value_type(&n1, 30u));
+
+    // CAS with automatic tag increment
+    expected = a.load();
+    BOOST_TEST(a.compare_exchange_strong(expected, &n2));
+    BOOST_TEST(a.load() == value_type(&n2, 31u));
+
+    expected = a.load();
+    while (!a.compare_exchange_weak(expected, static_cast< node* >(NULL), boost::memory_order_acq_rel, boost::memory_order_relaxed)) {}
+    BOOST_TEST(a.load() == value_type(NULL, 32u));
+
+    // Tag wraps around within tag_bits
+    a.store(value_type(&n1, 0u));
+    expected = a.load();
+    expected.set_tag(expected.get_tag() - 1u);
+    BOOST_TEST(!a.compare_exchange_strong(expected, &n2));
+    BOOST_TEST(expected == value_type(&n1, 0u));
+}
+
+class free_list
+{
+private:
+    boost::atomic_tagged_ptr< node > m_head;
+
+public:
+    void push(node* n)
+    {
+        boost::atomic_tagged_ptr< node >::value_type head = m_head.load(boost::memory_order_relaxed);
+        while (true)
+        {
+            n->next.store(boost::atomic_tagged_ptr< node >::value_type(head.get_ptr()), boost::memory_order_relaxed);
+            if (m_head.compare_exchange_weak(head, n, boost::memory_order_release, boost::memory_order_relaxed))
+                break;
+        }
+    }
+
+    node* pop()
+    {
+        boost::atomic_tagged_ptr< node >::value_type head = m_head.load(boost::memory_order_acquire);
+        while (head.get_ptr() != NULL)
+        {
+            node* next = head->next.load(boost::memory_order_relaxed).get_ptr();
+            if (m_head.compare_exchange_weak(head, next, boost::memory_order_acquire, boost::memory_order_acquire))
+                break;
+        }
+
+        return head.get_ptr();
+    }
+};
+
+BOOST_CONSTEXPR_OR_CONST unsigned int node_count = 8u;
+BOOST_CONSTEXPR_OR_CONST unsigned int iteration_count = 100000u;
+
+boost::atomic< unsigned int > g_errors(0u);
+
+void thread_func(free_list* list, boost::barrier* barrier)
+{
+    barrier->wait();
+
+    for (unsigned int i = 0u; i < iteration_count; ++i)
+    {
+        node* n = list->pop();
+        if (n == NULL)
+            continue;
+
+        // If the free list is corrupted due to ABA, the same node may be popped by multiple threads
+        if (n->owned.exchange(1u, boost::memory_order_relaxed) != 0u)
+            g_errors.fetch_add(1u, boost::memory_order_relaxed);
+
+        n->owned.store(0u, boost::memory_order_relaxed);
+        list->push(n);
+    }
+}
+
+void test_free_list()
+{
+    free_list list;
+    boost::scoped_array< node > nodes(new node[node_count]);
+    for (unsigned int i = 0u; i < node_count; ++i)
+        list.push(&nodes[i]);
+
+    const unsigned int thread_count = boost::thread::hardware_concurrency() < 2u ? 2u : boost::thread::hardware_concurrency();
+    boost::barrier barrier(thread_count);
+    boost::scoped_array< boost::thread > threads(new boost::thread[thread_count]);
+
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        boost::thread(boost::bind(&thread_func, &list, &barrier)).swap(threads[i]);
+
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        threads[i].join();
+
+    BOOST_TEST_EQ(g_errors.load(), 0u);
+
+    unsigned int count = 0u;
+    while (list.pop() != NULL)
+        ++count;
+    BOOST_TEST_EQ(count, node_count);
+}
+
+int main()
+{
+    test_api();
+    test_free_list();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,130 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies the barrier. A number of threads go through multiple phases, writing their phase numbers
+// before arriving at the barrier and checking the phase numbers of other threads after the phase completes.
+// The completion function and dropping out of the barrier are also tested.
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/barrier.hpp>
+
+#include <boost/config.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/smart_ptr/scoped_array.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+BOOST_CONSTEXPR_OR_CONST unsigned int thread_count = 6u;
+BOOST_CONSTEXPR_OR_CONST unsigned int phase_count = 20000u;
+
+//! Completion function that counts completed phases
+struct phase_counter
+{
+    unsigned int* m_count;
+
+    explicit phase_counter(unsigned int* count) : m_count(count)
+    {
+    }
+
+    void operator() () const BOOST_NOEXCEPT
+    {
+        ++*m_count;
+    }
+};
+
+typedef boost::atomics::barrier< phase_counter > barrier_type;
+
+void test_api()
+{
+    unsigned int completed = 0u;
+    barrier_type b(2, phase_counter(&completed));
+
+    barrier_type::arrival_token token = b.arrive();
+    BOOST_TEST_EQ(completed, 0u);
+    b.arrive();
+    BOOST_TEST_EQ(completed, 1u);
+    b.wait(token);
+
+    b.arrive(2);
+    BOOST_TEST_EQ(completed, 2u);
+
+    // Dropping reduces the number of expected arrivals in the next phases
+    b.arrive_and_drop();
+    b.arrive_and_wait();
+    BOOST_TEST_EQ(completed, 3u);
+    b.arrive_and_wait();
+    BOOST_TEST_EQ(completed, 4u);
+
+    boost::atomics::barrier<> b2(1);
+    b2.arrive_and_wait();
+    b2.wait(b2.arrive());
+}
+
+boost::atomic< unsigned int > g_errors(0u);
+
+void phase_thread(barrier_type* b, unsigned int* phases, unsigned int index, unsigned int* completed)
+{
+    for (unsigned int phase = 1u; phase <= phase_count; ++phase)
+    {
+        phases[index] = phase;
+
+        if ((phase & 1u) == 0u)
+            b->arrive_and_wait();
+        else
+            b->wait(b->arrive());
+
+        // Every iteration consists of two phases
+        if (*completed != 2u * phase - 1u)
+            g_errors.fetch_add(1u, boost::memory_order_relaxed);
+        for (unsigned int i = 0u; i < thread_count; ++i)
+        {
+            if (phases[i] != phase)
+                g_errors.fetch_add(1u, boost::memory_order_relaxed);
+        }
+
+        // Make sure no thread modifies its phase number until all threads have checked them
+        b->arrive_and_wait();
+    }
+
+    // The last thread leaves the barrier, which should not block the remaining threads
+    if (index == thread_count - 1u)
+    {
+        b->arrive_and_drop();
+    }
+    else
+    {
+        for (unsigned int i = 0u; i < 100u; ++i)
+            b->arrive_and_wait();
+    }
+}
+
+void test_stress()
+{
+    unsigned int completed = 0u;
+    boost::scoped_array< unsigned int > phases(new unsigned int[thread_count]);
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        phases[i] = 0u;
+
+    barrier_type b(thread_count, phase_counter(&completed));
+    boost::scoped_array< boost::thread > threads(new boost::thread[thread_count]);
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        boost::thread(boost::bind(&phase_thread, &b, phases.get(), i, &completed)).swap(threads[i]);
+
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        threads[i].join();
+
+    BOOST_TEST_EQ(g_errors.load(), 0u);
+    BOOST_TEST_EQ(completed, 2u * phase_count + 100u);
+}
+
+int main()
+{
+    test_api();
+    test_stress();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,170 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies the bounded MPMC queue. The stress part of the test runs a number of producer and consumer threads
+// that use blocking operations on a small queue and checks that every pushed element is popped exactly once.
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/bounded_mpmc_queue.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <boost/config.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/barrier.hpp>
+#include <boost/smart_ptr/scoped_array.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+//! Element type that counts live instances
+struct counted
+{
+    static int live_count;
+
+    unsigned int value;
+
+    counted() : value(0u) { ++live_count; }
+    explicit counted(unsigned int v) : value(v) { ++live_count; }
+    counted(counted const& that) : value(that.value) { ++live_count; }
+    ~counted() { --live_count; }
+
+    counted& operator= (counted const& that)
+    {
+        value = that.value;
+        return *this;
+    }
+};
+
+int counted::live_count = 0;
+
+void test_api()
+{
+    {
+        boost::bounded_mpmc_queue< unsigned int > q(0u);
+        BOOST_TEST_EQ(q.capacity(), 2u);
+    }
+
+    {
+        boost::bounded_mpmc_queue< unsigned int > q(5u);
+        BOOST_TEST_EQ(q.capacity(), 8u);
+
+        unsigned int value = 0u;
+        BOOST_TEST(!q.try_pop(value));
+
+        // Go around the ring several times
+        for (unsigned int lap = 0u; lap < 3u; ++lap)
+        {
+            for (unsigned int i = 0u; i < 8u; ++i)
+                BOOST_TEST(q.try_push(lap * 10u + i));
+            BOOST_TEST(!q.try_push(100u));
+
+            for (unsigned int i = 0u; i < 8u; ++i)
+            {
+                BOOST_TEST(q.try_pop(value));
+                BOOST_TEST_EQ(value, lap * 10u + i);
+            }
+            BOOST_TEST(!q.try_pop(value));
+        }
+
+        q.push_wait(42u);
+        q.pop_wait(value);
+        BOOST_TEST_EQ(value, 42u);
+    }
+
+    // The queue destroys the remaining elements
+    {
+        boost::bounded_mpmc_queue< counted > q(4u);
+        for (unsigned int i = 0u; i < 4u; ++i)
+            BOOST_TEST(q.try_push(counted(i)));
+        BOOST_TEST_EQ(counted::live_count, 4);
+
+        counted value;
+        BOOST_TEST(q.try_pop(value));
+        BOOST_TEST_EQ(value.value, 0u);
+        BOOST_TEST_EQ(counted::live_count, 4);
+    }
+    BOOST_TEST_EQ(counted::live_count, 0);
+
+    // Capacities that cannot be allocated are rejected without overflowing the size computation
+    const std::size_t max_size = ~static_cast< std::size_t >(0u);
+    const std::size_t huge_capacities[] = { max_size, max_size / 2u + 2u, max_size / 4u };
+    for (std::size_t i = 0u; i < sizeof(huge_capacities) / sizeof(*huge_capacities); ++i)
+    {
+        bool thrown = false;
+        try
+        {
+            boost::bounded_mpmc_queue< unsigned int > q(huge_capacities[i]);
+        }
+        catch (std::length_error&)
+        {
+            thrown = true;
+        }
+        BOOST_TEST(thrown);
+    }
+}
+
+BOOST_CONSTEXPR_OR_CONST unsigned int producer_count = 4u;
+BOOST_CONSTEXPR_OR_CONST unsigned int consumer_count = 4u;
+BOOST_CONSTEXPR_OR_CONST unsigned int elements_per_producer = 100000u;
+
+void producer_thread(boost::bounded_mpmc_queue< unsigned int >* q, boost::barrier* barrier, unsigned int index)
+{
+    barrier->wait();
+
+    for (unsigned int i = 0u; i < elements_per_producer; ++i)
+        q->push_wait(index * elements_per_producer + i);
+}
+
+void consumer_thread(boost::bounded_mpmc_queue< unsigned int >* q, boost::barrier* barrier, boost::atomic< unsigned int >* counts)
+{
+    barrier->wait();
+
+    for (unsigned int i = 0u; i < producer_count * elements_per_producer / consumer_count; ++i)
+    {
+        unsigned int value = 0u;
+        q->pop_wait(value);
+        counts[value].fetch_add(1u, boost::memory_order_relaxed);
+    }
+}
+
+void test_stress()
+{
+    boost::bounded_mpmc_queue< unsigned int > q(16u);
+    boost::scoped_array< boost::atomic< unsigned int > > counts(new boost::atomic< unsigned int >[producer_count * elements_per_producer]);
+    for (unsigned int i = 0u; i < producer_count * elements_per_producer; ++i)
+        counts[i].store(0u, boost::memory_order_relaxed);
+
+    boost::barrier barrier(producer_count + consumer_count);
+    boost::scoped_array< boost::thread > threads(new boost::thread[producer_count + consumer_count]);
+
+    for (unsigned int i = 0u; i < producer_count; ++i)
+        boost::thread(boost::bind(&producer_thread, &q, &barrier, i)).swap(threads[i]);
+    for (unsigned int i = 0u; i < consumer_count; ++i)
+        boost::thread(boost::bind(&consumer_thread, &q, &barrier, counts.get())).swap(threads[producer_count + i]);
+
+    for (unsigned int i = 0u; i < producer_count + consumer_count; ++i)
+        threads[i].join();
+
+    unsigned int errors = 0u;
+    for (unsigned int i = 0u; i < producer_count * elements_per_producer; ++i)
+    {
+        if (counts[i].load(boost::memory_order_relaxed) != 1u)
+            ++errors;
+    }
+    BOOST_TEST_EQ(errors, 0u);
+
+    unsigned int value = 0u;
+    BOOST_TEST(!q.try_pop(value));
+}
+
+int main()
+{
+    test_api();
+    test_stress();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,94 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies the interference size constants, the runtime cache line size query and the layout
+// and operations of cache_isolated and padded_atomic.
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/interference_size.hpp>
+#include <boost/atomic/cache_isolated.hpp>
+
+#include <cstddef>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+BOOST_STATIC_ASSERT(boost::atomics::destructive_interference_size >= boost::atomics::constructive_interference_size);
+BOOST_STATIC_ASSERT((boost::atomics::destructive_interference_size & (boost::atomics::destructive_interference_size - 1u)) == 0u);
+BOOST_STATIC_ASSERT((boost::atomics::constructive_interference_size & (boost::atomics::constructive_interference_size - 1u)) == 0u);
+
+BOOST_STATIC_ASSERT(boost::alignment_of< boost::atomics::cache_isolated< char > >::value == boost::atomics::destructive_interference_size);
+BOOST_STATIC_ASSERT(sizeof(boost::atomics::cache_isolated< char >) == boost::atomics::destructive_interference_size);
+BOOST_STATIC_ASSERT(sizeof(boost::atomics::cache_isolated< char[BOOST_ATOMIC_DESTRUCTIVE_INTERFERENCE_SIZE + 1] >) == 2u * boost::atomics::destructive_interference_size);
+BOOST_STATIC_ASSERT(boost::alignment_of< boost::atomics::padded_atomic< boost::uint32_t > >::value == boost::atomics::destructive_interference_size);
+BOOST_STATIC_ASSERT(sizeof(boost::atomics::padded_atomic< boost::uint32_t >) == boost::atomics::destructive_interference_size);
+
+struct counters
+{
+    boost::atomics::padded_atomic< unsigned int > a;
+    boost::atomics::padded_atomic< unsigned int > b;
+};
+
+void test_cache_line_size()
+{
+    const std::size_t size = boost::atomics::cache_line_size();
+    BOOST_TEST_GE(size, sizeof(void*));
+    BOOST_TEST_EQ((size & (size - 1u)), 0u);
+    // The result is cached
+    BOOST_TEST_EQ(boost::atomics::cache_line_size(), size);
+}
+
+void test_cache_isolated()
+{
+    boost::atomics::cache_isolated< int > i;
+    BOOST_TEST_EQ(i.get(), 0);
+    *i = 10;
+    BOOST_TEST_EQ(*i, 10);
+
+    boost::atomics::cache_isolated< boost::atomic< unsigned int > > a(5u);
+    BOOST_TEST_EQ(a->load(), 5u);
+    a->fetch_add(1u);
+    BOOST_TEST_EQ(a.get().load(), 6u);
+
+    boost::atomics::cache_isolated< int > const ci(7);
+    BOOST_TEST_EQ(*ci, 7);
+    BOOST_TEST_EQ(ci.get(), 7);
+}
+
+void test_padded_atomic()
+{
+    boost::atomics::padded_atomic< unsigned int > a(1u);
+    BOOST_TEST_EQ(a.load(), 1u);
+    a = 2u;
+    BOOST_TEST_EQ(a.load(boost::memory_order_relaxed), 2u);
+    BOOST_TEST_EQ(a.fetch_add(3u), 2u);
+    BOOST_TEST_EQ(static_cast< unsigned int >(a), 5u);
+    ++a;
+    BOOST_TEST_EQ(a.load(), 6u);
+    unsigned int expected = 6u;
+    BOOST_TEST(a.compare_exchange_strong(expected, 7u));
+    BOOST_TEST_EQ(a.exchange(8u), 7u);
+
+    counters c;
+    const std::size_t distance = reinterpret_cast< const unsigned char* >(&c.b) - reinterpret_cast< const unsigned char* >(&c.a);
+    BOOST_TEST_EQ(distance, boost::atomics::destructive_interference_size);
+    BOOST_TEST_EQ(reinterpret_cast< std::size_t >(&c.a) % boost::atomics::destructive_interference_size, 0u);
+
+    boost::padded_atomic< int > b(-1);
+    BOOST_TEST_EQ(b.load(), -1);
+}
+
+int main()
+{
+    test_cache_line_size();
+    test_cache_isolated();
+    test_padded_atomic();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,115 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies counting and binary semaphores. The stress part of the test uses a semaphore to limit the number
+// of threads concurrently entering a section and checks that the limit is never exceeded.
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/counting_semaphore.hpp>
+
+#include <boost/config.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/smart_ptr/scoped_array.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+void test_api()
+{
+    BOOST_TEST_EQ((boost::atomics::binary_semaphore::max)(), 1);
+    BOOST_TEST_EQ((boost::atomics::counting_semaphore< 100 >::max)(), 100);
+
+    {
+        boost::atomics::counting_semaphore<> sem(2);
+        BOOST_TEST(sem.try_acquire());
+        sem.acquire();
+        BOOST_TEST(!sem.try_acquire());
+        sem.release(3);
+        BOOST_TEST(sem.try_acquire());
+        BOOST_TEST(sem.try_acquire());
+        BOOST_TEST(sem.try_acquire());
+        BOOST_TEST(!sem.try_acquire());
+    }
+
+    {
+        boost::atomics::binary_semaphore sem(0);
+        BOOST_TEST(!sem.try_acquire());
+        sem.release();
+        BOOST_TEST(sem.try_acquire());
+        BOOST_TEST(!sem.try_acquire());
+    }
+}
+
+BOOST_CONSTEXPR_OR_CONST unsigned int thread_count = 8u;
+BOOST_CONSTEXPR_OR_CONST unsigned int max_concurrency = 3u;
+BOOST_CONSTEXPR_OR_CONST unsigned int iteration_count = 20000u;
+
+boost::atomic< unsigned int > g_concurrency(0u);
+boost::atomic< unsigned int > g_errors(0u);
+
+void limited_thread(boost::atomics::counting_semaphore<>* sem)
+{
+    for (unsigned int i = 0u; i < iteration_count; ++i)
+    {
+        sem->acquire();
+        const unsigned int n = g_concurrency.fetch_add(1u, boost::memory_order_relaxed) + 1u;
+        if (n > max_concurrency)
+            g_errors.fetch_add(1u, boost::memory_order_relaxed);
+        if ((i & 63u) == 0u)
+            boost::this_thread::yield();
+        g_concurrency.fetch_sub(1u, boost::memory_order_relaxed);
+        sem->release();
+    }
+}
+
+void test_stress()
+{
+    boost::atomics::counting_semaphore<> sem(max_concurrency);
+
+    boost::scoped_array< boost::thread > threads(new boost::thread[thread_count]);
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        boost::thread(boost::bind(&limited_thread, &sem)).swap(threads[i]);
+
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        threads[i].join();
+
+    BOOST_TEST_EQ(g_errors.load(), 0u);
+    for (unsigned int i = 0u; i < max_concurrency; ++i)
+        BOOST_TEST(sem.try_acquire());
+    BOOST_TEST(!sem.try_acquire());
+}
+
+void ping_thread(boost::atomics::binary_semaphore* ping, boost::atomics::binary_semaphore* pong, unsigned int* counter)
+{
+    for (unsigned int i = 0u; i < iteration_count; ++i)
+    {
+        ping->acquire();
+        ++*counter;
+        pong->release();
+    }
+}
+
+void test_ping_pong()
+{
+    boost::atomics::binary_semaphore ping(1), pong(0);
+    unsigned int counter = 0u;
+
+    boost::thread t1(boost::bind(&ping_thread, &ping, &pong, &counter));
+    boost::thread t2(boost::bind(&ping_thread, &pong, &ping, &counter));
+    t1.join();
+    t2.join();
+
+    BOOST_TEST_EQ(counter, 2u * iteration_count);
+}
+
+int main()
+{
+    test_api();
+    test_stress();
+    test_ping_pong();
+
+    return boost::report_errors();
+}
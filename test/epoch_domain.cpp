@@ -0,0 +1,226 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies epoch-based reclamation. The stress part of the test runs a number of reader threads
+// that access the current object within critical sections, while the writer thread keeps replacing and retiring the object.
+// Reclamation is recorded instead of freeing the memory, so that access to a reclaimed object can be detected reliably.
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/epoch_domain.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <boost/config.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/barrier.hpp>
+#include <boost/smart_ptr/scoped_array.hpp>
+#include <boost/smart_ptr/scoped_ptr.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+struct node
+{
+    boost::atomic< bool > reclaimed;
+
+    node() : reclaimed(false) {}
+};
+
+boost::atomic< unsigned int > g_reclaimed_count(0u);
+
+void reclaim_node(void* p)
+{
+    static_cast< node* >(p)->reclaimed.store(true, boost::memory_order_relaxed);
+    g_reclaimed_count.fetch_add(1u, boost::memory_order_relaxed);
+}
+
+template< typename Domain >
+void test_api()
+{
+    typedef typename Domain::participant participant;
+    typedef typename Domain::guard guard;
+
+    Domain domain;
+    node n1, n2;
+
+    {
+        participant p1(domain);
+        participant p2(domain);
+
+        BOOST_TEST(!p1.is_pinned());
+        {
+            guard g1(p1);
+            BOOST_TEST(p1.is_pinned());
+            {
+                guard g2(p1);
+                BOOST_TEST(p1.is_pinned());
+            }
+            BOOST_TEST(p1.is_pinned());
+
+            p1.retire(&n1, &reclaim_node);
+            BOOST_TEST_EQ(p1.retired_count(), 1u);
+        }
+        BOOST_TEST(!p1.is_pinned());
+
+        // A pinned participant prevents the epoch from advancing more than once
+        p2.pin();
+        for (unsigned int i = 0u; i < 10u; ++i)
+            p1.collect();
+        BOOST_TEST(!n1.reclaimed.load());
+        BOOST_TEST_EQ(p1.retired_count(), 1u);
+        p2.unpin();
+
+        for (unsigned int i = 0u; i < 3u; ++i)
+            p1.collect();
+        BOOST_TEST(n1.reclaimed.load());
+        BOOST_TEST_EQ(p1.retired_count(), 0u);
+
+        {
+            guard g(p2);
+            p2.retire(&n2, &reclaim_node);
+        }
+    }
+
+    // The participant reclaims all retired objects on destruction
+    BOOST_TEST(n2.reclaimed.load());
+
+    // All slots are occupied
+    {
+        boost::scoped_array< boost::scoped_ptr< participant > > participants(new boost::scoped_ptr< participant >[Domain::max_participants]);
+        for (std::size_t i = 0u; i < Domain::max_participants; ++i)
+            participants[i].reset(new participant(domain));
+
+        bool thrown = false;
+        try
+        {
+            participant p(domain);
+        }
+        catch (std::length_error&)
+        {
+            thrown = true;
+        }
+        BOOST_TEST(thrown);
+    }
+}
+
+//! Tests that an object is not reclaimed while a participant that pinned after the retiring participant may still access it
+template< typename Domain >
+void test_late_reader()
+{
+    typedef typename Domain::participant participant;
+
+    Domain domain;
+    node n;
+
+    participant retirer(domain);
+    participant reader(domain);
+
+    retirer.pin();
+    const typename Domain::epoch_type epoch = domain.epoch();
+
+    // The epoch can advance once while the retirer is pinned
+    retirer.collect();
+    BOOST_TEST_EQ(domain.epoch(), static_cast< typename Domain::epoch_type >(epoch + 1u));
+
+    // The reader pins in the next epoch and obtains the pointer to the object before the retirer makes it unreachable
+    reader.pin();
+    retirer.retire(&n, &reclaim_node);
+    retirer.unpin();
+
+    // The epoch can advance once more, but the object must survive while the reader is pinned
+    for (unsigned int i = 0u; i < 10u; ++i)
+        retirer.collect();
+    BOOST_TEST_EQ(domain.epoch(), static_cast< typename Domain::epoch_type >(epoch + 2u));
+    BOOST_TEST(!n.reclaimed.load());
+
+    reader.unpin();
+
+    for (unsigned int i = 0u; i < 3u; ++i)
+        retirer.collect();
+    BOOST_TEST(n.reclaimed.load());
+    BOOST_TEST_EQ(retirer.retired_count(), 0u);
+}
+
+BOOST_CONSTEXPR_OR_CONST unsigned int node_count = 100000u;
+
+boost::atomic< node* > g_current(static_cast< node* >(NULL));
+boost::atomic< bool > g_done(false);
+boost::atomic< unsigned int > g_errors(0u);
+
+template< typename Domain >
+void reader_thread(Domain* domain, boost::barrier* barrier)
+{
+    typename Domain::participant p(*domain);
+    barrier->wait();
+
+    while (!g_done.load(boost::memory_order_relaxed))
+    {
+        typename Domain::guard g(p);
+        node* n = g_current.load(boost::memory_order_acquire);
+        if (n->reclaimed.load(boost::memory_order_relaxed))
+            g_errors.fetch_add(1u, boost::memory_order_relaxed);
+    }
+}
+
+template< typename Domain >
+void test_stress()
+{
+    g_reclaimed_count.store(0u);
+    g_done.store(false);
+
+    boost::scoped_array< node > nodes(new node[node_count]);
+    Domain domain;
+    g_current.store(&nodes[0]);
+
+    const unsigned int thread_count = boost::thread::hardware_concurrency() < 2u ? 2u : boost::thread::hardware_concurrency();
+    boost::barrier barrier(thread_count + 1u);
+    boost::scoped_array< boost::thread > threads(new boost::thread[thread_count]);
+
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        boost::thread(boost::bind(&reader_thread< Domain >, &domain, &barrier)).swap(threads[i]);
+
+    {
+        typename Domain::participant p(domain);
+        barrier.wait();
+
+        for (unsigned int i = 1u; i < node_count; ++i)
+        {
+            {
+                typename Domain::guard g(p);
+                node* old = g_current.exchange(&nodes[i], boost::memory_order_acq_rel);
+                p.retire(old, &reclaim_node);
+            }
+
+            // Let the readers that were preempted while pinned re-pin in the later epochs, which is needed to advance the epoch
+            // when there are fewer CPUs than threads
+            if ((i % 1000u) == 0u)
+                boost::this_thread::yield();
+        }
+
+        g_done.store(true, boost::memory_order_relaxed);
+
+        for (unsigned int i = 0u; i < thread_count; ++i)
+            threads[i].join();
+
+        BOOST_TEST_EQ(g_errors.load(), 0u);
+        // The objects are reclaimed while the writer is running
+        BOOST_TEST(g_reclaimed_count.load() > 0u);
+    }
+
+    BOOST_TEST_EQ(g_reclaimed_count.load(), node_count - 1u);
+}
+
+int main()
+{
+    test_api< boost::epoch_domain >();
+    test_api< boost::ipc_epoch_domain >();
+    test_late_reader< boost::epoch_domain >();
+    test_late_reader< boost::ipc_epoch_domain >();
+    test_stress< boost::epoch_domain >();
+    test_stress< boost::ipc_epoch_domain >();
+
+    return boost::report_errors();
+}
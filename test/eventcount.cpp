@@ -0,0 +1,155 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies the eventcount. The stress part of the test adds blocking to a lock-free counter of available items:
+// producers increment the counter and notify the eventcount, and consumers decrement the counter, blocking on the eventcount
+// while it is zero. The test checks that all items are consumed and no consumer is left blocked. The test also verifies
+// that a thread is not blocked after many notifications that were issued between preparing and committing to wait.
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/eventcount.hpp>
+
+#include <boost/config.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/chrono/duration.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/smart_ptr/scoped_array.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+void test_api()
+{
+    boost::atomics::eventcount ec;
+
+    // Notifying without waiters has no effect
+    ec.notify_one();
+    ec.notify_all();
+
+    ec.prepare_wait();
+    ec.cancel_wait();
+
+    // A notification issued after prepare_wait unblocks commit_wait
+    boost::atomics::eventcount::key k = ec.prepare_wait();
+    ec.notify_one();
+    ec.commit_wait(k);
+
+    k = ec.prepare_wait();
+    ec.notify_all();
+    ec.commit_wait(k);
+}
+
+void commit_wait_thread(boost::atomics::eventcount* ec, boost::atomics::eventcount::key k)
+{
+    ec->commit_wait(k);
+}
+
+//! Tests that commit_wait is not blocked when the number of notifications after prepare_wait exceeds 16-bit range
+void test_many_notifications()
+{
+    boost::atomics::eventcount ec;
+
+    boost::atomics::eventcount::key k = ec.prepare_wait();
+    for (unsigned int i = 0u; i < 65536u; ++i)
+        ec.notify_one();
+
+    boost::thread t(boost::bind(&commit_wait_thread, &ec, k));
+    const bool joined = t.try_join_for(boost::chrono::seconds(10));
+    BOOST_TEST(joined);
+    if (!joined)
+    {
+        // Release the blocked thread to be able to complete the test
+        ec.notify_all();
+        t.join();
+    }
+}
+
+BOOST_CONSTEXPR_OR_CONST unsigned int producer_count = 2u;
+BOOST_CONSTEXPR_OR_CONST unsigned int consumer_count = 4u;
+BOOST_CONSTEXPR_OR_CONST unsigned int item_count = 200000u;
+
+struct blocking_counter
+{
+    boost::atomic< unsigned int > m_items;
+    boost::atomics::eventcount m_eventcount;
+
+    blocking_counter() : m_items(0u)
+    {
+    }
+
+    void put()
+    {
+        m_items.fetch_add(1u, boost::memory_order_release);
+        m_eventcount.notify_one();
+    }
+
+    bool try_take()
+    {
+        unsigned int n = m_items.load(boost::memory_order_relaxed);
+        while (n > 0u)
+        {
+            if (m_items.compare_exchange_weak(n, n - 1u, boost::memory_order_acquire, boost::memory_order_relaxed))
+                return true;
+        }
+
+        return false;
+    }
+
+    void take()
+    {
+        while (!try_take())
+        {
+            boost::atomics::eventcount::key k = m_eventcount.prepare_wait();
+            if (try_take())
+            {
+                m_eventcount.cancel_wait();
+                return;
+            }
+
+            m_eventcount.commit_wait(k);
+        }
+    }
+};
+
+void producer_thread(blocking_counter* counter)
+{
+    for (unsigned int i = 0u; i < item_count / producer_count; ++i)
+    {
+        counter->put();
+        if ((i & 255u) == 0u)
+            boost::this_thread::yield();
+    }
+}
+
+void consumer_thread(blocking_counter* counter)
+{
+    for (unsigned int i = 0u; i < item_count / consumer_count; ++i)
+        counter->take();
+}
+
+void test_stress()
+{
+    blocking_counter counter;
+
+    boost::scoped_array< boost::thread > threads(new boost::thread[producer_count + consumer_count]);
+    for (unsigned int i = 0u; i < consumer_count; ++i)
+        boost::thread(boost::bind(&consumer_thread, &counter)).swap(threads[i]);
+    for (unsigned int i = 0u; i < producer_count; ++i)
+        boost::thread(boost::bind(&producer_thread, &counter)).swap(threads[consumer_count + i]);
+
+    for (unsigned int i = 0u; i < producer_count + consumer_count; ++i)
+        threads[i].join();
+
+    BOOST_TEST_EQ(counter.m_items.load(), 0u);
+}
+
+int main()
+{
+    test_api();
+    test_many_notifications();
+    test_stress();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,157 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies hazard pointer protection and reclamation. The stress part of the test runs a number of reader threads
+// that protect and access the current object, while the writer thread keeps replacing and retiring the object.
+// Reclamation is recorded instead of freeing the memory, so that access to a reclaimed object can be detected reliably.
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/hazard_pointer.hpp>
+
+#include <cstddef>
+#include <boost/config.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/barrier.hpp>
+#include <boost/smart_ptr/scoped_array.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+struct node;
+
+struct node_deleter
+{
+    void operator() (node* p) const;
+};
+
+struct node :
+    public boost::hazard_pointer_obj_base< node, node_deleter >
+{
+    boost::atomic< bool > reclaimed;
+
+    node() : reclaimed(false) {}
+};
+
+boost::atomic< unsigned int > g_reclaimed_count(0u);
+
+void node_deleter::operator() (node* p) const
+{
+    p->reclaimed.store(true, boost::memory_order_relaxed);
+    g_reclaimed_count.fetch_add(1u, boost::memory_order_relaxed);
+}
+
+void test_api()
+{
+    boost::hazard_pointer_domain domain;
+    node n1, n2;
+    boost::atomic< node* > src(&n1);
+
+    {
+        boost::hazard_pointer empty_hp;
+        BOOST_TEST(empty_hp.empty());
+
+        boost::hazard_pointer hp(domain);
+        BOOST_TEST(!hp.empty());
+
+        node* p = hp.protect(src);
+        BOOST_TEST(p == &n1);
+
+        src.store(&n2);
+        n1.retire(domain);
+        domain.cleanup();
+        BOOST_TEST(!n1.reclaimed.load());
+
+        // try_protect fails if the source has changed
+        p = &n1;
+        BOOST_TEST(!hp.try_protect(p, src));
+        BOOST_TEST(p == &n2);
+        BOOST_TEST(hp.try_protect(p, src));
+        BOOST_TEST(p == &n2);
+
+        domain.cleanup();
+        BOOST_TEST(n1.reclaimed.load());
+        BOOST_TEST(!n2.reclaimed.load());
+
+        hp.reset_protection();
+        swap(empty_hp, hp);
+        BOOST_TEST(hp.empty());
+        BOOST_TEST(!empty_hp.empty());
+    }
+
+    // The domain reclaims all remaining objects on destruction
+    {
+        boost::hazard_pointer_domain domain2;
+        n2.retire(domain2);
+    }
+    BOOST_TEST(n2.reclaimed.load());
+}
+
+BOOST_CONSTEXPR_OR_CONST unsigned int node_count = 100000u;
+
+boost::atomic< node* > g_current(static_cast< node* >(NULL));
+boost::atomic< bool > g_done(false);
+boost::atomic< unsigned int > g_errors(0u);
+
+void reader_thread(boost::hazard_pointer_domain* domain, boost::barrier* barrier)
+{
+    boost::hazard_pointer hp(*domain);
+    barrier->wait();
+
+    while (!g_done.load(boost::memory_order_relaxed))
+    {
+        node* p = hp.protect(g_current);
+        if (p->reclaimed.load(boost::memory_order_relaxed))
+            g_errors.fetch_add(1u, boost::memory_order_relaxed);
+        hp.reset_protection();
+    }
+}
+
+void test_stress()
+{
+    g_reclaimed_count.store(0u);
+
+    boost::scoped_array< node > nodes(new node[node_count]);
+    {
+        boost::hazard_pointer_domain domain;
+        g_current.store(&nodes[0]);
+
+        const unsigned int thread_count = boost::thread::hardware_concurrency() < 2u ? 2u : boost::thread::hardware_concurrency();
+        boost::barrier barrier(thread_count + 1u);
+        boost::scoped_array< boost::thread > threads(new boost::thread[thread_count]);
+
+        for (unsigned int i = 0u; i < thread_count; ++i)
+            boost::thread(boost::bind(&reader_thread, &domain, &barrier)).swap(threads[i]);
+
+        barrier.wait();
+
+        for (unsigned int i = 1u; i < node_count; ++i)
+        {
+            node* old = g_current.exchange(&nodes[i], boost::memory_order_acq_rel);
+            old->retire(domain);
+        }
+
+        g_done.store(true, boost::memory_order_relaxed);
+
+        for (unsigned int i = 0u; i < thread_count; ++i)
+            threads[i].join();
+
+        BOOST_TEST_EQ(g_errors.load(), 0u);
+        // The objects are reclaimed in batches while the writer is running
+        BOOST_TEST(g_reclaimed_count.load() > 0u);
+
+        g_current.load()->retire(domain);
+    }
+
+    BOOST_TEST_EQ(g_reclaimed_count.load(), node_count);
+}
+
+int main()
+{
+    test_api();
+    test_stress();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,156 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies the SPSC ring buffer. The stress part of the test runs a producer and a consumer thread
+// that use blocking and batched operations on a small ring and checks that the elements are received in order.
+
+#include <boost/atomic/ipc_spsc_ring.hpp>
+
+#include <cstddef>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/smart_ptr/scoped_ptr.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+typedef boost::ipc_spsc_ring< boost::uint32_t, 8u > small_ring;
+
+void test_api()
+{
+    boost::scoped_ptr< small_ring > ring(new small_ring());
+    BOOST_TEST_EQ(small_ring::capacity, 8u);
+
+    boost::uint32_t value = 0u;
+    BOOST_TEST(!ring->try_pop(value));
+
+    for (boost::uint32_t i = 0u; i < 8u; ++i)
+        BOOST_TEST(ring->try_push(i));
+    BOOST_TEST(!ring->try_push(100u));
+
+    for (boost::uint32_t i = 0u; i < 5u; ++i)
+    {
+        BOOST_TEST(ring->try_pop(value));
+        BOOST_TEST_EQ(value, i);
+    }
+
+    // Reservation is limited by the end of the ring
+    std::size_t count = 8u;
+    boost::uint32_t* p = ring->reserve_push(count);
+    BOOST_TEST(p != NULL);
+    BOOST_TEST_EQ(count, 5u);
+
+    // Commit only a part of the reserved slots
+    p[0] = 10u;
+    p[1] = 11u;
+    ring->commit_push(2u);
+
+    count = 8u;
+    p = ring->reserve_push(count);
+    BOOST_TEST(p != NULL);
+    BOOST_TEST_EQ(count, 3u);
+    p[0] = 12u;
+    p[1] = 13u;
+    p[2] = 14u;
+    ring->commit_push(3u);
+
+    count = 1u;
+    BOOST_TEST(ring->reserve_push(count) == NULL);
+    BOOST_TEST_EQ(count, 0u);
+
+    count = 8u;
+    const boost::uint32_t* cp = ring->reserve_pop(count);
+    BOOST_TEST(cp != NULL);
+    BOOST_TEST_EQ(count, 3u);
+    BOOST_TEST_EQ(cp[0], 5u);
+    BOOST_TEST_EQ(cp[2], 7u);
+    ring->commit_pop(count);
+
+    count = 8u;
+    cp = ring->reserve_pop_wait(count);
+    BOOST_TEST_EQ(count, 5u);
+    for (boost::uint32_t i = 0u; i < 5u; ++i)
+        BOOST_TEST_EQ(cp[i], 10u + i);
+    ring->commit_pop(count);
+
+    count = 1u;
+    BOOST_TEST(ring->reserve_pop(count) == NULL);
+    BOOST_TEST_EQ(count, 0u);
+
+    ring->push_wait(42u);
+    ring->pop_wait(value);
+    BOOST_TEST_EQ(value, 42u);
+}
+
+BOOST_CONSTEXPR_OR_CONST boost::uint32_t element_count = 1000000u;
+
+void producer_thread(small_ring* ring)
+{
+    boost::uint32_t next = 0u;
+    while (next < element_count)
+    {
+        // Alternate between single element and batched pushes
+        if ((next & 1u) == 0u)
+        {
+            ring->push_wait(next++);
+        }
+        else
+        {
+            std::size_t count = (next % 5u) + 1u;
+            if (count > element_count - next)
+                count = element_count - next;
+            boost::uint32_t* p = ring->reserve_push_wait(count);
+            for (std::size_t i = 0u; i < count; ++i)
+                p[i] = next++;
+            ring->commit_push(count);
+        }
+    }
+}
+
+void test_stress()
+{
+    boost::scoped_ptr< small_ring > ring(new small_ring());
+    boost::thread producer(boost::bind(&producer_thread, ring.get()));
+
+    unsigned int errors = 0u;
+    boost::uint32_t expected = 0u;
+    while (expected < element_count)
+    {
+        if ((expected & 1u) == 0u)
+        {
+            boost::uint32_t value = 0u;
+            ring->pop_wait(value);
+            if (value != expected)
+                ++errors;
+            ++expected;
+        }
+        else
+        {
+            std::size_t count = 3u;
+            const boost::uint32_t* p = ring->reserve_pop_wait(count);
+            for (std::size_t i = 0u; i < count; ++i, ++expected)
+            {
+                if (p[i] != expected)
+                    ++errors;
+            }
+            ring->commit_pop(count);
+        }
+    }
+
+    producer.join();
+
+    BOOST_TEST_EQ(errors, 0u);
+    boost::uint32_t value = 0u;
+    BOOST_TEST(!ring->try_pop(value));
+}
+
+int main()
+{
+    test_api();
+    test_stress();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,178 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies multi-word compare-and-swap operations. Besides the basic API checks, a number of threads
+// increment randomly selected pairs of adjacent words with multi-word compare-and-swap, two pairs at a time, while another
+// thread takes snapshots of the pairs and verifies that both words of a pair have the same value.
+
+#include <boost/atomic/kcas.hpp>
+
+#include <cstddef>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/barrier.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+const unsigned int thread_count = 4u;
+const unsigned int iteration_count = 20000u;
+const std::size_t pair_count = 4u;
+const std::size_t word_count = pair_count * 2u;
+const std::size_t group_size = 4u;
+//! The increment is shifted to keep the reserved bits clear
+const boost::uintptr_t increment = 4u;
+
+template< typename Domain >
+void test_api()
+{
+    Domain domain;
+    typename Domain::participant p(domain);
+
+    boost::kcas_word words[4];
+    for (unsigned int i = 0u; i < 4u; ++i)
+        words[i].store(i * increment, boost::memory_order_relaxed);
+
+    boost::kcas_entry entries[4];
+    for (unsigned int i = 0u; i < 4u; ++i)
+    {
+        // Specify the words in the reverse order of addresses
+        entries[i].word = &words[3u - i];
+        entries[i].expected = (3u - i) * increment;
+        entries[i].desired = (3u - i) * increment + 10u * increment;
+    }
+
+    BOOST_TEST(p.compare_exchange(entries, 4u));
+    for (unsigned int i = 0u; i < 4u; ++i)
+        BOOST_TEST_EQ(p.load(words[i]), i * increment + 10u * increment);
+
+    // Only one word does not match
+    for (unsigned int i = 0u; i < 4u; ++i)
+    {
+        entries[i].expected = entries[i].desired;
+        entries[i].desired = 0u;
+    }
+    entries[2].expected += increment;
+
+    BOOST_TEST(!p.compare_exchange(entries, 4u));
+    for (unsigned int i = 0u; i < 4u; ++i)
+        BOOST_TEST_EQ(p.load(words[i]), i * increment + 10u * increment);
+
+    BOOST_TEST(p.compare_exchange(entries, 0u));
+
+    entries[2].expected -= increment;
+    BOOST_TEST(p.compare_exchange(entries + 1, 2u));
+    BOOST_TEST_EQ(p.load(words[0]), 0u * increment + 10u * increment);
+    BOOST_TEST_EQ(p.load(words[1]), 0u);
+    BOOST_TEST_EQ(p.load(words[2]), 0u);
+    BOOST_TEST_EQ(p.load(words[3]), 3u * increment + 10u * increment);
+}
+
+template< typename Domain >
+struct test_state
+{
+    Domain domain;
+    boost::kcas_word words[word_count];
+    boost::barrier start_barrier;
+    boost::atomic< unsigned int > running_count;
+
+    test_state() : start_barrier(thread_count + 2u), running_count(thread_count)
+    {
+        for (std::size_t i = 0u; i < word_count; ++i)
+            words[i].store(0u, boost::memory_order_relaxed);
+    }
+};
+
+template< typename Domain >
+void increment_thread(test_state< Domain >* state, unsigned int seed, unsigned int* success_count)
+{
+    typename Domain::participant p(state->domain);
+    state->start_barrier.wait();
+
+    unsigned int successes = 0u;
+    for (unsigned int i = 0u; i < iteration_count; ++i)
+    {
+        boost::kcas_entry entries[group_size];
+        seed = seed * 1103515245u + 12345u;
+        const std::size_t first_pair = (seed >> 16) % pair_count;
+        const std::size_t second_pair = (first_pair + 1u + (seed >> 24) % (pair_count - 1u)) % pair_count;
+        for (std::size_t j = 0u; j < group_size; ++j)
+        {
+            boost::kcas_word& w = state->words[(j < 2u ? first_pair : second_pair) * 2u + (j & 1u)];
+            entries[j].word = &w;
+            entries[j].expected = p.load(w);
+            entries[j].desired = entries[j].expected + increment;
+        }
+
+        if (p.compare_exchange(entries, group_size))
+            ++successes;
+    }
+
+    *success_count = successes;
+    state->running_count.fetch_sub(1u, boost::memory_order_release);
+}
+
+template< typename Domain >
+void verify_thread(test_state< Domain >* state, unsigned int* failures)
+{
+    typename Domain::participant p(state->domain);
+    state->start_barrier.wait();
+
+    while (state->running_count.load(boost::memory_order_acquire) > 0u)
+    {
+        for (std::size_t i = 0u; i < pair_count; ++i)
+        {
+            // A compare-and-swap that does not modify the words validates the snapshot
+            boost::kcas_entry entries[2];
+            for (std::size_t j = 0u; j < 2u; ++j)
+            {
+                entries[j].word = &state->words[i * 2u + j];
+                entries[j].expected = entries[j].desired = p.load(*entries[j].word);
+            }
+
+            if (p.compare_exchange(entries, 2u) && entries[0].expected != entries[1].expected)
+                ++*failures;
+        }
+    }
+}
+
+template< typename Domain >
+void test_concurrent_increments()
+{
+    test_state< Domain > state;
+    unsigned int success_counts[thread_count] = {};
+    unsigned int failures = 0u;
+
+    boost::thread_group threads;
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        threads.create_thread(boost::bind(&increment_thread< Domain >, &state, i + 1u, &success_counts[i]));
+    threads.create_thread(boost::bind(&verify_thread< Domain >, &state, &failures));
+
+    state.start_barrier.wait();
+    threads.join_all();
+
+    typename Domain::participant p(state.domain);
+    boost::uintptr_t sum = 0u;
+    for (std::size_t i = 0u; i < word_count; ++i)
+        sum += p.load(state.words[i]);
+
+    boost::uintptr_t expected_sum = 0u;
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        expected_sum += static_cast< boost::uintptr_t >(success_counts[i]) * group_size * increment;
+
+    BOOST_TEST_EQ(sum, expected_sum);
+    BOOST_TEST_EQ(failures, 0u);
+}
+
+int main()
+{
+    test_api< boost::kcas_domain >();
+    test_api< boost::locked_kcas_domain >();
+    test_concurrent_increments< boost::kcas_domain >();
+    test_concurrent_increments< boost::locked_kcas_domain >();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,96 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies the latch. Worker threads publish their results and count down the latch,
+// and the waiting threads check that all results are visible once the latch is released.
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/latch.hpp>
+
+#include <boost/config.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/smart_ptr/scoped_array.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+void test_api()
+{
+    {
+        boost::atomics::latch l(0);
+        BOOST_TEST(l.try_wait());
+        l.wait();
+    }
+
+    {
+        boost::atomics::latch l(3);
+        BOOST_TEST(!l.try_wait());
+        l.count_down();
+        BOOST_TEST(!l.try_wait());
+        l.count_down(2);
+        BOOST_TEST(l.try_wait());
+        l.wait();
+    }
+
+    {
+        boost::atomics::latch l(1);
+        l.arrive_and_wait();
+        BOOST_TEST(l.try_wait());
+    }
+}
+
+BOOST_CONSTEXPR_OR_CONST unsigned int thread_count = 8u;
+BOOST_CONSTEXPR_OR_CONST unsigned int round_count = 1000u;
+
+boost::atomic< unsigned int > g_errors(0u);
+
+void worker_thread(boost::atomics::latch* l, unsigned int* results, unsigned int index, unsigned int round)
+{
+    results[index] = round;
+    if ((index & 1u) == 0u)
+    {
+        l->count_down();
+    }
+    else
+    {
+        l->arrive_and_wait();
+        for (unsigned int i = 0u; i < thread_count; ++i)
+        {
+            if (results[i] != round)
+                g_errors.fetch_add(1u, boost::memory_order_relaxed);
+        }
+    }
+}
+
+void test_stress()
+{
+    boost::scoped_array< unsigned int > results(new unsigned int[thread_count]);
+    for (unsigned int round = 1u; round <= round_count; ++round)
+    {
+        boost::atomics::latch l(thread_count);
+
+        boost::scoped_array< boost::thread > threads(new boost::thread[thread_count]);
+        for (unsigned int i = 0u; i < thread_count; ++i)
+            boost::thread(boost::bind(&worker_thread, &l, results.get(), i, round)).swap(threads[i]);
+
+        l.wait();
+        for (unsigned int i = 0u; i < thread_count; ++i)
+            BOOST_TEST_EQ(results[i], round);
+
+        for (unsigned int i = 0u; i < thread_count; ++i)
+            threads[i].join();
+    }
+
+    BOOST_TEST_EQ(g_errors.load(), 0u);
+}
+
+int main()
+{
+    test_api();
+    test_stress();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,199 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies the mutex and condition variable. The mutex is tested by a number of threads incrementing
+// a non-atomic counter, and the condition variable is tested with a producer-consumer queue, where notifications
+// are issued both with and without the mutex locked.
+
+#include <boost/atomic/capabilities.hpp>
+#include <boost/atomic/mutex.hpp>
+#include <boost/atomic/condition_variable.hpp>
+
+#include <cstddef>
+#include <boost/config.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/barrier.hpp>
+#include <boost/thread/lock_types.hpp>
+#include <boost/smart_ptr/scoped_array.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+template< typename Mutex >
+void test_mutex_api()
+{
+    BOOST_TEST_EQ(sizeof(Mutex), 4u);
+
+    Mutex m;
+    BOOST_TEST(m.try_lock());
+    BOOST_TEST(!m.try_lock());
+    m.unlock();
+
+    m.lock();
+    BOOST_TEST(!m.try_lock());
+    m.unlock();
+
+    BOOST_TEST(m.try_lock());
+    m.unlock();
+}
+
+BOOST_CONSTEXPR_OR_CONST unsigned int thread_count = 4u;
+BOOST_CONSTEXPR_OR_CONST unsigned int iteration_count = 200000u;
+
+template< typename Mutex >
+void counter_thread(Mutex* m, unsigned int* counter, boost::barrier* barrier)
+{
+    barrier->wait();
+
+    for (unsigned int i = 0u; i < iteration_count; ++i)
+    {
+        if ((i & 7u) == 0u)
+        {
+            while (!m->try_lock())
+            {
+            }
+        }
+        else
+        {
+            m->lock();
+        }
+
+        // The non-atomic read-modify-write would lose increments if the mutex didn't provide mutual exclusion
+        const unsigned int n = *counter;
+        *counter = n + 1u;
+        m->unlock();
+    }
+}
+
+template< typename Mutex >
+void test_mutex_stress()
+{
+    Mutex m;
+    unsigned int counter = 0u;
+
+    boost::barrier barrier(thread_count);
+    boost::scoped_array< boost::thread > threads(new boost::thread[thread_count]);
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        boost::thread(boost::bind(&counter_thread< Mutex >, &m, &counter, &barrier)).swap(threads[i]);
+
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        threads[i].join();
+
+    BOOST_TEST_EQ(counter, thread_count * iteration_count);
+}
+
+BOOST_CONSTEXPR_OR_CONST unsigned int queue_size = 16u;
+BOOST_CONSTEXPR_OR_CONST unsigned int item_count = 100000u;
+
+//! A bounded queue protected by a mutex with condition variables for full and empty states
+template< typename Mutex, typename ConditionVariable >
+struct queue
+{
+    Mutex m_mutex;
+    ConditionVariable m_not_empty;
+    ConditionVariable m_not_full;
+    unsigned int m_items[queue_size];
+    unsigned int m_head;
+    unsigned int m_size;
+    bool m_notify_unlocked;
+
+    explicit queue(bool notify_unlocked) : m_head(0u), m_size(0u), m_notify_unlocked(notify_unlocked)
+    {
+    }
+
+    void push(unsigned int item)
+    {
+        boost::unique_lock< Mutex > lock(m_mutex);
+        while (m_size == queue_size)
+            m_not_full.wait(lock);
+
+        m_items[(m_head + m_size) % queue_size] = item;
+        ++m_size;
+
+        if (m_notify_unlocked)
+            lock.unlock();
+        m_not_empty.notify_one();
+    }
+
+    unsigned int pop()
+    {
+        boost::unique_lock< Mutex > lock(m_mutex);
+        m_not_empty.wait(lock, boost::bind(&queue::is_not_empty, this));
+
+        const unsigned int item = m_items[m_head];
+        m_head = (m_head + 1u) % queue_size;
+        --m_size;
+
+        if (m_notify_unlocked)
+            lock.unlock();
+        m_not_full.notify_all();
+        return item;
+    }
+
+    bool is_not_empty() const
+    {
+        return m_size > 0u;
+    }
+};
+
+template< typename Queue >
+void producer_thread(Queue* q, unsigned int id, unsigned int producer_count)
+{
+    for (unsigned int i = id; i < item_count; i += producer_count)
+        q->push(i);
+}
+
+template< typename Queue >
+void consumer_thread(Queue* q, unsigned int count, unsigned long long* sum)
+{
+    unsigned long long s = 0u;
+    for (unsigned int i = 0u; i < count; ++i)
+        s += q->pop();
+    *sum = s;
+}
+
+template< typename Mutex, typename ConditionVariable >
+void test_condition_variable(bool notify_unlocked)
+{
+    typedef queue< Mutex, ConditionVariable > queue_type;
+    queue_type q(notify_unlocked);
+
+    const unsigned int producer_count = 2u, consumer_count = 2u;
+    unsigned long long sums[consumer_count] = {};
+
+    boost::scoped_array< boost::thread > threads(new boost::thread[producer_count + consumer_count]);
+    for (unsigned int i = 0u; i < consumer_count; ++i)
+        boost::thread(boost::bind(&consumer_thread< queue_type >, &q, item_count / consumer_count, &sums[i])).swap(threads[i]);
+    for (unsigned int i = 0u; i < producer_count; ++i)
+        boost::thread(boost::bind(&producer_thread< queue_type >, &q, i, producer_count)).swap(threads[consumer_count + i]);
+
+    for (unsigned int i = 0u; i < producer_count + consumer_count; ++i)
+        threads[i].join();
+
+    unsigned long long sum = 0u;
+    for (unsigned int i = 0u; i < consumer_count; ++i)
+        sum += sums[i];
+
+    BOOST_TEST_EQ(sum, static_cast< unsigned long long >(item_count) * (item_count - 1u) / 2u);
+    BOOST_TEST_EQ(q.m_size, 0u);
+}
+
+int main()
+{
+    test_mutex_api< boost::atomics::mutex >();
+    test_mutex_stress< boost::atomics::mutex >();
+    test_condition_variable< boost::atomics::mutex, boost::atomics::condition_variable >(false);
+    test_condition_variable< boost::atomics::mutex, boost::atomics::condition_variable >(true);
+
+#if BOOST_ATOMIC_INT32_LOCK_FREE == 2 && BOOST_ATOMIC_POINTER_LOCK_FREE == 2
+    // Inter-process mutex and condition variable require lock-free atomic operations
+    test_mutex_api< boost::atomics::ipc_mutex >();
+    test_mutex_stress< boost::atomics::ipc_mutex >();
+    test_condition_variable< boost::atomics::ipc_mutex, boost::atomics::ipc_condition_variable >(false);
+    test_condition_variable< boost::atomics::ipc_mutex, boost::atomics::ipc_condition_variable >(true);
+#endif
+
+    return boost::report_errors();
+}
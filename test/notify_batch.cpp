@@ -0,0 +1,185 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that notify_batch unblocks the threads waiting on the atomic objects that were added to the batch.
+// The objects of different sizes are tested, so that both native waiting operations and the parking lot are used.
+// The test also verifies that repeated notifications of the same object are accumulated and that the batch is flushed
+// when it is full.
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/atomic_ref.hpp>
+#include <boost/atomic/atomic_flag.hpp>
+#include <boost/atomic/notify_batch.hpp>
+
+#include <cstddef>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/chrono/chrono.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+namespace chrono = boost::chrono;
+
+BOOST_CONSTEXPR_OR_CONST std::size_t object_count = 3u;
+BOOST_CONSTEXPR_OR_CONST std::size_t many_object_count = boost::notify_batch::capacity + 5u;
+
+template< typename T >
+struct BOOST_ALIGNMENT(16) aligned_value
+{
+    T value;
+};
+
+template< typename Atomic, typename T >
+void wait_thread(Atomic* a, T old_val, T* received)
+{
+    *received = a->wait(old_val, boost::memory_order_acquire);
+}
+
+template< typename T >
+void ref_wait_thread(T* p, T old_val, T* received)
+{
+    *received = boost::atomic_ref< T >(*p).wait(old_val, boost::memory_order_acquire);
+}
+
+void flag_wait_thread(boost::atomic_flag* f, bool* received)
+{
+    *received = f->wait(false, boost::memory_order_acquire);
+}
+
+//! Tests that repeated notify_one calls on the same object unblock as many threads
+template< typename T >
+void test_notify_one()
+{
+    boost::atomic< T > a[object_count];
+    T received[object_count][2];
+    boost::thread_group threads;
+    for (std::size_t i = 0u; i < object_count; ++i)
+    {
+        a[i].store(0u, boost::memory_order_relaxed);
+        for (std::size_t j = 0u; j < 2u; ++j)
+        {
+            received[i][j] = 0u;
+            threads.create_thread(boost::bind(&wait_thread< boost::atomic< T >, T >, &a[i], static_cast< T >(0u), &received[i][j]));
+        }
+    }
+
+    boost::this_thread::sleep_for(chrono::milliseconds(50));
+
+    {
+        boost::notify_batch batch;
+        for (std::size_t i = 0u; i < object_count; ++i)
+        {
+            a[i].store(static_cast< T >(i + 1u), boost::memory_order_release);
+            batch.notify_one(a[i]);
+        }
+
+        for (std::size_t i = 0u; i < object_count; ++i)
+            batch.notify_one(a[i]);
+    }
+
+    threads.join_all();
+
+    for (std::size_t i = 0u; i < object_count; ++i)
+    {
+        BOOST_TEST_EQ(received[i][0], static_cast< T >(i + 1u));
+        BOOST_TEST_EQ(received[i][1], static_cast< T >(i + 1u));
+    }
+}
+
+//! Tests notify_all on atomic_ref and atomic_flag, combined with notify_one on the same objects
+template< typename T >
+void test_notify_all()
+{
+    aligned_value< T > values[object_count] = {};
+    T received[object_count][2];
+    boost::atomic_flag flag;
+    bool flag_received[2] = { false, false };
+
+    boost::thread_group threads;
+    for (std::size_t i = 0u; i < object_count; ++i)
+    {
+        for (std::size_t j = 0u; j < 2u; ++j)
+        {
+            received[i][j] = 0u;
+            threads.create_thread(boost::bind(&ref_wait_thread< T >, &values[i].value, static_cast< T >(0u), &received[i][j]));
+        }
+    }
+
+    for (std::size_t j = 0u; j < 2u; ++j)
+        threads.create_thread(boost::bind(&flag_wait_thread, &flag, &flag_received[j]));
+
+    boost::this_thread::sleep_for(chrono::milliseconds(50));
+
+    boost::notify_batch batch;
+    for (std::size_t i = 0u; i < object_count; ++i)
+    {
+        boost::atomic_ref< T > ref(values[i].value);
+        ref.store(static_cast< T >(i + 1u), boost::memory_order_release);
+        batch.notify_one(ref);
+        batch.notify_all(ref);
+        batch.notify_one(ref);
+    }
+
+    flag.test_and_set(boost::memory_order_release);
+    batch.notify_all(flag);
+    batch.flush();
+
+    threads.join_all();
+
+    for (std::size_t i = 0u; i < object_count; ++i)
+    {
+        BOOST_TEST_EQ(received[i][0], static_cast< T >(i + 1u));
+        BOOST_TEST_EQ(received[i][1], static_cast< T >(i + 1u));
+    }
+
+    BOOST_TEST(flag_received[0]);
+    BOOST_TEST(flag_received[1]);
+}
+
+//! Tests that the batch is flushed when more objects than its capacity are added
+template< typename T >
+void test_overflow()
+{
+    boost::atomic< T > a[many_object_count];
+    T received[many_object_count];
+    boost::thread_group threads;
+    for (std::size_t i = 0u; i < many_object_count; ++i)
+    {
+        a[i].store(0u, boost::memory_order_relaxed);
+        received[i] = 0u;
+        threads.create_thread(boost::bind(&wait_thread< boost::atomic< T >, T >, &a[i], static_cast< T >(0u), &received[i]));
+    }
+
+    boost::this_thread::sleep_for(chrono::milliseconds(50));
+
+    {
+        boost::notify_batch batch;
+        for (std::size_t i = 0u; i < many_object_count; ++i)
+        {
+            a[i].store(1u, boost::memory_order_release);
+            batch.notify_all(a[i]);
+        }
+    }
+
+    threads.join_all();
+
+    for (std::size_t i = 0u; i < many_object_count; ++i)
+        BOOST_TEST_EQ(received[i], static_cast< T >(1u));
+}
+
+int main()
+{
+    test_notify_one< boost::uint32_t >();
+    test_notify_one< boost::uint64_t >();
+    test_notify_all< boost::uint32_t >();
+    test_notify_all< boost::uint64_t >();
+    test_overflow< boost::uint32_t >();
+    test_overflow< boost::uint64_t >();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,59 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies the spin loop iteration duration that is used to size spin loops. The duration is either measured or
+// set by the BOOST_ATOMIC_PAUSE_NS environment variable. The test accepts the value of the environment variable and
+// the expected duration in picoseconds as optional command line arguments. Since the duration is calibrated once,
+// every value of the environment variable is tested by a separate run of the test.
+//
+// Command line arguments: [BOOST_ATOMIC_PAUSE_NS value [expected duration in picoseconds]]
+
+#include <boost/atomic/detail/pause_calibration.hpp>
+
+#include <cstdlib>
+#include <stdlib.h>
+#include <boost/config.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+//! The minimum spin loop iteration duration, in picoseconds
+BOOST_CONSTEXPR_OR_CONST unsigned int min_pause_duration_ps = 1000u;
+//! The maximum spin loop iteration duration, in picoseconds
+BOOST_CONSTEXPR_OR_CONST unsigned int max_pause_duration_ps = 10000000u;
+
+void set_pause_ns(const char* value)
+{
+#if defined(BOOST_WINDOWS)
+    _putenv_s("BOOST_ATOMIC_PAUSE_NS", value);
+#else
+    setenv("BOOST_ATOMIC_PAUSE_NS", value, 1);
+#endif
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc > 1)
+        set_pause_ns(argv[1]);
+
+    const unsigned int duration = boost::atomics::detail::get_pause_duration_ps();
+    BOOST_TEST_GE(duration, min_pause_duration_ps);
+    BOOST_TEST_LE(duration, max_pause_duration_ps);
+    if (argc > 2)
+        BOOST_TEST_EQ(duration, static_cast< unsigned int >(std::strtoul(argv[2], NULL, 10)));
+
+    // The duration must not change after calibration
+    BOOST_TEST_EQ(boost::atomics::detail::get_pause_duration_ps(), duration);
+
+    // Since every iteration takes at least 1 ns, the number of iterations does not exceed the spin duration in nanoseconds
+    const unsigned int spin_durations_ns[] = { 0u, 1u, 200u, 300u, 80000u };
+    for (unsigned int i = 0u; i < sizeof(spin_durations_ns) / sizeof(*spin_durations_ns); ++i)
+    {
+        const unsigned int count = boost::atomics::detail::get_pause_count(spin_durations_ns[i]);
+        BOOST_TEST_GE(count, 1u);
+        BOOST_TEST_LE(count, spin_durations_ns[i] > 1u ? spin_durations_ns[i] : 1u);
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,144 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies atomic per-byte memory copying. The copies are checked with different sizes and alignments
+// of the source and destination, and then used to implement a seqlock, where the reader verifies that the payload
+// copied while the sequence counter did not change is consistent.
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/per_byte_memcpy.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <boost/config.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+const std::size_t buffer_size = 512u;
+const unsigned int round_count = 200000u;
+const std::size_t payload_size = 200u;
+
+struct BOOST_ALIGNMENT(64) aligned_buffer
+{
+    unsigned char data[buffer_size];
+};
+
+void fill(unsigned char* p, std::size_t size, unsigned char seed)
+{
+    for (std::size_t i = 0u; i < size; ++i)
+        p[i] = static_cast< unsigned char >(seed + i * 7u);
+}
+
+void test_copy(std::size_t size, std::size_t src_offset, std::size_t dest_offset)
+{
+    aligned_buffer src, dest, expected;
+    fill(src.data, buffer_size, static_cast< unsigned char >(size));
+
+    std::memset(dest.data, 0xAA, buffer_size);
+    std::memcpy(expected.data, dest.data, buffer_size);
+    std::memcpy(expected.data + dest_offset, src.data + src_offset, size);
+
+    void* res = boost::atomic_load_per_byte_memcpy(dest.data + dest_offset, src.data + src_offset, size, boost::memory_order_relaxed);
+    BOOST_TEST(res == dest.data + dest_offset);
+    BOOST_TEST(std::memcmp(dest.data, expected.data, buffer_size) == 0);
+
+    std::memset(dest.data, 0xAA, buffer_size);
+    res = boost::atomic_store_per_byte_memcpy(dest.data + dest_offset, src.data + src_offset, size, boost::memory_order_release);
+    BOOST_TEST(res == dest.data + dest_offset);
+    BOOST_TEST(std::memcmp(dest.data, expected.data, buffer_size) == 0);
+}
+
+void test_api()
+{
+    const std::size_t sizes[] = { 0u, 1u, 3u, 8u, 15u, 16u, 63u, 64u, 79u, 80u, 81u, 127u, 200u, 256u, 300u };
+    for (std::size_t i = 0u; i < sizeof(sizes) / sizeof(*sizes); ++i)
+    {
+        for (std::size_t src_offset = 0u; src_offset < 20u; src_offset += 3u)
+        {
+            for (std::size_t dest_offset = 0u; dest_offset < 20u; dest_offset += 5u)
+                test_copy(sizes[i], src_offset, dest_offset);
+        }
+    }
+}
+
+struct seqlock_state
+{
+    boost::atomic< unsigned int > seq;
+    aligned_buffer payload;
+    boost::atomic< bool > done;
+
+    seqlock_state() : seq(0u), done(false)
+    {
+        std::memset(payload.data, 0, buffer_size);
+    }
+};
+
+void writer_thread(seqlock_state* state)
+{
+    unsigned char data[payload_size];
+    for (unsigned int i = 1u; i <= round_count; ++i)
+    {
+        std::memset(data, static_cast< int >(i & 0xFFu), payload_size);
+
+        const unsigned int seq = state->seq.load(boost::memory_order_relaxed);
+        state->seq.store(seq + 1u, boost::memory_order_relaxed);
+        boost::atomics::atomic_store_per_byte_memcpy(state->payload.data + 1u, data, payload_size, boost::memory_order_release);
+        state->seq.store(seq + 2u, boost::memory_order_release);
+    }
+
+    state->done.store(true, boost::memory_order_release);
+}
+
+void test_seqlock()
+{
+    seqlock_state state;
+    boost::thread writer(boost::bind(&writer_thread, &state));
+
+    unsigned int failures = 0u;
+    unsigned char data[payload_size];
+    bool done;
+    do
+    {
+        // The writer is complete if the flag is set before reading the payload, so the last read must be consistent
+        done = state.done.load(boost::memory_order_acquire);
+        const unsigned int seq1 = state.seq.load(boost::memory_order_acquire);
+        if ((seq1 & 1u) != 0u)
+            continue;
+
+        boost::atomics::atomic_load_per_byte_memcpy(data, state.payload.data + 1u, payload_size, boost::memory_order_acquire);
+        const unsigned int seq2 = state.seq.load(boost::memory_order_relaxed);
+        if (seq1 != seq2)
+        {
+            BOOST_TEST(!done);
+            continue;
+        }
+
+        for (std::size_t i = 1u; i < payload_size; ++i)
+        {
+            if (data[i] != data[0])
+            {
+                ++failures;
+                break;
+            }
+        }
+    }
+    while (!done);
+
+    writer.join();
+
+    BOOST_TEST_EQ(failures, 0u);
+    BOOST_TEST_EQ(data[0], static_cast< unsigned char >(round_count & 0xFFu));
+}
+
+int main()
+{
+    test_api();
+    test_seqlock();
+
+    return boost::report_errors();
+}
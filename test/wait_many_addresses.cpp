@@ -0,0 +1,94 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies waiting and notifying operations with many threads blocked on different atomic objects.
+// The number of blocked threads is large enough for the parking lot to grow its hash table while the threads
+// are blocked, which must not lose any blocked threads. The main thread then notifies the atomic objects
+// in an order different from the order in which the threads blocked, and each thread must get unblocked.
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+
+#include <boost/config.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/chrono/chrono.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/barrier.hpp>
+#include <boost/smart_ptr/scoped_array.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+namespace chrono = boost::chrono;
+
+BOOST_CONSTEXPR_OR_CONST unsigned int thread_count = 100u;
+BOOST_CONSTEXPR_OR_CONST unsigned int round_count = 4u;
+
+struct BOOST_ALIGNMENT(64) waiter_state
+{
+    boost::atomic< unsigned int > value;
+    boost::atomic< unsigned int > wakeups;
+};
+
+waiter_state g_states[thread_count];
+
+void thread_func(unsigned int index, boost::barrier* barrier)
+{
+    waiter_state& state = g_states[index];
+    barrier->wait();
+
+    unsigned int old_value = 0u;
+    while (old_value < round_count)
+    {
+        old_value = state.value.wait(old_value, boost::memory_order_acquire);
+        state.wakeups.fetch_add(1u, boost::memory_order_relaxed);
+    }
+}
+
+int main()
+{
+    for (unsigned int i = 0u; i < thread_count; ++i)
+    {
+        g_states[i].value.store(0u, boost::memory_order_relaxed);
+        g_states[i].wakeups.store(0u, boost::memory_order_relaxed);
+    }
+
+    boost::barrier barrier(thread_count + 1u);
+    boost::scoped_array< boost::thread > threads(new boost::thread[thread_count]);
+
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        boost::thread(boost::bind(&thread_func, i, &barrier)).swap(threads[i]);
+
+    barrier.wait();
+
+    for (unsigned int r = 0u; r < round_count; ++r)
+    {
+        // Let the threads block on their atomic objects
+        boost::this_thread::sleep_for(chrono::milliseconds(100));
+
+        // Notify every other object first, and then the rest in reverse order
+        for (unsigned int i = 0u; i < thread_count; i += 2u)
+        {
+            g_states[i].value.fetch_add(1u, boost::memory_order_release);
+            g_states[i].value.notify_one();
+        }
+
+        for (unsigned int i = thread_count - 1u - (thread_count & 1u); i < thread_count; i -= 2u)
+        {
+            g_states[i].value.fetch_add(1u, boost::memory_order_release);
+            g_states[i].value.notify_all();
+        }
+    }
+
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        threads[i].join();
+
+    for (unsigned int i = 0u; i < thread_count; ++i)
+    {
+        BOOST_TEST_EQ(g_states[i].value.load(boost::memory_order_relaxed), round_count);
+        BOOST_TEST_EQ(g_states[i].wakeups.load(boost::memory_order_relaxed), round_count);
+    }
+
+    return boost::report_errors();
+}
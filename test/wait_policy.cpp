@@ -0,0 +1,187 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies waiting operations with different waiting policies. Every policy is tested with atomic objects
+// that use native waiting operations and with those that use the parking lot, as well as with the synchronization
+// primitives that accept the waiting policy. The adaptive policy is also tested with a ping-pong between two threads,
+// which makes the spin count estimates change.
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/atomic_ref.hpp>
+#include <boost/atomic/atomic_flag.hpp>
+#include <boost/atomic/wait_policy.hpp>
+#include <boost/atomic/latch.hpp>
+#include <boost/atomic/barrier.hpp>
+#include <boost/atomic/counting_semaphore.hpp>
+
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/chrono/chrono.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+namespace chrono = boost::chrono;
+
+const boost::atomics::wait_policy policies[] = { boost::wait_policy_park, boost::wait_policy_spin, boost::wait_policy_adaptive };
+BOOST_CONSTEXPR_OR_CONST unsigned int ping_pong_count = 2000u;
+
+template< typename Atomic, typename T >
+void wait_thread(Atomic* a, T old_val, boost::atomics::wait_policy policy, T* received)
+{
+    *received = a->wait(old_val, boost::memory_order_acquire, policy);
+}
+
+template< typename Atomic, typename T >
+void test_wait(Atomic& a, T value1, T value2, boost::atomics::wait_policy policy)
+{
+    a.store(value1, boost::memory_order_relaxed);
+
+    // The value does not match, the operation must return immediately
+    BOOST_TEST(a.wait(value2, boost::memory_order_acquire, policy) == value1);
+
+    T received = value1;
+    boost::thread t(boost::bind(&wait_thread< Atomic, T >, &a, value1, policy, &received));
+    boost::this_thread::sleep_for(chrono::milliseconds(50));
+    a.store(value2, boost::memory_order_release);
+    a.notify_all();
+    t.join();
+
+    BOOST_TEST(received == value2);
+}
+
+void flag_wait_thread(boost::atomic_flag* f, boost::atomics::wait_policy policy, bool* received)
+{
+    *received = f->wait(false, boost::memory_order_acquire, policy);
+}
+
+void test_flag_wait(boost::atomics::wait_policy policy)
+{
+    boost::atomic_flag f;
+    BOOST_TEST(!f.wait(true, boost::memory_order_acquire, policy));
+
+    bool received = false;
+    boost::thread t(boost::bind(&flag_wait_thread, &f, policy, &received));
+    boost::this_thread::sleep_for(chrono::milliseconds(50));
+    f.test_and_set(boost::memory_order_release);
+    f.notify_all();
+    t.join();
+
+    BOOST_TEST(received);
+}
+
+template< typename T >
+void ping_pong_responder(boost::atomic< T >* a, boost::atomics::wait_policy policy)
+{
+    T value = 0u;
+    for (unsigned int i = 0u; i < ping_pong_count; ++i)
+    {
+        while (value != 1u)
+            value = a->wait(value, boost::memory_order_acquire, policy);
+        a->store(0u, boost::memory_order_release);
+        a->notify_one();
+        value = 0u;
+    }
+}
+
+template< typename T >
+void test_ping_pong(boost::atomics::wait_policy policy)
+{
+    boost::atomic< T > a(0u);
+    boost::thread t(boost::bind(&ping_pong_responder< T >, &a, policy));
+
+    unsigned int rounds = 0u;
+    for (unsigned int i = 0u; i < ping_pong_count; ++i)
+    {
+        a.store(1u, boost::memory_order_release);
+        a.notify_one();
+        T value = 1u;
+        while (value != 0u)
+            value = a.wait(value, boost::memory_order_acquire, policy);
+        ++rounds;
+    }
+
+    t.join();
+    BOOST_TEST_EQ(rounds, ping_pong_count);
+}
+
+void latch_thread(boost::atomics::latch* l, boost::atomics::wait_policy policy)
+{
+    l->arrive_and_wait(1, policy);
+}
+
+void barrier_thread(boost::atomics::barrier<>* b, boost::atomics::wait_policy policy)
+{
+    for (unsigned int i = 0u; i < 10u; ++i)
+        b->arrive_and_wait(policy);
+}
+
+void semaphore_thread(boost::atomics::counting_semaphore<>* s, boost::atomics::wait_policy policy)
+{
+    for (unsigned int i = 0u; i < 10u; ++i)
+        s->acquire(policy);
+}
+
+void test_primitives(boost::atomics::wait_policy policy)
+{
+    {
+        boost::atomics::latch l(3);
+        boost::thread t1(boost::bind(&latch_thread, &l, policy));
+        boost::thread t2(boost::bind(&latch_thread, &l, policy));
+        boost::this_thread::sleep_for(chrono::milliseconds(20));
+        l.count_down();
+        l.wait(policy);
+        t1.join();
+        t2.join();
+        BOOST_TEST(l.try_wait());
+    }
+
+    {
+        boost::atomics::barrier<> b(2);
+        boost::thread t(boost::bind(&barrier_thread, &b, policy));
+        for (unsigned int i = 0u; i < 10u; ++i)
+            b.arrive_and_wait(policy);
+        t.join();
+    }
+
+    {
+        boost::atomics::counting_semaphore<> s(0);
+        boost::thread t(boost::bind(&semaphore_thread, &s, policy));
+        for (unsigned int i = 0u; i < 10u; ++i)
+        {
+            boost::this_thread::sleep_for(chrono::milliseconds(2));
+            s.release();
+        }
+        t.join();
+        BOOST_TEST(!s.try_acquire());
+    }
+}
+
+int main()
+{
+    for (unsigned int i = 0u; i < sizeof(policies) / sizeof(*policies); ++i)
+    {
+        const boost::atomics::wait_policy policy = policies[i];
+
+        boost::atomic< boost::uint32_t > a32(0u);
+        test_wait(a32, static_cast< boost::uint32_t >(1u), static_cast< boost::uint32_t >(2u), policy);
+        boost::atomic< boost::uint64_t > a64(0u);
+        test_wait(a64, static_cast< boost::uint64_t >(1u), static_cast< boost::uint64_t >(2u), policy);
+
+        boost::uint64_t value = 0u;
+        boost::atomic_ref< boost::uint64_t > ref(value);
+        test_wait(ref, static_cast< boost::uint64_t >(1u), static_cast< boost::uint64_t >(2u), policy);
+
+        test_flag_wait(policy);
+        test_primitives(policy);
+    }
+
+    test_ping_pong< boost::uint32_t >(boost::wait_policy_adaptive);
+    test_ping_pong< boost::uint64_t >(boost::wait_policy_adaptive);
+
+    return boost::report_errors();
+}